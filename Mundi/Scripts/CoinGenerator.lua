@@ -24,14 +24,9 @@ local SpawnDelayMax = DEFAULT_SPAWN_DELAY_MAX;
 local CoinsSpawned = Queue.new();
 
 local PoolSize = DEFAULT_POOL_SIZE;
-local CoinPool = Queue.new();
 
--- 충돌 컴포넌트가 포함되어 있으면 다른 물체와 OnOverlap될 수 있으므로
--- Pool마다 STORAGE_POSITION을 다르게 해야 함.
-local STORAGE_POSITION = FTransform();
-STORAGE_POSITION.Translation = FVector(-1000.0, -200.0, 0.0);
-STORAGE_POSITION.Scale3D = FVector(Scale, Scale, Scale);
-STORAGE_POSITION.Rotation = FQuat.MakeFromEuler(0, 90, 0);
+-- 코인 풀은 World 액터 풀을 사용한다.
+-- 반납된 코인은 레벨/충돌/렌더링에서 빠지므로 별도의 보관 위치가 필요 없음.
 
 local function IsCoinActor(Actor)
     if (Actor == nil) then
@@ -72,13 +67,13 @@ end
 
 local function InitializePool()
     local PieWorld = GlobalObjectManager.GetPIEWorld();
+    PieWorld:PrewarmActorPool("ACoinActor", PoolSize);
 
-    for i = 1, PoolSize do
-        local Coin = PieWorld:SpawnActor(STORAGE_POSITION, "ACoinActor");
-        Queue.push(CoinPool, Coin);
-    end
+    PrintToConsole("[CoinGenerator] Pool initialized with " .. PieWorld:GetPooledActorCount("ACoinActor") .. " coins");
+end
 
-    PrintToConsole("[CoinGenerator] Pool initialized with " .. PoolSize .. " coins");
+local function ReleaseCoin(Coin)
+    GlobalObjectManager.GetPIEWorld():ReleaseActor(Coin);
 end
 
 local function GetCoinSpawnLocation()
@@ -91,15 +86,17 @@ local function GetCoinSpawnLocation()
 end
 
 local function SpawnCoin()
-    local Coin = Queue.pop(CoinPool);
+    local CoinTransform = FTransform();
+    CoinTransform.Translation = GetCoinSpawnLocation();
+    CoinTransform.Rotation = FQuat.MakeFromEuler(0.0, 90.0, 0.0);
+    CoinTransform.Scale3D = FVector(Scale, Scale, Scale);
+
+    -- 풀이 비어 있으면 World가 새로 스폰한다
+    local Coin = GlobalObjectManager.GetPIEWorld():AcquireActor("ACoinActor", CoinTransform);
     if (Coin == nil) then
-        PrintToConsole("[CoinGenerator] WARNING: CoinPool is empty!");
+        PrintToConsole("[CoinGenerator] WARNING: failed to acquire coin!");
         return;
     end
-    local CoinLocation = GetCoinSpawnLocation();
-    Coin:SetLocation(CoinLocation);
-    Coin:SetRotation(FVector(0.0, 90.0, 0.0));
-    Coin:SetScale(FVector(Scale, Scale, Scale));
     Queue.push(CoinsSpawned, Coin);
 end
 
@@ -119,9 +116,8 @@ local function CheckCoinLocationAndWithdraw()
     end
 
     if (Oldest:GetLocation().X < MyActor:GetLocation().X - 5.0) then
-        Oldest:SetTransform(STORAGE_POSITION);
         Queue.pop(CoinsSpawned);
-        Queue.push(CoinPool, Oldest);  -- CoinPool로 반환
+        ReleaseCoin(Oldest);  -- 풀로 반환
     end
 end
 
@@ -162,9 +158,8 @@ function OnOverlap(OverlappedComponent, OtherActor, OtherComp, ContactPoint, Pen
         -- dtManager:ApplyHitStop(1.0)
 
         -- 코인을 Pool로 회수
-        OtherActor:SetTransform(STORAGE_POSITION);
         RemoveCoinFromSpawned(OtherActor);
-        Queue.push(CoinPool, OtherActor);
+        ReleaseCoin(OtherActor);
     end
 end
 
@@ -177,8 +172,7 @@ function Restart()
     while not Queue.isEmpty(CoinsSpawned) do
         local Coin = Queue.pop(CoinsSpawned);
         if Coin ~= nil then
-            Coin:SetTransform(STORAGE_POSITION);
-            Queue.push(CoinPool, Coin);
+            ReleaseCoin(Coin);
         end
     end
 end
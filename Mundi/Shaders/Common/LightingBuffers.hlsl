@@ -36,6 +36,9 @@ cbuffer LightBuffer : register(b8)
 //        [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
+// t22: 클러스터 모드에서 g_TileLightIndices와 같은 위치에 해당 라이트가 걸치는 깊이 슬라이스 비트
+StructuredBuffer<uint> g_TileLightSliceMasks : register(t22);
+
 // PointLight, SpotLight Structured Buffer
 StructuredBuffer<FPointLightInfo> g_PointLightList : register(t3);
 StructuredBuffer<FSpotLightInfo> g_SpotLightList : register(t4);
@@ -84,6 +87,11 @@ cbuffer TileCullingBuffer : register(b11)
     uint TileCountX;        // 가로 타일 개수
     uint TileCountY;        // 세로 타일 개수
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
+
+    uint ClusterSliceCount; // 클러스터 깊이 슬라이스 수 (0 = 2D 타일)
+    float ClusterLogScale;  // slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterLogBias;
+    uint TileCullingPadding;
 };
 
 // b12: 섀도우 필터링 설정 상수 버퍼
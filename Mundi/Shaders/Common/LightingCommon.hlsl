@@ -36,6 +36,19 @@ uint GetTileDataOffset(uint tileIndex)
     return tileIndex * MaxLightsPerTile;
 }
 
+// 클러스터 깊이 슬라이스 (SV_POSITION.w = 뷰 공간 깊이)
+uint CalculateClusterSlice(float4 screenPos)
+{
+    float slice = floor(log(max(screenPos.w, 1e-4f)) * ClusterLogScale + ClusterLogBias);
+    return (uint)clamp(slice, 0.0f, float(max(ClusterSliceCount, 1u) - 1));
+}
+
+// 타일 라이트 목록의 항목(entryOffset)이 현재 슬라이스에 걸치는지 (2D 타일 모드면 항상 true)
+bool IsLightInClusterSlice(uint entryOffset, uint slice)
+{
+    return ClusterSliceCount == 0 || ((g_TileLightSliceMasks[entryOffset] >> slice) & 1u) != 0;
+}
+
 //================================================================================================
 // 기본 조명 계산 함수
 //================================================================================================
@@ -1262,9 +1275,13 @@ float3 CalculateAllLights(
         uint tileIndex = CalculateTileIndex(screenPos);
         uint tileDataOffset = GetTileDataOffset(tileIndex);
         uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterSlice = CalculateClusterSlice(screenPos);
 
         for (uint i = 0; i < lightCount; i++)
         {
+            if (!IsLightInClusterSlice(tileDataOffset + 1 + i, clusterSlice))
+                continue;
+
             uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
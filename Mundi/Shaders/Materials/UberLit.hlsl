@@ -311,10 +311,14 @@ PS_OUTPUT mainPS(PS_INPUT Input)
 
         // 타일에 영향을 주는 라이트 개수
         uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterSlice = CalculateClusterSlice(Input.Position);
 
-        // 타일 내 라이트만 순회
+        // 타일 내 라이트만 순회 (클러스터 모드면 현재 깊이 슬라이스에 걸치는 라이트만)
         for (uint i = 0; i < lightCount; i++)
         {
+            if (!IsLightInClusterSlice(tileDataOffset + 1 + i, clusterSlice))
+                continue;
+
             uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
@@ -413,10 +417,14 @@ PS_OUTPUT mainPS(PS_INPUT Input)
 
         // 타일에 영향을 주는 라이트 개수
         uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterSlice = CalculateClusterSlice(Input.Position);
 
-        // 타일 내 라이트만 순회
+        // 타일 내 라이트만 순회 (클러스터 모드면 현재 깊이 슬라이스에 걸치는 라이트만)
         for (uint i = 0; i < lightCount; i++)
         {
+            if (!IsLightInClusterSlice(tileDataOffset + 1 + i, clusterSlice))
+                continue;
+
             uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
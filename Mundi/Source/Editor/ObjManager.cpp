@@ -5,10 +5,14 @@
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
+#include "MemoryMappedReader.h"
 #include "WindowsBinWriter.h"
 #include <filesystem>
 #include <unordered_set>
+#include <chrono>
+#include <charconv>
+#include <cstring>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -89,6 +93,490 @@ namespace
 		// 옵션 플래그를 찾지 못한 경우
 		return InDefaultValue;
 	}
+
+	// ─────────────────────────────────────────────
+	// OBJ 버퍼 파서 (getline / stringstream 없이 매핑된 버퍼를 직접 스캔)
+	// ─────────────────────────────────────────────
+
+	// 이 크기 이상의 .obj는 줄 단위로 잘라 병렬 파싱 후 병합
+	constexpr int64 ObjParallelParseThreshold = 8 * 1024 * 1024;
+
+	// 청크 하나의 파싱 결과. 면 인덱스는 파일 전역 기준이므로 병합 시 이어붙이기만 하면 된다.
+	struct FObjParseChunk
+	{
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+
+		TArray<FString> MaterialNames;
+		TArray<uint32> GroupStarts;   // 청크 내부 VIndex 기준 (병합 시 앞 청크들의 VIndex를 더함)
+		uint32 VIndex = 0;
+
+		FString MtlFileName;           // 청크 내 마지막 mtllib (원본과 동일하게 마지막 선언이 우선)
+		bool bHasTexcoord = false;
+		bool bHasNormal = false;
+
+		uint32 UnknownLineCount = 0;
+		FString FirstUnknownLine;
+	};
+
+	inline bool IsObjSpace(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\r' || C == '\n' || C == '\v' || C == '\f';
+	}
+
+	inline const char* SkipObjSpaces(const char* P, const char* End)
+	{
+		while (P < End && IsObjSpace(*P)) ++P;
+		return P;
+	}
+
+	// 공백을 건너뛰고 float 하나를 읽는다. 실패 시 0 (stringstream >> float와 동일)
+	inline const char* ParseObjFloat(const char* P, const char* End, float& OutValue)
+	{
+		P = SkipObjSpaces(P, End);
+		if (P < End && *P == '+') ++P; // from_chars는 '+' 부호를 받지 않음
+
+		auto [Next, Error] = std::from_chars(P, End, OutValue);
+		if (Error != std::errc())
+		{
+			OutValue = 0.0f;
+			while (P < End && !IsObjSpace(*P)) ++P;
+			return P;
+		}
+		return Next;
+	}
+
+	// "12", "-3" 등 정수 하나를 읽는다. 부호 있는 값은 stringstream >> uint32와 같이 2의 보수로 감싼다.
+	inline bool ParseObjIndex(const char* P, const char* End, uint32& OutValue)
+	{
+		bool bNegative = false;
+		if (P < End && (*P == '-' || *P == '+'))
+		{
+			bNegative = (*P == '-');
+			++P;
+		}
+
+		uint32 Value = 0;
+		auto [Next, Error] = std::from_chars(P, End, Value);
+		if (Error != std::errc())
+		{
+			return false;
+		}
+		OutValue = bNegative ? (0u - Value) : Value;
+		return true;
+	}
+
+	// "v", "v/t", "v//n", "v/t/n" 하나를 해석 (빈 필드는 0, 1-based → 0-based)
+	inline void ParseObjFaceVertex(const char* P, const char* End, uint32& OutPos, uint32& OutTex, uint32& OutNormal)
+	{
+		uint32* Targets[3] = { &OutPos, &OutTex, &OutNormal };
+		OutPos = OutTex = OutNormal = 0;
+
+		for (int32 Field = 0; Field < 3 && P <= End; ++Field)
+		{
+			const char* FieldEnd = P;
+			while (FieldEnd < End && *FieldEnd != '/') ++FieldEnd;
+
+			uint32 Value;
+			if (FieldEnd > P && ParseObjIndex(P, FieldEnd, Value))
+			{
+				*Targets[Field] = Value - 1;
+			}
+
+			if (FieldEnd >= End) break;
+			P = FieldEnd + 1;
+		}
+	}
+
+	inline bool ObjLineStartsWith(const char* P, const char* End, const char* Prefix, size_t PrefixLength)
+	{
+		return static_cast<size_t>(End - P) >= PrefixLength && std::memcmp(P, Prefix, PrefixLength) == 0;
+	}
+
+	/**
+	 * [Begin, End) 범위의 줄들을 파싱한다. 범위는 반드시 줄 경계에서 시작/끝나야 한다.
+	 * 줄마다 힙 할당이 없도록 문자열 복사는 mtllib / usemtl / 알 수 없는 줄에서만 일어난다.
+	 */
+	void ParseObjRange(const char* Begin, const char* End, bool bIsRightHanded, const FString& ObjDir, FObjParseChunk& Out)
+	{
+		// 면 하나의 정점 (대부분 3~4개이므로 재사용 버퍼로 유지)
+		struct FFaceIndices { uint32 Pos, Tex, Normal; };
+		TArray<FFaceIndices> LineFaceVertices;
+		LineFaceVertices.Reserve(8);
+
+		const char* Cursor = Begin;
+		while (Cursor < End)
+		{
+			const char* LineEnd = static_cast<const char*>(std::memchr(Cursor, '\n', static_cast<size_t>(End - Cursor)));
+			if (!LineEnd) LineEnd = End;
+			const char* NextLine = (LineEnd < End) ? LineEnd + 1 : End;
+
+			// CRLF 파일: 텍스트 모드 getline과 같도록 줄 끝 '\r' 하나 제거
+			const char* LineStop = LineEnd;
+			if (LineStop > Cursor && LineStop[-1] == '\r') --LineStop;
+
+			const char* const LineBegin = Cursor;
+			const char* P = LineBegin;
+			Cursor = NextLine;
+
+			// 앞쪽 공백 제거
+			while (P < LineStop && (*P == ' ' || *P == '\t' || *P == '\r' || *P == '\n')) ++P;
+			if (P >= LineStop)
+			{
+				// 공백만 있는 줄은 이전 파서와 같이 알 수 없는 줄로 보고한다 (완전히 빈 줄만 조용히 건너뜀)
+				if (LineStop > LineBegin && Out.UnknownLineCount++ == 0)
+				{
+					Out.FirstUnknownLine.assign(LineBegin, LineStop);
+				}
+				continue;
+			}
+			if (*P == '#')
+				continue;
+
+			if (ObjLineStartsWith(P, LineStop, "v ", 2)) // 정점 좌표 (v x y z)
+			{
+				float X, Y, Z;
+				const char* Q = ParseObjFloat(P + 2, LineStop, X);
+				Q = ParseObjFloat(Q, LineStop, Y);
+				ParseObjFloat(Q, LineStop, Z);
+				Out.Positions.push_back(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+			}
+			else if (ObjLineStartsWith(P, LineStop, "vt ", 3)) // 텍스처 좌표 (vt u v)
+			{
+				float U, V;
+				const char* Q = ParseObjFloat(P + 3, LineStop, U);
+				ParseObjFloat(Q, LineStop, V);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+				Out.TexCoords.push_back(FVector2D(U, 1.0f - V));
+				Out.bHasTexcoord = true;
+			}
+			else if (ObjLineStartsWith(P, LineStop, "vn ", 3)) // 법선 (vn x y z)
+			{
+				float X, Y, Z;
+				const char* Q = ParseObjFloat(P + 3, LineStop, X);
+				Q = ParseObjFloat(Q, LineStop, Y);
+				ParseObjFloat(Q, LineStop, Z);
+				Out.Normals.push_back(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+				Out.bHasNormal = true;
+			}
+			else if (ObjLineStartsWith(P, LineStop, "g ", 2)) // 그룹 (g groupName)
+			{
+				// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+			}
+			else if (ObjLineStartsWith(P, LineStop, "f ", 2)) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+			{
+				LineFaceVertices.clear();
+
+				const char* Q = P + 2;
+				while (true)
+				{
+					Q = SkipObjSpaces(Q, LineStop);
+					if (Q >= LineStop || *Q == '#') // '#'을 만나면 주석 처리 (이후 데이터 무시)
+						break;
+
+					const char* TokenEnd = Q;
+					while (TokenEnd < LineStop && !IsObjSpace(*TokenEnd)) ++TokenEnd;
+
+					FFaceIndices Face;
+					ParseObjFaceVertex(Q, TokenEnd, Face.Pos, Face.Tex, Face.Normal);
+					LineFaceVertices.push_back(Face);
+					Q = TokenEnd;
+				}
+
+				// 4각형 이상의 폴리곤은 팬 분할
+				for (size_t i = 1; i + 1 < LineFaceVertices.size(); ++i)
+				{
+					const FFaceIndices& A = LineFaceVertices[0];
+					const FFaceIndices& B = bIsRightHanded ? LineFaceVertices[i + 1] : LineFaceVertices[i];
+					const FFaceIndices& C = bIsRightHanded ? LineFaceVertices[i] : LineFaceVertices[i + 1];
+
+					Out.PositionIndices.push_back(A.Pos);
+					Out.TexCoordIndices.push_back(A.Tex);
+					Out.NormalIndices.push_back(A.Normal);
+
+					Out.PositionIndices.push_back(B.Pos);
+					Out.TexCoordIndices.push_back(B.Tex);
+					Out.NormalIndices.push_back(B.Normal);
+
+					Out.PositionIndices.push_back(C.Pos);
+					Out.TexCoordIndices.push_back(C.Tex);
+					Out.NormalIndices.push_back(C.Normal);
+
+					Out.VIndex += 3;
+				}
+			}
+			else if (ObjLineStartsWith(P, LineStop, "mtllib ", 7))
+			{
+				Out.MtlFileName = ObjDir + FString(P + 7, LineStop);
+			}
+			else if (ObjLineStartsWith(P, LineStop, "usemtl ", 7))
+			{
+				Out.MaterialNames.push_back(FString(P + 7, LineStop));
+				Out.GroupStarts.push_back(Out.VIndex);
+			}
+			else
+			{
+				// 줄마다 로그를 남기면 's 1' 같은 줄이 많은 파일에서 파싱보다 로그가 느려지므로 개수만 센다
+				if (Out.UnknownLineCount++ == 0)
+				{
+					Out.FirstUnknownLine.assign(P, LineStop);
+				}
+			}
+		}
+	}
+
+	/**
+	 * .obj 지오메트리만 파싱한다 (mtl 제외). 파일을 매핑해 줄 경계 청크로 나눠 ParseObjRange로 파싱한 뒤 파일 순서대로 병합한다.
+	 * @param OutMtlFileName - 마지막 mtllib 경로 (obj 폴더 기준, 없으면 빈 문자열)
+	 * @param OutUnknownLineCount - 있으면 건너뛴 알 수 없는 줄 수를 기록 (벤치마크 비교용)
+	 * @return .obj 파일을 열지 못하면 false
+	 */
+	bool ParseObjGeometry(const FString& InFileName, FObjInfo* const OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded,
+		uint32* OutUnknownLineCount = nullptr)
+	{
+		uint32 subsetCount = 0;
+
+		bool bHasTexcoord = false;
+		bool bHasNormal = false;
+
+		uint32 VIndex = 0;
+		uint32 MeshTriangles = 0;
+
+		size_t pos = InFileName.find_last_of("/\\");
+		FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
+
+		// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
+		// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
+		// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
+		FMemoryMappedReader ObjFile(InFileName);
+		if (!ObjFile.IsOpen())
+		{
+			UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
+			return false;
+		}
+
+		OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
+
+		const char* Buffer = reinterpret_cast<const char*>(ObjFile.GetData());
+		const int64 BufferSize = ObjFile.GetSize();
+
+		// 큰 파일은 줄 경계에서 잘라 청크별로 병렬 파싱
+		int32 ChunkCount = 1;
+		if (BufferSize >= ObjParallelParseThreshold)
+		{
+			const int64 MaxChunks = BufferSize / (ObjParallelParseThreshold / 4);
+			ChunkCount = static_cast<int32>(std::clamp<int64>(std::thread::hardware_concurrency(), 1, std::max<int64>(MaxChunks, 1)));
+		}
+
+		TArray<const char*> ChunkBounds;
+		ChunkBounds.Reserve(ChunkCount + 1);
+		ChunkBounds.Add(Buffer);
+		for (int32 i = 1; i < ChunkCount; ++i)
+		{
+			const char* Split = Buffer + BufferSize * i / ChunkCount;
+			if (Split < ChunkBounds.back()) Split = ChunkBounds.back();
+
+			const char* LineEnd = static_cast<const char*>(std::memchr(Split, '\n', static_cast<size_t>(Buffer + BufferSize - Split)));
+			ChunkBounds.Add(LineEnd ? LineEnd + 1 : Buffer + BufferSize);
+		}
+		ChunkBounds.Add(Buffer + BufferSize);
+
+		TArray<FObjParseChunk> Chunks;
+		Chunks.SetNum(ChunkCount);
+		if (ChunkCount == 1)
+		{
+			ParseObjRange(ChunkBounds[0], ChunkBounds[1], bIsRightHanded, objDir, Chunks[0]);
+		}
+		else
+		{
+			concurrency::parallel_for(0, ChunkCount, [&](int32 i)
+			{
+				ParseObjRange(ChunkBounds[i], ChunkBounds[i + 1], bIsRightHanded, objDir, Chunks[i]);
+			});
+		}
+
+		// 청크 병합 (파일 순서 유지)
+		size_t TotalPositions = 0, TotalTexCoords = 0, TotalNormals = 0, TotalIndices = 0;
+		for (const FObjParseChunk& Chunk : Chunks)
+		{
+			TotalPositions += Chunk.Positions.size();
+			TotalTexCoords += Chunk.TexCoords.size();
+			TotalNormals += Chunk.Normals.size();
+			TotalIndices += Chunk.PositionIndices.size();
+		}
+		OutObjInfo->Positions.reserve(OutObjInfo->Positions.size() + TotalPositions);
+		OutObjInfo->TexCoords.reserve(OutObjInfo->TexCoords.size() + TotalTexCoords);
+		OutObjInfo->Normals.reserve(OutObjInfo->Normals.size() + TotalNormals);
+		OutObjInfo->PositionIndices.reserve(OutObjInfo->PositionIndices.size() + TotalIndices);
+		OutObjInfo->TexCoordIndices.reserve(OutObjInfo->TexCoordIndices.size() + TotalIndices);
+		OutObjInfo->NormalIndices.reserve(OutObjInfo->NormalIndices.size() + TotalIndices);
+
+		uint32 UnknownLineCount = 0;
+		FString FirstUnknownLine;
+		for (FObjParseChunk& Chunk : Chunks)
+		{
+			OutObjInfo->Positions.insert(OutObjInfo->Positions.end(), Chunk.Positions.begin(), Chunk.Positions.end());
+			OutObjInfo->TexCoords.insert(OutObjInfo->TexCoords.end(), Chunk.TexCoords.begin(), Chunk.TexCoords.end());
+			OutObjInfo->Normals.insert(OutObjInfo->Normals.end(), Chunk.Normals.begin(), Chunk.Normals.end());
+			OutObjInfo->PositionIndices.insert(OutObjInfo->PositionIndices.end(), Chunk.PositionIndices.begin(), Chunk.PositionIndices.end());
+			OutObjInfo->TexCoordIndices.insert(OutObjInfo->TexCoordIndices.end(), Chunk.TexCoordIndices.begin(), Chunk.TexCoordIndices.end());
+			OutObjInfo->NormalIndices.insert(OutObjInfo->NormalIndices.end(), Chunk.NormalIndices.begin(), Chunk.NormalIndices.end());
+
+			for (size_t i = 0; i < Chunk.MaterialNames.size(); ++i)
+			{
+				OutObjInfo->MaterialNames.push_back(std::move(Chunk.MaterialNames[i]));
+				OutObjInfo->GroupIndexStartArray.push_back(VIndex + Chunk.GroupStarts[i]);
+				subsetCount++;
+			}
+
+			if (!Chunk.MtlFileName.empty())
+			{
+				OutMtlFileName = Chunk.MtlFileName;
+			}
+
+			VIndex += Chunk.VIndex;
+			MeshTriangles += Chunk.VIndex / 3;
+			bHasTexcoord |= Chunk.bHasTexcoord;
+			bHasNormal |= Chunk.bHasNormal;
+
+			if (UnknownLineCount == 0 && Chunk.UnknownLineCount > 0)
+			{
+				FirstUnknownLine = Chunk.FirstUnknownLine;
+			}
+			UnknownLineCount += Chunk.UnknownLineCount;
+		}
+
+		if (UnknownLineCount > 0)
+		{
+			UE_LOG("While parsing the filename %s, %u lines with unknown symbols were skipped (first: \'%s\')", InFileName.c_str(), UnknownLineCount, FirstUnknownLine.c_str());
+		}
+		if (OutUnknownLineCount)
+		{
+			*OutUnknownLineCount = UnknownLineCount;
+		}
+
+		if (subsetCount == 0)
+		{
+			OutObjInfo->GroupIndexStartArray.push_back(0);
+			subsetCount++;
+		}
+		OutObjInfo->GroupIndexStartArray.push_back(VIndex);
+
+		if (OutObjInfo->GroupIndexStartArray.size() > 1 && OutObjInfo->GroupIndexStartArray[1] == 0)
+		{
+			OutObjInfo->GroupIndexStartArray.erase(OutObjInfo->GroupIndexStartArray.begin() + 1);
+			subsetCount--;
+		}
+
+		if (!bHasNormal)
+		{
+			OutObjInfo->Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+		}
+		if (!bHasTexcoord)
+		{
+			OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
+		}
+
+		ObjFile.Close();
+
+		return true;
+	}
+
+	// ─────────────────────────────────────────────
+	// FObjInfo -> FStaticMesh 변환 보조
+	// ─────────────────────────────────────────────
+
+	// 고유 정점이 이보다 많으면 정점 생성을 병렬로 수행
+	constexpr uint32 ObjParallelVertexThreshold = 4096;
+
+	/**
+	 * (위치, UV, 법선) 인덱스 -> 고유 정점 번호 open-addressing 해시 테이블 (선형 탐사)
+	 * 최대 키 개수로 용량을 미리 잡아 재해시/노드 할당이 없다.
+	 */
+	class FObjVertexWeldTable
+	{
+	public:
+		explicit FObjVertexWeldTable(uint32 MaxKeys)
+		{
+			// 적재율 2/3 이하 유지
+			uint64 Capacity = 16;
+			while (Capacity * 2 < static_cast<uint64>(MaxKeys) * 3)
+			{
+				Capacity <<= 1;
+			}
+			Slots.assign(static_cast<size_t>(Capacity), FSlot{ 0, 0, 0, EmptySlot });
+			Mask = Capacity - 1;
+		}
+
+		// 이미 있으면 기존 번호를, 없으면 NewIndex를 등록하고 그대로 반환
+		uint32 FindOrAdd(const FObjImporter::VertexKey& Key, uint32 NewIndex)
+		{
+			uint64 Slot = Hash(Key) & Mask;
+			while (true)
+			{
+				FSlot& Entry = Slots[static_cast<size_t>(Slot)];
+				if (Entry.VertexIndex == EmptySlot)
+				{
+					Entry = FSlot{ Key.PosIndex, Key.TexIndex, Key.NormalIndex, NewIndex };
+					return NewIndex;
+				}
+				if (Entry.PosIndex == Key.PosIndex && Entry.TexIndex == Key.TexIndex && Entry.NormalIndex == Key.NormalIndex)
+				{
+					return Entry.VertexIndex;
+				}
+				Slot = (Slot + 1) & Mask;
+			}
+		}
+
+	private:
+		struct FSlot
+		{
+			uint32 PosIndex, TexIndex, NormalIndex;
+			uint32 VertexIndex;
+		};
+
+		static constexpr uint32 EmptySlot = UINT32_MAX;
+
+		static uint64 Hash(const FObjImporter::VertexKey& Key)
+		{
+			uint64 H = ((static_cast<uint64>(Key.PosIndex) << 32) | Key.TexIndex) * 0x9E3779B97F4A7C15ull;
+			H ^= (static_cast<uint64>(Key.NormalIndex) + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+			return H ^ (H >> 29);
+		}
+
+		TArray<FSlot> Slots;
+		uint64 Mask = 0;
+	};
+
+	// 삼각형 [TriangleStart, TriangleStart + 2]의 UV 기반 탄젠트/바이탄젠트
+	void ComputeObjTriangleTangent(const FObjInfo& InObjInfo, uint32 TriangleStart, FVector& OutTangent, FVector& OutBiTangent)
+	{
+		FVector P0 = InObjInfo.Positions[InObjInfo.PositionIndices[TriangleStart]];
+		FVector P1 = InObjInfo.Positions[InObjInfo.PositionIndices[TriangleStart + 1]];
+		FVector P2 = InObjInfo.Positions[InObjInfo.PositionIndices[TriangleStart + 2]];
+
+		FVector E1 = P1 - P0;
+		FVector E2 = P2 - P0;
+
+		FVector2D UvP0 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[TriangleStart]];
+		FVector2D UvP1 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[TriangleStart + 1]];
+		FVector2D UvP2 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[TriangleStart + 2]];
+
+		float DeltaU1 = UvP1.X - UvP0.X;
+		float DeltaV1 = UvP1.Y - UvP0.Y;
+		float DeltaU2 = UvP2.X - UvP0.X;
+		float DeltaV2 = UvP2.Y - UvP0.Y;
+
+		float DeterminantInv = 1.0f / (DeltaU1 * DeltaV2 - DeltaV1 * DeltaU2);
+
+		OutTangent = (E1 * DeltaV2 - E2 * DeltaV1) * DeterminantInv;
+		OutBiTangent = (-E1 * DeltaU2 + E2 * DeltaU1) * DeterminantInv;
+	}
 }
 
 /**
@@ -216,8 +704,16 @@ bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const
 	return false;
 }
 
+/**
+ * @brief Data 디렉토리의 모든 .obj를 미리 로드합니다.
+ * 캐시 검증 / 캐시 디코드 / OBJ 파싱 / 캐시 기록은 워커 풀에서 병렬로,
+ * 머티리얼 UObject와 GPU 리소스 생성 및 RESOURCE 등록만 메인 스레드에서 순차로 수행합니다.
+ */
 void FObjManager::Preload()
 {
+	using Clock = std::chrono::high_resolution_clock;
+	auto ElapsedMS = [](Clock::time_point Start) { return std::chrono::duration<double, std::milli>(Clock::now() - Start).count(); };
+
 	const fs::path DataDir(GDataDir);
 
 	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
@@ -226,7 +722,10 @@ void FObjManager::Preload()
 		return;
 	}
 
-	size_t LoadedCount = 0;
+	// 1) 파일 탐색 (메인 스레드)
+	auto StageStart = Clock::now();
+	TArray<FString> ObjPaths;
+	TArray<FString> TexturePaths;
 	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
 
 	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
@@ -246,20 +745,65 @@ void FObjManager::Preload()
 			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
 			{
 				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
+				ObjPaths.Add(PathStr);
 			}
 		}
 		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
 		{
-			UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
+			TexturePaths.Add(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
 		}
 	}
+	const double DiscoveryMS = ElapsedMS(StageStart);
+
+	// 2) 캐시 검증 + 캐시 디코드 또는 파싱/탄젠트 생성/캐시 기록 (워커 풀)
+	StageStart = Clock::now();
+	struct FDecodedObj
+	{
+		FStaticMesh* StaticMesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+	};
+	TArray<FDecodedObj> Decoded;
+	Decoded.SetNum(ObjPaths.Num());
+
+	concurrency::parallel_for(0, static_cast<int32>(ObjPaths.Num()), [&](int32 Index)
+	{
+		// 이 단계에서는 맵에 쓰지 않으므로 동시 조회만 발생
+		if (!ObjStaticMeshMap.Contains(ObjPaths[Index]))
+		{
+			Decoded[Index].StaticMesh = DecodeObjStaticMeshAsset(ObjPaths[Index], Decoded[Index].MaterialInfos);
+		}
+	});
+	const double DecodeMS = ElapsedMS(StageStart);
+
+	// 3) 머티리얼 UObject + UStaticMesh / GPU 버퍼 생성 (메인 스레드)
+	StageStart = Clock::now();
+	size_t LoadedCount = 0;
+	for (int32 Index = 0; Index < ObjPaths.Num(); ++Index)
+	{
+		if (Decoded[Index].StaticMesh)
+		{
+			RegisterObjStaticMeshAsset(ObjPaths[Index], Decoded[Index].StaticMesh, Decoded[Index].MaterialInfos);
+		}
+		LoadObjStaticMesh(ObjPaths[Index]);
+		++LoadedCount;
+	}
+	const double MeshMS = ElapsedMS(StageStart);
+
+	StageStart = Clock::now();
+	for (const FString& TexturePath : TexturePaths)
+	{
+		UResourceManager::GetInstance().Load<UTexture>(TexturePath);
+	}
+	const double TextureMS = ElapsedMS(StageStart);
 
 	// 4) 모든 StaticMeshs 가져오기
+	StageStart = Clock::now();
 	RESOURCE.SetStaticMeshs();
+	const double RegisterMS = ElapsedMS(StageStart);
 
 	UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, DataDir.string().c_str());
+	UE_LOG("FObjManager::Preload: discovery %.2f ms | decode/parse (parallel) %.2f ms | material + GPU %.2f ms | textures %.2f ms | register %.2f ms",
+		DiscoveryMS, DecodeMS, MeshMS, TextureMS, RegisterMS);
 }
 
 void FObjManager::Clear()
@@ -283,6 +827,20 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = DecodeObjStaticMeshAsset(NormalizedPathStr, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	return RegisterObjStaticMeshAsset(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
+
+// 캐시 검증 → 캐시 읽기 또는 파싱/캐시 기록 → 텍스처 경로 정리까지 수행한다.
+// UObject / 메모리 캐시 맵을 건드리지 않으므로 Preload 워커 스레드에서 호출할 수 있다.
+FStaticMesh* FObjManager::DecodeObjStaticMeshAsset(const FString& NormalizedPathStr, TArray<FMaterialInfo>& MaterialInfos)
+{
 	std::filesystem::path Path(NormalizedPathStr);
 
 	// 2. 파일 경로 설정
@@ -312,7 +870,6 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 
 	// 캐시가 오래되었는지 먼저 확인
@@ -324,7 +881,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		try
 		{
 			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
+			FMemoryMappedReader Reader(BinPathFileName);
 			if (!Reader.IsOpen())
 			{
 				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
@@ -334,7 +891,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			Reader.Close();
 
 			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
+			FMemoryMappedReader MatReader(MatBinPathFileName);
 			if (!MatReader.IsOpen())
 			{
 				throw std::runtime_error("Failed to open material bin file for reading.");
@@ -366,7 +923,6 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -429,17 +985,21 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	else
 	{
 		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
-		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		// 구버전 캐시(기본 머티리얼이 없거나 요소별 직렬화 포맷)일 수 있으므로, 동일한 검사를 수행합니다.
+		const bool bMaterialChanged = EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+		const bool bLegacyFormat = NewFStaticMesh->LoadedCacheVersion != Serialization::MeshCacheVersion;
+		if (bMaterialChanged || bLegacyFormat)
 		{
 #ifdef USE_OBJ_CACHE
 			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
+			UE_LOG("Updating outdated cache for '%s' (default material: %d, format v%u -> v%u).", NormalizedPathStr.c_str(),
+				bMaterialChanged, NewFStaticMesh->LoadedCacheVersion, Serialization::MeshCacheVersion);
 			try
 			{
 				FWindowsBinWriter Writer(BinPathFileName);
 				Writer << *NewFStaticMesh;
 				Writer.Close();
+				NewFStaticMesh->LoadedCacheVersion = Serialization::MeshCacheVersion;
 				FWindowsBinWriter MatWriter(MatBinPathFileName);
 				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
 				MatWriter.Close();
@@ -485,6 +1045,12 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			ResolveAssetRelativePath(MaterialInfo.EmissiveTextureFileName, ObjBaseDir);
 	}
 
+	return NewFStaticMesh;
+}
+
+// 머티리얼 UObject 생성 및 메모리 캐시 등록 (메인 스레드 전용)
+FStaticMesh* FObjManager::RegisterObjStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, const TArray<FMaterialInfo>& MaterialInfos)
+{
 	// 루프가 시작되기 전에 기본 UberLit 셰이더 포인터를 한 번만 가져옵니다.
 	UShader* DefaultUberlitShader = nullptr;
 	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
@@ -548,187 +1114,12 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
 	FString MtlFileName;
-
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
-	size_t pos = InFileName.find_last_of("/\\");
-	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
-
-	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
-	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	if (!ParseObjGeometry(InFileName, OutObjInfo, MtlFileName, bIsRightHanded))
 	{
-		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
 	}
 
-	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
-
-	FString line;
-	while (std::getline(FileIn, line))
-	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
-	}
-
-	if (subsetCount == 0)
-	{
-		OutObjInfo->GroupIndexStartArray.push_back(0);
-		subsetCount++;
-	}
-	OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-
-	if (OutObjInfo->GroupIndexStartArray.size() > 1 && OutObjInfo->GroupIndexStartArray[1] == 0)
-	{
-		OutObjInfo->GroupIndexStartArray.erase(OutObjInfo->GroupIndexStartArray.begin() + 1);
-		subsetCount--;
-	}
-
-	if (!bHasNormal)
-	{
-		OutObjInfo->Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
-	}
-	if (!bHasTexcoord)
-	{
-		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
-	}
-
-	FileIn.close();
-
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
 
@@ -741,7 +1132,8 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
+	std::ifstream FileIn(WMtlPath);
+	FString line;
 
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
@@ -856,76 +1248,76 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh)
 {
 	OutStaticMesh->PathFileName = InObjInfo.ObjFileName;
-	uint32 NumDuplicatedVertex = static_cast<uint32>(InObjInfo.PositionIndices.size());
-	TArray<FVector> TangentForVertex;
-	TArray<FVector> BiTangentForVertex;
-	TangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
-	BiTangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
-
-	for (uint32 Index = 0; Index < NumDuplicatedVertex; Index += 3)
-	{
-		FVector P0 = InObjInfo.Positions[InObjInfo.PositionIndices[Index]];
-		FVector P1 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 1]];
-		FVector P2 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 2]];
-
-		FVector E1 = P1 - P0;
-		FVector E2 = P2 - P0;
+	const uint32 NumDuplicatedVertex = static_cast<uint32>(InObjInfo.PositionIndices.size());
 
-		FVector2D UvP0 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index]];
-		FVector2D UvP1 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 1]];
-		FVector2D UvP2 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 2]];
-
-		float DeltaU1 = UvP1.X - UvP0.X;
-		float DeltaV1 = UvP1.Y - UvP0.Y;
-		float DeltaU2 = UvP2.X - UvP0.X;
-		float DeltaV2 = UvP2.Y - UvP0.Y;
-
-		float DeterminantInv = 1.0f / (DeltaU1 * DeltaV2 - DeltaV1 * DeltaU2);
-
-		FVector Tangent = (E1 * DeltaV2 - E2 * DeltaV1) * DeterminantInv;
-		FVector BiTangent = (-E1 * DeltaU2 + E2 * DeltaU1) * DeterminantInv;
-
-		TangentForVertex[Index] += Tangent;
-		TangentForVertex[Index + 1] += Tangent;
-		TangentForVertex[Index + 2] += Tangent;
-
-		BiTangentForVertex[Index] += BiTangent;
-		BiTangentForVertex[Index + 1] += BiTangent;
-		BiTangentForVertex[Index + 2] += BiTangent;
-	}
-
-	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	// 1) 정점 용접: (위치, UV, 법선) 인덱스 조합의 첫 등장 순서대로 고유 정점 번호를 매긴다.
+	//    번호 순서가 결과 정점 배열 순서를 결정하므로 이 단계는 순차로 수행한다.
+	FObjVertexWeldTable WeldTable(NumDuplicatedVertex);
+	TArray<uint32> FirstFaceVertex; // 고유 정점 -> 처음 등장한 face-vertex 인덱스
+	FirstFaceVertex.reserve(NumDuplicatedVertex / 2);
 
+	const uint32 BaseVertex = static_cast<uint32>(OutStaticMesh->Vertices.size());
+	OutStaticMesh->Indices.reserve(OutStaticMesh->Indices.size() + NumDuplicatedVertex);
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
 		VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
-		auto It = VertexMap.find(Key);
-		if (It != VertexMap.end())
+		const uint32 NewIndex = static_cast<uint32>(FirstFaceVertex.size());
+		const uint32 UniqueIndex = WeldTable.FindOrAdd(Key, NewIndex);
+		if (UniqueIndex == NewIndex)
 		{
-			OutStaticMesh->Indices.push_back(It->second);
+			FirstFaceVertex.push_back(CurIndex);
 		}
-		else
-		{
-			FVector Tangent = TangentForVertex[CurIndex];
-			FVector Normal = InObjInfo.Normals[Key.NormalIndex];
-			FVector BiTangent = BiTangentForVertex[CurIndex];
+		OutStaticMesh->Indices.push_back(BaseVertex + UniqueIndex);
+	}
 
-			Tangent = Tangent - Normal * FVector::Dot(Tangent, Normal);
-			Tangent.Normalize();
-			FVector4 FinalTangent(Tangent.X, Tangent.Y, Tangent.Z);
-			FinalTangent.W = FVector::Dot(FVector::Cross(Tangent, Normal), BiTangent) > 0.0f ? 1.0f : -1.0f;
+	// 2) 고유 정점 생성 (병렬)
+	//    탄젠트는 face-vertex마다 자기 삼각형 하나의 값만 누적되므로, 고유 정점이 처음 등장한 삼각형에서만 계산하면 된다.
+	const uint32 NumUniqueVertex = static_cast<uint32>(FirstFaceVertex.size());
+	OutStaticMesh->Vertices.resize(BaseVertex + NumUniqueVertex);
+
+	auto BuildVertex = [&](uint32 UniqueIndex)
+	{
+		const uint32 FaceVertex = FirstFaceVertex[UniqueIndex];
+		const uint32 TriangleStart = FaceVertex - FaceVertex % 3;
 
-			FNormalVertex NormalVertex(
-				InObjInfo.Positions[Key.PosIndex],
-				Normal,
-				InObjInfo.TexCoords[Key.TexIndex],
-				FinalTangent,
-				FVector4(1, 1, 1, 1)
-			);
-			OutStaticMesh->Vertices.push_back(NormalVertex);
-			uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
-			OutStaticMesh->Indices.push_back(NewIndex);
-			VertexMap[Key] = NewIndex;
+		FVector Tangent(0.f, 0.f, 0.f);
+		FVector BiTangent(0.f, 0.f, 0.f);
+		if (TriangleStart + 2 < NumDuplicatedVertex)
+		{
+			// 0 벡터에 누적하던 기존 결과와 비트 단위로 같도록 (-0 -> +0 포함) 더해서 사용
+			FVector TriangleTangent, TriangleBiTangent;
+			ComputeObjTriangleTangent(InObjInfo, TriangleStart, TriangleTangent, TriangleBiTangent);
+			Tangent += TriangleTangent;
+			BiTangent += TriangleBiTangent;
+		}
+
+		const uint32 PosIndex = InObjInfo.PositionIndices[FaceVertex];
+		const uint32 TexIndex = InObjInfo.TexCoordIndices[FaceVertex];
+		const FVector Normal = InObjInfo.Normals[InObjInfo.NormalIndices[FaceVertex]];
+
+		Tangent = Tangent - Normal * FVector::Dot(Tangent, Normal);
+		Tangent.Normalize();
+		FVector4 FinalTangent(Tangent.X, Tangent.Y, Tangent.Z);
+		FinalTangent.W = FVector::Dot(FVector::Cross(Tangent, Normal), BiTangent) > 0.0f ? 1.0f : -1.0f;
+
+		OutStaticMesh->Vertices[BaseVertex + UniqueIndex] = FNormalVertex(
+			InObjInfo.Positions[PosIndex],
+			Normal,
+			InObjInfo.TexCoords[TexIndex],
+			FinalTangent,
+			FVector4(1, 1, 1, 1)
+		);
+	};
+
+	if (NumUniqueVertex >= ObjParallelVertexThreshold)
+	{
+		concurrency::parallel_for(0u, NumUniqueVertex, BuildVertex);
+	}
+	else
+	{
+		for (uint32 UniqueIndex = 0; UniqueIndex < NumUniqueVertex; ++UniqueIndex)
+		{
+			BuildVertex(UniqueIndex);
 		}
 	}
 
@@ -963,16 +1355,413 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 	}
 }
 
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
+namespace
 {
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
+	// 벤치마크 기준: 개방 주소법/병렬화 이전의 ConvertToStaticMesh 그대로
+	// (face-vertex마다 탄젠트 누적 + 노드 기반 unordered_map 용접)
+	struct FReferenceVertexKeyHash
+	{
+		size_t operator()(const FObjImporter::VertexKey& Key) const
+		{
+			return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2);
+		}
+	};
+
+	void ConvertToStaticMeshReference(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh)
+	{
+		OutStaticMesh->PathFileName = InObjInfo.ObjFileName;
+		uint32 NumDuplicatedVertex = static_cast<uint32>(InObjInfo.PositionIndices.size());
+		TArray<FVector> TangentForVertex;
+		TArray<FVector> BiTangentForVertex;
+		TangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
+		BiTangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
+
+		for (uint32 Index = 0; Index < NumDuplicatedVertex; Index += 3)
+		{
+			FVector P0 = InObjInfo.Positions[InObjInfo.PositionIndices[Index]];
+			FVector P1 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 1]];
+			FVector P2 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 2]];
+
+			FVector E1 = P1 - P0;
+			FVector E2 = P2 - P0;
+
+			FVector2D UvP0 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index]];
+			FVector2D UvP1 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 1]];
+			FVector2D UvP2 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 2]];
+
+			float DeltaU1 = UvP1.X - UvP0.X;
+			float DeltaV1 = UvP1.Y - UvP0.Y;
+			float DeltaU2 = UvP2.X - UvP0.X;
+			float DeltaV2 = UvP2.Y - UvP0.Y;
 
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
+			float DeterminantInv = 1.0f / (DeltaU1 * DeltaV2 - DeltaV1 * DeltaU2);
 
-	return Result;
+			FVector Tangent = (E1 * DeltaV2 - E2 * DeltaV1) * DeterminantInv;
+			FVector BiTangent = (-E1 * DeltaU2 + E2 * DeltaU1) * DeterminantInv;
+
+			TangentForVertex[Index] += Tangent;
+			TangentForVertex[Index + 1] += Tangent;
+			TangentForVertex[Index + 2] += Tangent;
+
+			BiTangentForVertex[Index] += BiTangent;
+			BiTangentForVertex[Index + 1] += BiTangent;
+			BiTangentForVertex[Index + 2] += BiTangent;
+		}
+
+		std::unordered_map<FObjImporter::VertexKey, uint32, FReferenceVertexKeyHash> VertexMap;
+
+		for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
+		{
+			FObjImporter::VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
+			auto It = VertexMap.find(Key);
+			if (It != VertexMap.end())
+			{
+				OutStaticMesh->Indices.push_back(It->second);
+			}
+			else
+			{
+				FVector Tangent = TangentForVertex[CurIndex];
+				FVector Normal = InObjInfo.Normals[Key.NormalIndex];
+				FVector BiTangent = BiTangentForVertex[CurIndex];
+
+				Tangent = Tangent - Normal * FVector::Dot(Tangent, Normal);
+				Tangent.Normalize();
+				FVector4 FinalTangent(Tangent.X, Tangent.Y, Tangent.Z);
+				FinalTangent.W = FVector::Dot(FVector::Cross(Tangent, Normal), BiTangent) > 0.0f ? 1.0f : -1.0f;
+
+				FNormalVertex NormalVertex(
+					InObjInfo.Positions[Key.PosIndex],
+					Normal,
+					InObjInfo.TexCoords[Key.TexIndex],
+					FinalTangent,
+					FVector4(1, 1, 1, 1)
+				);
+				OutStaticMesh->Vertices.push_back(NormalVertex);
+				uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
+				OutStaticMesh->Indices.push_back(NewIndex);
+				VertexMap[Key] = NewIndex;
+			}
+		}
+
+		OutStaticMesh->bHasMaterial = true;
+
+		uint32 NumGroup = (InObjInfo.GroupIndexStartArray.size() > 0) ? static_cast<uint32>(InObjInfo.GroupIndexStartArray.size() - 1) : 0;
+		if (NumGroup == 0)
+		{
+			return;
+		}
+
+		OutStaticMesh->GroupInfos.resize(NumGroup);
+		for (uint32 i = 0; i < NumGroup; ++i)
+		{
+			OutStaticMesh->GroupInfos[i].StartIndex = InObjInfo.GroupIndexStartArray[i];
+			OutStaticMesh->GroupInfos[i].IndexCount = InObjInfo.GroupIndexStartArray[i + 1] - InObjInfo.GroupIndexStartArray[i];
+			if (i < InObjInfo.GroupMaterialArray.size())
+			{
+				uint32 matIndex = InObjInfo.GroupMaterialArray[i];
+				if (matIndex < InMaterialInfos.size())
+				{
+					OutStaticMesh->GroupInfos[i].InitialMaterialName = InMaterialInfos[matIndex].MaterialName;
+				}
+			}
+		}
+	}
+
+	// 벤치마크 기준: 버퍼 파서 이전의 getline + stringstream 지오메트리 파싱 그대로
+	// (알 수 없는 줄은 줄마다 로그 대신 개수만 세고, 정점이 없는 'f' 줄의 팬 분할 언더플로만 막았다)
+	bool ParseObjGeometryReference(const FString& InFileName, FObjInfo* const OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded,
+		uint32& OutUnknownLineCount)
+	{
+		struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
+		auto ParseVertexDef = [](const FString& InVertexDef)
+		{
+			FFaceVertex Result{ 0, 0, 0 };
+			std::stringstream ss(InVertexDef);
+			FString part;
+			uint32 temp_val;
+
+			if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
+			if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
+			if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
+
+			return Result;
+		};
+
+		uint32 subsetCount = 0;
+		bool bHasTexcoord = false;
+		bool bHasNormal = false;
+		uint32 VIndex = 0;
+		OutUnknownLineCount = 0;
+
+		size_t pos = InFileName.find_last_of("/\\");
+		FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
+
+		std::ifstream FileIn(UTF8ToWide(InFileName));
+		if (!FileIn)
+		{
+			return false;
+		}
+
+		OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
+
+		FString line;
+		while (std::getline(FileIn, line))
+		{
+			if (line.empty()) continue;
+
+			line.erase(0, line.find_first_not_of(" \t\n\r"));
+
+			if (line[0] == '#')
+				continue;
+
+			if (line.rfind("v ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				float vx, vy, vz;
+				wss >> vx >> vy >> vz;
+				OutObjInfo->Positions.push_back(bIsRightHanded ? FVector(vx, -vy, vz) : FVector(vx, vy, vz));
+			}
+			else if (line.rfind("vt ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float u, v;
+				wss >> u >> v;
+				OutObjInfo->TexCoords.push_back(FVector2D(u, 1.0f - v));
+				bHasTexcoord = true;
+			}
+			else if (line.rfind("vn ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float nx, ny, nz;
+				wss >> nx >> ny >> nz;
+				OutObjInfo->Normals.push_back(bIsRightHanded ? FVector(nx, -ny, nz) : FVector(nx, ny, nz));
+				bHasNormal = true;
+			}
+			else if (line.rfind("g ", 0) == 0)
+			{
+			}
+			else if (line.rfind("f ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				FString VertexDef;
+
+				TArray<FFaceVertex> LineFaceVertices;
+				while (wss >> VertexDef)
+				{
+					if (VertexDef[0] == '#')
+					{
+						break;
+					}
+					LineFaceVertices.push_back(ParseVertexDef(VertexDef));
+				}
+
+				for (size_t i = 1; i + 1 < LineFaceVertices.size(); ++i)
+				{
+					const FFaceVertex& A = LineFaceVertices[0];
+					const FFaceVertex& B = bIsRightHanded ? LineFaceVertices[i + 1] : LineFaceVertices[i];
+					const FFaceVertex& C = bIsRightHanded ? LineFaceVertices[i] : LineFaceVertices[i + 1];
+					for (const FFaceVertex* Vertex : { &A, &B, &C })
+					{
+						OutObjInfo->PositionIndices.push_back(Vertex->PositionIndex);
+						OutObjInfo->TexCoordIndices.push_back(Vertex->TexCoordIndex);
+						OutObjInfo->NormalIndices.push_back(Vertex->NormalIndex);
+					}
+					VIndex += 3;
+				}
+			}
+			else if (line.rfind("mtllib ", 0) == 0)
+			{
+				OutMtlFileName = objDir + line.substr(7);
+			}
+			else if (line.rfind("usemtl ", 0) == 0)
+			{
+				OutObjInfo->MaterialNames.push_back(line.substr(7));
+				OutObjInfo->GroupIndexStartArray.push_back(VIndex);
+				subsetCount++;
+			}
+			else
+			{
+				++OutUnknownLineCount;
+			}
+		}
+
+		if (subsetCount == 0)
+		{
+			OutObjInfo->GroupIndexStartArray.push_back(0);
+			subsetCount++;
+		}
+		OutObjInfo->GroupIndexStartArray.push_back(VIndex);
+
+		if (OutObjInfo->GroupIndexStartArray.size() > 1 && OutObjInfo->GroupIndexStartArray[1] == 0)
+		{
+			OutObjInfo->GroupIndexStartArray.erase(OutObjInfo->GroupIndexStartArray.begin() + 1);
+			subsetCount--;
+		}
+
+		if (!bHasNormal)
+		{
+			OutObjInfo->Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+		}
+		if (!bHasTexcoord)
+		{
+			OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
+		}
+		return true;
+	}
+}
+
+void FObjImporter::BenchmarkConvertToStaticMesh(uint32 FaceVertexCount, double& OutConvertMS, double& OutReferenceMS,
+	uint32& OutVertexCount, bool& bOutMatchesReference)
+{
+	// Side x Side 정점 격자, 사각형마다 삼각형 2개 (face-vertex 6개)
+	const uint32 QuadCount = std::max(FaceVertexCount / 6, 1u);
+	const uint32 QuadsPerRow = static_cast<uint32>(std::ceil(std::sqrt(static_cast<double>(QuadCount))));
+	const uint32 Side = QuadsPerRow + 1;
+
+	FObjInfo ObjInfo;
+	ObjInfo.ObjFileName = "BenchmarkGrid.obj";
+	ObjInfo.Positions.reserve(Side * Side);
+	ObjInfo.TexCoords.reserve(Side * Side);
+	for (uint32 Y = 0; Y < Side; ++Y)
+	{
+		for (uint32 X = 0; X < Side; ++X)
+		{
+			const float U = static_cast<float>(X) / QuadsPerRow;
+			const float V = static_cast<float>(Y) / QuadsPerRow;
+			ObjInfo.Positions.push_back(FVector(U * 100.0f, V * 100.0f, std::sin(U * 20.0f) * std::cos(V * 20.0f)));
+			ObjInfo.TexCoords.push_back(FVector2D(U, V));
+		}
+	}
+	// 법선 두 개를 사각형마다 번갈아 써서 같은 위치/UV라도 법선이 다르면 별도 정점이 되는 경로까지 포함
+	ObjInfo.Normals.push_back(FVector(0.0f, 0.0f, 1.0f));
+	ObjInfo.Normals.push_back(FVector(0.0f, 0.6f, 0.8f));
+
+	ObjInfo.PositionIndices.reserve(QuadCount * 6);
+	for (uint32 Quad = 0; Quad < QuadCount; ++Quad)
+	{
+		const uint32 X = Quad % QuadsPerRow;
+		const uint32 Y = Quad / QuadsPerRow;
+		const uint32 I0 = Y * Side + X;
+		const uint32 I1 = I0 + 1;
+		const uint32 I2 = I0 + Side;
+		const uint32 I3 = I2 + 1;
+		for (uint32 Index : { I0, I2, I1, I1, I2, I3 })
+		{
+			ObjInfo.PositionIndices.push_back(Index);
+		}
+	}
+	ObjInfo.TexCoordIndices = ObjInfo.PositionIndices;
+	ObjInfo.NormalIndices.resize(ObjInfo.PositionIndices.size());
+	for (size_t i = 0; i < ObjInfo.NormalIndices.size(); ++i)
+	{
+		ObjInfo.NormalIndices[i] = static_cast<uint32>((i / 6) & 1);
+	}
+
+	// 그룹 두 개 (앞 절반 / 뒤 절반), 머티리얼 두 개
+	const uint32 TotalIndexCount = static_cast<uint32>(ObjInfo.PositionIndices.size());
+	const uint32 SplitIndex = (TotalIndexCount / 6 / 2) * 6;
+	ObjInfo.GroupIndexStartArray = { 0, SplitIndex, TotalIndexCount };
+	ObjInfo.GroupMaterialArray = { 0, 1 };
+
+	TArray<FMaterialInfo> MaterialInfos(2);
+	MaterialInfos[0].MaterialName = "BenchmarkMaterialA";
+	MaterialInfos[1].MaterialName = "BenchmarkMaterialB";
+
+	FStaticMesh StaticMesh;
+	const auto ConvertStart = std::chrono::high_resolution_clock::now();
+	ConvertToStaticMesh(ObjInfo, MaterialInfos, &StaticMesh);
+	OutConvertMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - ConvertStart).count();
+	OutVertexCount = static_cast<uint32>(StaticMesh.Vertices.size());
+
+	// 기준: 이전 구현 전체로 같은 입력을 변환
+	FStaticMesh ReferenceMesh;
+	const auto ReferenceStart = std::chrono::high_resolution_clock::now();
+	ConvertToStaticMeshReference(ObjInfo, MaterialInfos, &ReferenceMesh);
+	OutReferenceMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - ReferenceStart).count();
+
+	// 바이트 단위 비교: 정점(memcmp), 인덱스, 그룹 정보
+	const bool bVerticesMatch = StaticMesh.Vertices.size() == ReferenceMesh.Vertices.size()
+		&& (StaticMesh.Vertices.empty()
+			|| std::memcmp(StaticMesh.Vertices.data(), ReferenceMesh.Vertices.data(), StaticMesh.Vertices.size() * sizeof(FNormalVertex)) == 0);
+	const bool bIndicesMatch = StaticMesh.Indices == ReferenceMesh.Indices;
+	bool bGroupsMatch = StaticMesh.GroupInfos.size() == ReferenceMesh.GroupInfos.size();
+	for (size_t i = 0; bGroupsMatch && i < StaticMesh.GroupInfos.size(); ++i)
+	{
+		const FGroupInfo& Group = StaticMesh.GroupInfos[i];
+		const FGroupInfo& ReferenceGroup = ReferenceMesh.GroupInfos[i];
+		bGroupsMatch = Group.StartIndex == ReferenceGroup.StartIndex
+			&& Group.IndexCount == ReferenceGroup.IndexCount
+			&& Group.InitialMaterialName == ReferenceGroup.InitialMaterialName;
+	}
+
+	bOutMatchesReference = bVerticesMatch && bIndicesMatch && bGroupsMatch
+		&& StaticMesh.bHasMaterial == ReferenceMesh.bHasMaterial;
+}
+
+bool FObjImporter::BenchmarkParseObj(const FString& InFileName, double& OutParseMS, double& OutReferenceMS,
+	uint32& OutPositionCount, uint32& OutIndexCount, uint32& OutMaterialCount, bool& bOutMatchesReference)
+{
+	// 지오메트리 파싱만 측정 (mtl 로드/파싱 제외)
+	FObjInfo ObjInfo;
+	FString MtlFileName;
+	uint32 UnknownLineCount = 0;
+	const auto ParseStart = std::chrono::high_resolution_clock::now();
+	const bool bParsed = ParseObjGeometry(InFileName, &ObjInfo, MtlFileName, true, &UnknownLineCount);
+	OutParseMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - ParseStart).count();
+	if (!bParsed)
+	{
+		return false;
+	}
+
+	OutPositionCount = static_cast<uint32>(ObjInfo.Positions.size());
+	OutIndexCount = static_cast<uint32>(ObjInfo.PositionIndices.size());
+	OutMaterialCount = static_cast<uint32>(ObjInfo.MaterialNames.size());
+
+	// 기준: 이전 파서로 같은 파일을 파싱
+	FObjInfo ReferenceInfo;
+	FString ReferenceMtlFileName;
+	uint32 ReferenceUnknownLineCount = 0;
+	const auto ReferenceStart = std::chrono::high_resolution_clock::now();
+	const bool bReferenceParsed = ParseObjGeometryReference(InFileName, &ReferenceInfo, ReferenceMtlFileName, true, ReferenceUnknownLineCount);
+	OutReferenceMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - ReferenceStart).count();
+
+	// 실수 파싱 구현(from_chars vs stringstream)이 다르므로 좌표는 허용 오차로, 나머지는 정확히 비교
+	auto NearlyEqual = [](float A, float B)
+	{
+		return std::fabs(A - B) <= 1e-5f * std::max(1.0f, std::fabs(B));
+	};
+	auto VectorsMatch = [&NearlyEqual](const TArray<FVector>& A, const TArray<FVector>& B)
+	{
+		if (A.size() != B.size())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < A.size(); ++i)
+		{
+			if (!NearlyEqual(A[i].X, B[i].X) || !NearlyEqual(A[i].Y, B[i].Y) || !NearlyEqual(A[i].Z, B[i].Z))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+	bool bTexCoordsMatch = ObjInfo.TexCoords.size() == ReferenceInfo.TexCoords.size();
+	for (size_t i = 0; bTexCoordsMatch && i < ObjInfo.TexCoords.size(); ++i)
+	{
+		bTexCoordsMatch = NearlyEqual(ObjInfo.TexCoords[i].X, ReferenceInfo.TexCoords[i].X)
+			&& NearlyEqual(ObjInfo.TexCoords[i].Y, ReferenceInfo.TexCoords[i].Y);
+	}
+
+	bOutMatchesReference = bReferenceParsed
+		&& VectorsMatch(ObjInfo.Positions, ReferenceInfo.Positions)
+		&& VectorsMatch(ObjInfo.Normals, ReferenceInfo.Normals)
+		&& bTexCoordsMatch
+		&& ObjInfo.PositionIndices == ReferenceInfo.PositionIndices
+		&& ObjInfo.TexCoordIndices == ReferenceInfo.TexCoordIndices
+		&& ObjInfo.NormalIndices == ReferenceInfo.NormalIndices
+		&& ObjInfo.MaterialNames == ReferenceInfo.MaterialNames
+		&& ObjInfo.GroupIndexStartArray == ReferenceInfo.GroupIndexStartArray
+		&& MtlFileName == ReferenceMtlFileName
+		&& UnknownLineCount == ReferenceUnknownLineCount;
+	return true;
 }
@@ -40,19 +40,24 @@ public:
 		bool operator==(const VertexKey& Other) const { return PosIndex == Other.PosIndex && TexIndex == Other.TexIndex && NormalIndex == Other.NormalIndex; }
 	};
 
-	struct VertexKeyHash
-	{
-		size_t operator()(const VertexKey& Key) const { return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2); }
-	};
-
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
 
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
+	/**
+	 * 격자 메시(face-vertex FaceVertexCount개)를 합성해 ConvertToStaticMesh 시간을 측정한다 (콘솔 벤치마크용).
+	 * 같은 입력을 이전 구현(unordered_map 용접)으로도 변환해 정점/인덱스/그룹 정보가 바이트 단위로 같은지 bOutMatchesReference에 기록한다.
+	 */
+	static void BenchmarkConvertToStaticMesh(uint32 FaceVertexCount, double& OutConvertMS, double& OutReferenceMS,
+		uint32& OutVertexCount, bool& bOutMatchesReference);
 
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
+	/**
+	 * .obj 하나의 지오메트리 파싱 시간만 측정한다 (mtl 로드 제외, 콘솔 벤치마크용).
+	 * 같은 파일을 이전 파서(getline + stringstream)로도 파싱해 정점/인덱스/머티리얼/그룹/알 수 없는 줄 수가 같은지 bOutMatchesReference에 기록한다.
+	 * @return .obj 파일을 열지 못하면 false
+	 */
+	static bool BenchmarkParseObj(const FString& InFileName, double& OutParseMS, double& OutReferenceMS,
+		uint32& OutPositionCount, uint32& OutIndexCount, uint32& OutMaterialCount, bool& bOutMatchesReference);
 };
 
 class UStaticMesh;
@@ -66,4 +71,10 @@ public:
 	static void Clear();
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
+
+private:
+	// 캐시 검증 / 파싱 / 캐시 기록 (UObject 미사용, 워커 스레드에서 호출 가능)
+	static FStaticMesh* DecodeObjStaticMeshAsset(const FString& NormalizedPathStr, TArray<FMaterialInfo>& MaterialInfos);
+	// 머티리얼 UObject 생성 및 메모리 캐시 등록 (메인 스레드 전용)
+	static FStaticMesh* RegisterObjStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, const TArray<FMaterialInfo>& MaterialInfos);
 };
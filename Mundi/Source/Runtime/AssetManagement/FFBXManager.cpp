@@ -17,14 +17,141 @@
 #include "PathUtils.h"
 #include "ObjectIterator.h"
 #include "SkeletalMesh.h"
+#include "SkeletalMeshTypes.h"
 #include "StaticMesh.h"
 #include "Material.h"
 #include "ResourceManager.h"
-#include "WindowsBinReader.h"
+#include "MemoryMappedReader.h"
 #include "WindowsBinWriter.h"
+#include "AnimSequence.h"
+#include <chrono>
 
 using namespace fbxsdk;
 
+namespace
+{
+    // 원본 FBX가 없거나 캐시가 더 최신이면 true
+    bool IsCacheNewerThanSource(const FString& NormalizedPathStr, const FString& CachePathFileName)
+    {
+        if (!fs::exists(NormalizedPathStr))
+        {
+            return true;
+        }
+
+        try
+        {
+            return fs::last_write_time(CachePathFileName) > fs::last_write_time(NormalizedPathStr);
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    /**
+     * 캐시(.bin / .mat.bin)가 원본 FBX보다 최신이면 읽어서 반환합니다.
+     * UObject와 메모리 캐시 맵을 건드리지 않으므로 Preload 워커 스레드에서 호출할 수 있습니다.
+     * 손상된 캐시는 삭제하고 false를 반환합니다 (호출자가 FBX 파싱으로 재생성).
+     */
+    template<typename TMesh>
+    bool TryLoadFBXMeshCache(const FString& NormalizedPathStr, const FString& BinPathFileName, const FString& MatBinPathFileName,
+        TMesh*& OutMeshData, TArray<FMaterialInfo>& OutMaterialInfos)
+    {
+        bool bCacheExists = fs::exists(BinPathFileName) && fs::exists(MatBinPathFileName);
+
+        // 캐시가 최신인지 확인 (FBX 원본이 없으면 캐시 무조건 사용)
+        if (!bCacheExists || !IsCacheNewerThanSource(NormalizedPathStr, BinPathFileName))
+        {
+            return false;
+        }
+
+        UE_LOG("Loading FBX from cache: %s", NormalizedPathStr.c_str());
+        try
+        {
+            OutMeshData = new TMesh();
+
+            FMemoryMappedReader Reader(BinPathFileName);
+            if (!Reader.IsOpen()) throw std::runtime_error("Failed to open bin");
+            Reader << *OutMeshData;
+            Reader.Close();
+
+            FMemoryMappedReader MatReader(MatBinPathFileName);
+            if (!MatReader.IsOpen()) throw std::runtime_error("Failed to open mat bin");
+            Serialization::ReadArray<FMaterialInfo>(MatReader, OutMaterialInfos);
+            MatReader.Close();
+
+            // 구버전(요소별 직렬화) 캐시는 새 포맷으로 다시 저장
+            if (OutMeshData->LoadedCacheVersion != Serialization::MeshCacheVersion)
+            {
+                UE_LOG("Migrating mesh cache to v%u: %s", Serialization::MeshCacheVersion, BinPathFileName.c_str());
+                FWindowsBinWriter Writer(BinPathFileName);
+                Writer << *OutMeshData;
+                Writer.Close();
+                OutMeshData->LoadedCacheVersion = Serialization::MeshCacheVersion;
+            }
+
+            OutMeshData->CacheFilePath = BinPathFileName;
+            UE_LOG("Successfully loaded from cache");
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("Cache load failed: %s. Regenerating...", e.what());
+            delete OutMeshData;
+            OutMeshData = nullptr;
+            OutMaterialInfos.Empty();
+            fs::remove(BinPathFileName);
+            fs::remove(MatBinPathFileName);
+            return false;
+        }
+    }
+
+    /**
+     * 애니메이션 캐시(.anim.bin)가 원본 FBX보다 최신이면 시퀀스 목록을 읽어서 반환합니다.
+     * 손상되었거나 버전이 다른 캐시는 삭제하고 false를 반환합니다 (호출자가 FBX 파싱으로 재생성).
+     */
+    bool TryLoadFBXAnimCache(const FString& NormalizedPathStr, const FString& AnimBinPathFileName, TArray<FAnimSequence*>& OutSequences)
+    {
+        if (!fs::exists(AnimBinPathFileName) || !IsCacheNewerThanSource(NormalizedPathStr, AnimBinPathFileName))
+        {
+            return false;
+        }
+
+        try
+        {
+            FMemoryMappedReader Reader(AnimBinPathFileName);
+            if (!Reader.IsOpen()) throw std::runtime_error("Failed to open anim bin");
+
+            uint32 SequenceCount = 0;
+            Reader << SequenceCount;
+            if (SequenceCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+            {
+                throw std::runtime_error("Cache corrupt: AnimSequence count is unreasonable.");
+            }
+
+            for (uint32 i = 0; i < SequenceCount; ++i)
+            {
+                FAnimSequence* Sequence = new FAnimSequence();
+                OutSequences.Add(Sequence);
+                Reader << *Sequence;
+            }
+            Reader.Close();
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("Anim cache load failed: %s. Regenerating...", e.what());
+            for (FAnimSequence* Sequence : OutSequences)
+            {
+                delete Sequence;
+            }
+            OutSequences.Empty();
+            fs::remove(AnimBinPathFileName);
+            return false;
+        }
+    }
+}
+
 // ========================================
 // FVertexKey: Index-based Vertex Deduplication
 // ========================================
@@ -159,6 +286,7 @@ bool GetVertexElementData(const FbxLayerElementType* Element, int32 ControlPoint
 // Key: 정규화된 파일 경로, Value: FSkeletalMesh 포인터
 TMap<FString, FSkeletalMesh*> FFBXManager::FBXSkeletalMeshMap;
 TMap<FString, FStaticMesh*> FFBXManager::FBXStaticMeshMap;
+TMap<FString, TArray<FAnimSequence*>> FFBXManager::FBXAnimSequenceMap;
 
 FFBXManager::FFBXManager()
 {
@@ -174,9 +302,13 @@ FFBXManager::~FFBXManager()
  *
  * Data 디렉토리의 모든 FBX 파일을 재귀적으로 검색하여 미리 로드합니다.
  * 게임 시작 시 호출되어 로딩 시간을 단축시킵니다.
+ * 캐시 디코드는 워커 풀에서 병렬로, 머티리얼/GPU 리소스 생성과 등록은 메인 스레드에서 순차로 수행합니다.
  */
 void FFBXManager::Preload()
 {
+    using Clock = std::chrono::high_resolution_clock;
+    auto ElapsedMS = [](Clock::time_point Start) { return std::chrono::duration<double, std::milli>(Clock::now() - Start).count(); };
+
     const fs::path DataDir(GDataDir);
 
     if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
@@ -185,7 +317,10 @@ void FFBXManager::Preload()
         return;
     }
 
-    size_t LoadedCount = 0;
+    // 1) 파일 탐색 (메인 스레드)
+    auto StageStart = Clock::now();
+    TArray<FString> FbxPaths;
+    TArray<FString> TexturePaths;
     std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
 
     for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
@@ -205,21 +340,90 @@ void FFBXManager::Preload()
             if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
             {
                 ProcessedFiles.insert(PathStr);
-                LoadFBXSkeletalMesh(PathStr);
-                LoadFBXStaticMesh(PathStr);
-                ++LoadedCount;
+                FbxPaths.Add(PathStr);
             }
         }
         else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
         {
-            UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
+            TexturePaths.Add(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
         }
     }
+    const double DiscoveryMS = ElapsedMS(StageStart);
+
+    // 2) 캐시 검증 + 캐시 디코드 (워커 풀)
+    //    캐시가 없거나 오래된 FBX는 FBX SDK 파싱 중 UObject를 생성하므로 3)에서 메인 스레드로 처리한다.
+    StageStart = Clock::now();
+    struct FDecodedFBX
+    {
+        FSkeletalMesh* SkeletalMesh = nullptr;
+        TArray<FMaterialInfo> SkeletalMaterialInfos;
+        FStaticMesh* StaticMesh = nullptr;
+        TArray<FMaterialInfo> StaticMaterialInfos;
+    };
+    TArray<FDecodedFBX> Decoded;
+    Decoded.SetNum(FbxPaths.Num());
+
+#ifdef USE_OBJ_CACHE
+    concurrency::parallel_for(0, static_cast<int32>(FbxPaths.Num()), [&](int32 Index)
+    {
+        const FString& PathStr = FbxPaths[Index];
+        const FString CachePathStr = ConvertDataPathToCachePath(PathStr);
+        FDecodedFBX& Result = Decoded[Index];
+
+        // 이 단계에서는 맵에 쓰지 않으므로 동시 조회만 발생
+        if (!FBXSkeletalMeshMap.Contains(PathStr))
+        {
+            TryLoadFBXMeshCache(PathStr, CachePathStr + ".sk.bin", CachePathStr + ".sk.mat.bin", Result.SkeletalMesh, Result.SkeletalMaterialInfos);
+        }
+        if (!FBXStaticMeshMap.Contains(PathStr))
+        {
+            TryLoadFBXMeshCache(PathStr, CachePathStr + ".sm.bin", CachePathStr + ".sm.mat.bin", Result.StaticMesh, Result.StaticMaterialInfos);
+        }
+    });
+#endif
+    const double DecodeMS = ElapsedMS(StageStart);
+
+    // 3) 머티리얼 등록, 캐시 미스 FBX 파싱, GPU 리소스 생성 (메인 스레드)
+    StageStart = Clock::now();
+    int32 CacheHitCount = 0;
+    for (int32 Index = 0; Index < FbxPaths.Num(); ++Index)
+    {
+        const FString& PathStr = FbxPaths[Index];
+        FDecodedFBX& Result = Decoded[Index];
+
+        if (Result.SkeletalMesh)
+        {
+            RegisterMaterialsFromInfos(Result.SkeletalMaterialInfos);
+            FBXSkeletalMeshMap.Add(PathStr, Result.SkeletalMesh);
+            ++CacheHitCount;
+        }
+        if (Result.StaticMesh)
+        {
+            RegisterMaterialsFromInfos(Result.StaticMaterialInfos);
+            FBXStaticMeshMap.Add(PathStr, Result.StaticMesh);
+        }
+
+        // 에셋이 맵에 있으면 UObject/GPU 버퍼 생성만, 없으면 FBX 파싱부터 수행
+        LoadFBXSkeletalMesh(PathStr);
+        LoadFBXStaticMesh(PathStr);
+    }
+    const double MeshMS = ElapsedMS(StageStart);
+
+    StageStart = Clock::now();
+    for (const FString& TexturePath : TexturePaths)
+    {
+        UResourceManager::GetInstance().Load<UTexture>(TexturePath);
+    }
+    const double TextureMS = ElapsedMS(StageStart);
 
     // 4) 모든 SkeletalMesh 가져오기
+    StageStart = Clock::now();
     RESOURCE.SetSkeletalMeshs();
+    const double RegisterMS = ElapsedMS(StageStart);
 
-    UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, DataDir.string().c_str());
+    UE_LOG("FBXManager::Preload: Loaded %d .fbx files (%d from cache) from %s", FbxPaths.Num(), CacheHitCount, DataDir.string().c_str());
+    UE_LOG("FBXManager::Preload: discovery %.2f ms | cache decode (parallel) %.2f ms | parse + GPU %.2f ms | textures %.2f ms | register %.2f ms",
+        DiscoveryMS, DecodeMS, MeshMS, TextureMS, RegisterMS);
 }
 
 /*
@@ -243,6 +447,16 @@ void FFBXManager::Clear()
         delete Pair.second;
     }
     FBXStaticMeshMap.Empty();
+
+    // 맵에 저장된 모든 FAnimSequence 메모리 해제
+    for (auto& Pair : FBXAnimSequenceMap)
+    {
+        for (FAnimSequence* Sequence : Pair.second)
+        {
+            delete Sequence;
+        }
+    }
+    FBXAnimSequenceMap.Empty();
 }
 
 /*
@@ -320,129 +534,26 @@ FSkeletalMesh* FFBXManager::LoadFBXSkeletalMeshAsset(const FString& PathFileName
         fs::create_directories(CacheFileDirPath.parent_path());
     }
 
-    bool bCacheExists = fs::exists(BinPathFileName) && fs::exists(MatBinPathFileName);
-    bool bCacheisNewer = false;
-
-    // 캐시가 최신인지 확인
-    if (bCacheExists)
+    if (TryLoadFBXMeshCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName, SkeletalMeshData, MaterialInfos))
     {
-        // FBX 원본이 없으면 캐시 무조건 사용
-        if (!fs::exists(NormalizedPathStr))
-        {
-            bCacheisNewer = true;
-        }
-        else
-        {
-            try
-            {
-                auto binTime = fs::last_write_time(BinPathFileName);
-                auto fbxTime = fs::last_write_time(NormalizedPathStr);
-                bCacheisNewer = (binTime > fbxTime);
-            }
-            catch (...)
-            {
-                bCacheisNewer = false;
-            }
-        }
-    }
-
-    if (bCacheisNewer)
-    {
-        UE_LOG("Loading FBX skeletal mesh from cache: %s", NormalizedPathStr.c_str());
-        try
-        {
-            SkeletalMeshData = new FSkeletalMesh();
-
-            FWindowsBinReader Reader(BinPathFileName);
-            if (!Reader.IsOpen()) throw std::runtime_error("Failed to open bin");
-            Reader << *SkeletalMeshData;
-            Reader.Close();
-
-            FWindowsBinReader MatReader(MatBinPathFileName);
-            if (!MatReader.IsOpen()) throw std::runtime_error("Failed to open mat bin");
-            Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
-
-            RegisterMaterialInfos(MaterialInfos);
-            
-            MatReader.Close();
-
-            // 캐시에서 로드한 MaterialInfos로 UMaterial 객체 생성 및 등록
-            RegisterMaterialsFromInfos(MaterialInfos);
+        RegisterMaterialInfos(MaterialInfos);
 
-            SkeletalMeshData->CacheFilePath = BinPathFileName;
-            bLoadedFromCache = true;
-            UE_LOG("Successfully loaded skeletal mesh from cache");
-        }
-        catch (const std::exception& e)
-        {
-            UE_LOG("Cache load failed: %s. Regenerating...", e.what());
-            delete SkeletalMeshData;
-            SkeletalMeshData = nullptr;
-            fs::remove(BinPathFileName);
-            fs::remove(MatBinPathFileName);
-        }
+        // 캐시에서 로드한 MaterialInfos로 UMaterial 객체 생성 및 등록
+        RegisterMaterialsFromInfos(MaterialInfos);
+        bLoadedFromCache = true;
     }
 #endif
 
     // 캐시 로드 실패 시 fbx 파싱 (USE_OBJ_CACHE 없으면 무조건 파싱)
     if (!bLoadedFromCache)
     {
-        // 2. FBX SDK 초기화
-        FbxManager* SdkManager = FbxManager::Create();
-        if (!SdkManager)
-        {
-            UE_LOG("FBXManager: Failed to create FbxManager!");
-            return nullptr;
-        }
-
-        FbxIOSettings* ios = FbxIOSettings::Create(SdkManager, IOSROOT);
-        SdkManager->SetIOSettings(ios);
-
-        // Material 및 Texture 로딩 활성화
-        ios->SetBoolProp(IMP_FBX_MATERIAL, true);
-        ios->SetBoolProp(IMP_FBX_TEXTURE, true);
-
-        // 3. FBX Importer 생성
-        FbxImporter* Importer = FbxImporter::Create(SdkManager, "");
-        if (!Importer->Initialize(NormalizedPathStr.c_str(), -1, SdkManager->GetIOSettings()))
-        {
-            UE_LOG("FBXManager: Failed to initialize importer for %s", NormalizedPathStr.c_str());
-            UE_LOG("  Error: %s", Importer->GetStatus().GetErrorString());
-            Importer->Destroy();
-            SdkManager->Destroy();
-            return nullptr;
-        }
-
-        // Scene 생성 및 임포트
-        FbxScene* Scene = FbxScene::Create(SdkManager, "TempScene");
-        if (!Importer->Import(Scene))
+        // 2~5. FBX SDK 초기화, Import, 좌표계/단위 변환
+        FbxManager* SdkManager = nullptr;
+        FbxScene* Scene = ImportSkeletalScene(NormalizedPathStr, SdkManager);
+        if (!Scene)
         {
-            UE_LOG("FBXManager: Failed to import FBX file: %s", NormalizedPathStr.c_str());
-            Importer->Destroy();
-            Scene->Destroy();
-            SdkManager->Destroy();
             return nullptr;
         }
-        Importer->Destroy();
-
-        // 4. 좌표계 변환 (Z-up, X-forward, Left-handed - Unreal Engine 스타일)
-        FbxAxisSystem SceneAxisSystem = Scene->GetGlobalSettings().GetAxisSystem();
-        FbxAxisSystem OurAxisSystem(
-            FbxAxisSystem::eZAxis,
-            FbxAxisSystem::eParityEven,
-            FbxAxisSystem::eLeftHanded);
-
-        if (SceneAxisSystem != OurAxisSystem)
-        {
-            OurAxisSystem.DeepConvertScene(Scene);
-        }
-
-        // 5. 단위 변환 (cm로 통일)
-        FbxSystemUnit SceneSystemUnit = Scene->GetGlobalSettings().GetSystemUnit();
-        if (SceneSystemUnit.GetScaleFactor() != 1.0)
-        {
-            FbxSystemUnit::cm.ConvertScene(Scene);
-        }
 
         // 6. Triangulate (모든 폴리곤을 삼각형으로 변환)
         FbxGeometryConverter GeometryConverter(SdkManager);
@@ -575,6 +686,85 @@ USkeletalMesh* FFBXManager::LoadFBXSkeletalMesh(const FString& PathFileName)
     return SkeletalMesh;
 }
 
+/*
+ * LoadFBXAnimSequences()
+ *
+ * FBX 파일의 모든 애님 스택을 압축 FAnimSequence로 로드합니다.
+ * 트랙은 같은 파일에서 임포트한 스켈레톤의 본 순서를 따르므로 스켈레탈 메시를 먼저 로드합니다.
+ *
+ * 처리 과정:
+ * 1. 메모리 캐시 확인
+ * 2. 디스크 캐시(.anim.bin) 확인
+ * 3. 캐시가 없으면 FBX Import 후 애님 스택마다 프레임 단위로 본 로컬 변환을 샘플링해 압축
+ * 4. 디스크 캐시 저장 (애님 스택이 없어도 빈 목록을 저장해 재파싱을 막음)
+ *
+ * @param PathFileName FBX 파일 경로
+ * @return 시퀀스 목록 (애님 스택이 없으면 빈 배열, 스켈레톤 로드 실패 시 nullptr)
+ */
+const TArray<FAnimSequence*>* FFBXManager::LoadFBXAnimSequences(const FString& PathFileName)
+{
+    FString NormalizedPathStr = NormalizePath(PathFileName);
+
+    // 1. 메모리 캐시 확인
+    if (TArray<FAnimSequence*>* It = FBXAnimSequenceMap.Find(NormalizedPathStr))
+    {
+        return It;
+    }
+
+    FSkeletalMesh* SkeletonData = LoadFBXSkeletalMeshAsset(NormalizedPathStr);
+    if (!SkeletonData || SkeletonData->Bones.IsEmpty())
+    {
+        UE_LOG("FBXManager: Cannot import animations without a skeleton: %s", NormalizedPathStr.c_str());
+        return nullptr;
+    }
+
+    TArray<FAnimSequence*> Sequences;
+    bool bLoadedFromCache = false;
+
+#ifdef USE_OBJ_CACHE
+    // 2. 디스크 캐시 확인 (스켈레탈 메시 캐시와 같은 디렉토리)
+    const FString AnimBinPathFileName = ConvertDataPathToCachePath(NormalizedPathStr) + ".anim.bin";
+    bLoadedFromCache = TryLoadFBXAnimCache(NormalizedPathStr, AnimBinPathFileName, Sequences);
+#endif
+
+    if (!bLoadedFromCache)
+    {
+        // 3. FBX 파싱
+        FbxManager* SdkManager = nullptr;
+        FbxScene* Scene = ImportSkeletalScene(NormalizedPathStr, SdkManager);
+        if (!Scene)
+        {
+            return nullptr;
+        }
+
+        ParseAnimationStacks(Scene, SkeletonData, Sequences);
+
+        Scene->Destroy();
+        SdkManager->Destroy();
+
+#ifdef USE_OBJ_CACHE
+        // 4. 디스크 캐시 저장
+        try {
+            FWindowsBinWriter Writer(AnimBinPathFileName);
+            uint32 SequenceCount = static_cast<uint32>(Sequences.Num());
+            Writer << SequenceCount;
+            for (FAnimSequence* Sequence : Sequences)
+            {
+                Writer << *Sequence;
+            }
+            Writer.Close();
+            UE_LOG("FBXManager: Animation cache saved: %s", AnimBinPathFileName.c_str());
+        }
+        catch (const std::exception& e) {
+            UE_LOG("FBXManager: Failed to save animation cache: %s", e.what());
+        }
+#endif
+    }
+
+    FBXAnimSequenceMap.Add(NormalizedPathStr, Sequences);
+    return FBXAnimSequenceMap.Find(NormalizedPathStr);
+}
+
 // ========================================
 // Helper Functions
 // ========================================
@@ -1237,6 +1427,191 @@ void FFBXManager::ParseBoneHierarchy(FbxScene* Scene, FSkeletalMesh* OutMeshData
     UE_LOG("FBXManager: Parsed %d bones with BindPose-based transforms", OutMeshData->Bones.size());
 }
 
+/*
+ * ImportSkeletalScene()
+ *
+ * FBX 파일을 Import하고 엔진 좌표계(Z-up, X-forward, Left-handed)와 cm 단위로 변환합니다.
+ * 스켈레탈 메시와 애니메이션이 같은 변환을 거쳐야 본 로컬 변환이 일치합니다.
+ *
+ * @param NormalizedPathStr 정규화된 FBX 파일 경로
+ * @param OutSdkManager 생성된 FbxManager (성공 시 호출자가 Scene과 함께 Destroy)
+ * @return 변환된 Scene (실패 시 nullptr, SDK 리소스는 정리됨)
+ */
+FbxScene* FFBXManager::ImportSkeletalScene(const FString& NormalizedPathStr, FbxManager*& OutSdkManager)
+{
+    OutSdkManager = nullptr;
+
+    FbxManager* SdkManager = FbxManager::Create();
+    if (!SdkManager)
+    {
+        UE_LOG("FBXManager: Failed to create FbxManager!");
+        return nullptr;
+    }
+
+    FbxIOSettings* ios = FbxIOSettings::Create(SdkManager, IOSROOT);
+    SdkManager->SetIOSettings(ios);
+
+    // Material 및 Texture 로딩 활성화
+    ios->SetBoolProp(IMP_FBX_MATERIAL, true);
+    ios->SetBoolProp(IMP_FBX_TEXTURE, true);
+
+    // FBX Importer 생성
+    FbxImporter* Importer = FbxImporter::Create(SdkManager, "");
+    if (!Importer->Initialize(NormalizedPathStr.c_str(), -1, SdkManager->GetIOSettings()))
+    {
+        UE_LOG("FBXManager: Failed to initialize importer for %s", NormalizedPathStr.c_str());
+        UE_LOG("  Error: %s", Importer->GetStatus().GetErrorString());
+        Importer->Destroy();
+        SdkManager->Destroy();
+        return nullptr;
+    }
+
+    // Scene 생성 및 임포트
+    FbxScene* Scene = FbxScene::Create(SdkManager, "TempScene");
+    if (!Importer->Import(Scene))
+    {
+        UE_LOG("FBXManager: Failed to import FBX file: %s", NormalizedPathStr.c_str());
+        Importer->Destroy();
+        Scene->Destroy();
+        SdkManager->Destroy();
+        return nullptr;
+    }
+    Importer->Destroy();
+
+    // 좌표계 변환 (Z-up, X-forward, Left-handed - Unreal Engine 스타일)
+    FbxAxisSystem SceneAxisSystem = Scene->GetGlobalSettings().GetAxisSystem();
+    FbxAxisSystem OurAxisSystem(
+        FbxAxisSystem::eZAxis,
+        FbxAxisSystem::eParityEven,
+        FbxAxisSystem::eLeftHanded);
+
+    if (SceneAxisSystem != OurAxisSystem)
+    {
+        OurAxisSystem.DeepConvertScene(Scene);
+    }
+
+    // 단위 변환 (cm로 통일)
+    FbxSystemUnit SceneSystemUnit = Scene->GetGlobalSettings().GetSystemUnit();
+    if (SceneSystemUnit.GetScaleFactor() != 1.0)
+    {
+        FbxSystemUnit::cm.ConvertScene(Scene);
+    }
+
+    OutSdkManager = SdkManager;
+    return Scene;
+}
+
+/*
+ * ParseAnimationStacks()
+ *
+ * Scene의 애님 스택마다 씬 프레임레이트로 본 로컬 변환을 샘플링하고 FAnimSequence로 압축합니다.
+ *
+ * [바인드 포즈와 같은 규칙]:
+ * - 로컬 = ParentGlobal^-1 * Global, 루트 본은 글로벌 = 로컬
+ * - 이동은 cm -> m (0.01), 행렬 분해는 FBone::FromBoneInfo와 동일 (FMatrix::Decompose)
+ * - 씬에서 찾을 수 없는 본은 바인드 포즈 로컬 변환으로 채움
+ *
+ * @param Scene ImportSkeletalScene으로 변환된 FBX Scene
+ * @param SkeletonData 트랙 순서를 결정하는 스켈레톤
+ * @param OutSequences 생성된 시퀀스 (호출자 소유)
+ */
+void FFBXManager::ParseAnimationStacks(FbxScene* Scene, const FSkeletalMesh* SkeletonData, TArray<FAnimSequence*>& OutSequences)
+{
+    const int32 StackCount = Scene->GetSrcObjectCount<FbxAnimStack>();
+    if (StackCount == 0)
+    {
+        UE_LOG("FBXManager: No animation stack found");
+        return;
+    }
+
+    const int32 BoneCount = SkeletonData->Bones.Num();
+    TArray<FString> BoneNames;
+    TArray<FbxNode*> BoneNodes;
+    TArray<FbxNode*> ParentNodes;
+    BoneNames.Reserve(BoneCount);
+    BoneNodes.Reserve(BoneCount);
+    ParentNodes.Reserve(BoneCount);
+    for (const FBoneInfo& Bone : SkeletonData->Bones)
+    {
+        FbxNode* Node = Scene->FindNodeByName(Bone.BoneName.c_str());
+        BoneNames.Add(Bone.BoneName);
+        BoneNodes.Add(Node);
+        ParentNodes.Add(Node && Bone.ParentIndex != -1 ? Node->GetParent() : nullptr);
+    }
+
+    double FrameRate = FbxTime::GetFrameRate(Scene->GetGlobalSettings().GetTimeMode());
+    if (FrameRate <= 0.0)
+    {
+        FrameRate = 30.0;
+    }
+
+    const float ScaleFactor = 0.01f;
+    TArray<FTransform> RawKeys;
+
+    for (int32 StackIndex = 0; StackIndex < StackCount; ++StackIndex)
+    {
+        FbxAnimStack* AnimStack = Scene->GetSrcObject<FbxAnimStack>(StackIndex);
+        Scene->SetCurrentAnimationStack(AnimStack);
+
+        const FbxTimeSpan TimeSpan = AnimStack->GetLocalTimeSpan();
+        const double StartSeconds = TimeSpan.GetStart().GetSecondDouble();
+        const double DurationSeconds = std::max(0.0, TimeSpan.GetDuration().GetSecondDouble());
+        const int32 NumFrames = std::min(static_cast<int32>(std::floor(DurationSeconds * FrameRate + 0.5)) + 1, 65536);
+
+        RawKeys.SetNum(static_cast<size_t>(NumFrames) * BoneCount);
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            FbxTime Time;
+            Time.SetSecondDouble(StartSeconds + Frame / FrameRate);
+
+            for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+            {
+                FTransform& Key = RawKeys[static_cast<size_t>(Frame) * BoneCount + BoneIndex];
+                FbxNode* Node = BoneNodes[BoneIndex];
+                if (!Node)
+                {
+                    const FBone BindBone = FBone::FromBoneInfo(BoneIndex, SkeletonData->Bones);
+                    Key = FTransform(BindBone.LocalPosition, BindBone.LocalRotation, BindBone.LocalScale);
+                    continue;
+                }
+
+                FbxAMatrix LocalMatrix = Node->EvaluateGlobalTransform(Time);
+                if (FbxNode* ParentNode = ParentNodes[BoneIndex])
+                {
+                    LocalMatrix = ParentNode->EvaluateGlobalTransform(Time).Inverse() * LocalMatrix;
+                }
+
+                FMatrix BoneLocal;
+                for (int i = 0; i < 4; i++)
+                {
+                    for (int j = 0; j < 4; j++)
+                    {
+                        BoneLocal.M[i][j] = static_cast<float>(LocalMatrix.Get(i, j));
+                    }
+                }
+                BoneLocal.M[3][0] *= ScaleFactor;
+                BoneLocal.M[3][1] *= ScaleFactor;
+                BoneLocal.M[3][2] *= ScaleFactor;
+
+                BoneLocal.Decompose(Key.Scale3D, Key.Rotation, Key.Translation);
+            }
+        }
+
+        FAnimSequence* Sequence = new FAnimSequence();
+        Sequence->Compress(AnimStack->GetName(), static_cast<float>(FrameRate), NumFrames, BoneNames, RawKeys);
+        if (Sequence->NumFrames == 0)
+        {
+            delete Sequence;
+            continue;
+        }
+
+        UE_LOG("FBXManager: Imported animation '%s' (%d frames @ %.0f fps, %d/%d constant channels, %zu -> %zu bytes)",
+            Sequence->Name.c_str(), Sequence->NumFrames, FrameRate, Sequence->GetConstantChannelCount(), BoneCount * 3,
+            Sequence->GetRawSize(), Sequence->GetCompressedSize());
+        OutSequences.Add(Sequence);
+    }
+}
+
 /*
  * ParseSkinWeights()
  *
@@ -1567,64 +1942,11 @@ FStaticMesh* FFBXManager::LoadFBXStaticMeshAsset(const FString& PathFileName)
         fs::create_directories(CacheFileDirPath.parent_path());
     }
 
-    bool bCacheExists = fs::exists(BinPathFileName) && fs::exists(MatBinPathFileName);
-    bool bCacheisNewer = false;
-
-    // 캐시가 최신인지 확인
-    if (bCacheExists)
-    {
-        // FBX 원본이 없으면 캐시 무조건 사용
-        if (!fs::exists(NormalizedPathStr))
-        {
-            bCacheisNewer = true;
-        }
-        else
-        {
-            try
-            {
-                auto binTime = fs::last_write_time(BinPathFileName);
-                auto fbxTime = fs::last_write_time(NormalizedPathStr);
-                bCacheisNewer = (binTime > fbxTime);
-            }
-            catch (...)
-            {
-                bCacheisNewer = false;
-            }
-        }
-    }
-
-    if (bCacheisNewer)
+    if (TryLoadFBXMeshCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName, StaticMeshData, MaterialInfos))
     {
-        UE_LOG("Loading FBX from cache: %s", NormalizedPathStr.c_str());
-        try
-        {
-            StaticMeshData = new FStaticMesh();
-
-            FWindowsBinReader Reader(BinPathFileName);
-            if (!Reader.IsOpen()) throw std::runtime_error("Failed to open bin");
-            Reader << *StaticMeshData;
-            Reader.Close();
-
-            FWindowsBinReader MatReader(MatBinPathFileName);
-            if (!MatReader.IsOpen()) throw std::runtime_error("Failed to open mat bin");
-            Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
-            MatReader.Close();
-
-            // 캐시에서 로드한 MaterialInfos로 UMaterial 객체 생성 및 등록
-            RegisterMaterialsFromInfos(MaterialInfos);
-
-            StaticMeshData->CacheFilePath = BinPathFileName;
-            bLoadedFromCache = true;
-            UE_LOG("Successfully loaded from cache");
-        }
-        catch (const std::exception& e)
-        {
-            UE_LOG("Cache load failed: %s. Regenerating...", e.what());
-            delete StaticMeshData;
-            StaticMeshData = nullptr;
-            fs::remove(BinPathFileName);
-            fs::remove(MatBinPathFileName);
-        }
+        // 캐시에서 로드한 MaterialInfos로 UMaterial 객체 생성 및 등록
+        RegisterMaterialsFromInfos(MaterialInfos);
+        bLoadedFromCache = true;
     }
 #endif
 
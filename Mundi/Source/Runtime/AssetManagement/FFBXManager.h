@@ -5,6 +5,7 @@ class UStaticMesh;
 struct FSkeletalMesh;
 struct FStaticMesh;
 struct FNormalVertex;
+struct FAnimSequence;
 
 class FFBXManager
 {
@@ -23,6 +24,9 @@ public:
     static FStaticMesh* LoadFBXStaticMeshAsset(const FString& PathFileName);
     static UStaticMesh* LoadFBXStaticMesh(const FString& PathFileName);
 
+    // 애니메이션 로딩 (애님 스택마다 하나의 시퀀스, 트랙은 같은 파일의 스켈레톤 본 순서)
+    static const TArray<FAnimSequence*>* LoadFBXAnimSequences(const FString& PathFileName);
+
 private:
     // Helper functions (Skeletal/Static Mesh 공통 사용)
     static void FindAllMeshesRecursive(FbxNode* FbxMeshNode, TArray<FbxMesh*>& OutMesh);
@@ -39,6 +43,11 @@ private:
     static bool IsSkeletonRootNode(FbxNode* Node);
     static void CollectBoneData(FbxNode* Node, FSkeletalMesh* OutMeshData, int32 ParentIndex, FbxPose* BindPose, TMap<FbxNode*, int32>& NodeToIndexMap);
 
+    // Scene Import 및 Animation helpers
+    static FbxScene* ImportSkeletalScene(const FString& NormalizedPathStr, FbxManager*& OutSdkManager);
+    static void ParseAnimationStacks(FbxScene* Scene, const FSkeletalMesh* SkeletonData, TArray<FAnimSequence*>& OutSequences);
+
     static TMap<FString, FSkeletalMesh*> FBXSkeletalMeshMap;
     static TMap<FString, FStaticMesh*> FBXStaticMeshMap;
+    static TMap<FString, TArray<FAnimSequence*>> FBXAnimSequenceMap;
 };
@@ -7,9 +7,11 @@
 #include "FFBXManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "WindowsBinWriter.h"
 #include "Enums.h"
 #include <filesystem>
 #include <cwctype>
+#include <chrono>
 
 IMPLEMENT_CLASS(UResourceManager)
 
@@ -130,6 +132,35 @@ FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
     return nullptr;
 }
 
+/**
+ * @brief 피킹 BVH 디스크 캐시(.bvh.bin)가 원본 에셋과 메시 캐시(.sm.bin)보다 최신인지 검사합니다.
+ * @return 캐시를 그대로 읽어도 되면 true
+ */
+static bool IsMeshBVHCacheUpToDate(const FString& SourcePath, const FStaticMesh* StaticMeshAsset, const FString& BVHBinPath)
+{
+    try
+    {
+        if (!fs::exists(BVHBinPath))
+            return false;
+
+        const auto BinTimestamp = fs::last_write_time(BVHBinPath);
+
+        if (fs::exists(SourcePath) && fs::last_write_time(SourcePath) > BinTimestamp)
+            return false;
+
+        // 메시 캐시가 다시 만들어졌다면 정점 순서가 바뀌었을 수 있으므로 BVH도 무효
+        const FString& MeshBinPath = StaticMeshAsset->CacheFilePath;
+        if (!MeshBinPath.empty() && fs::exists(MeshBinPath) && fs::last_write_time(MeshBinPath) > BinTimestamp)
+            return false;
+    }
+    catch (const fs::filesystem_error& e)
+    {
+        UE_LOG("[MeshBVH] Filesystem error during cache validation: %s", e.what());
+        return false;
+    }
+    return true;
+}
+
 FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset)
 {
     if (auto* Found = MeshBVHCache.Find(ObjPath))
@@ -138,9 +169,71 @@ FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FSta
     if (!StaticMeshAsset)
         return nullptr;
 
+    const uint32 VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.Num());
+    const uint32 TriangleCount = static_cast<uint32>(StaticMeshAsset->Indices.Num() / 3);
+
+#ifdef USE_OBJ_CACHE
+    // 1. 디스크 캐시 로드 시도 (첫 피킹 비용을 전체 빌드 대신 파일 읽기로)
+    const FString BVHBinPathFileName = ConvertDataPathToCachePath(NormalizePath(ObjPath)) + ".bvh.bin";
+
+    if (IsMeshBVHCacheUpToDate(ObjPath, StaticMeshAsset, BVHBinPathFileName))
+    {
+        auto LoadStart = std::chrono::high_resolution_clock::now();
+
+        FMeshBVH* LoadedBVH = new FMeshBVH();
+        bool bLoaded = false;
+        try
+        {
+            // 노드/패킷은 매핑 영역을 그대로 사용 (복사 없음)
+            LoadedBVH->LoadMapped(BVHBinPathFileName);
+
+            // 헤더의 소스 크기가 현재 메시와 다르면 다른 메시로 만든 캐시
+            bLoaded = LoadedBVH->GetSourceVertexCount() == VertexCount
+                && LoadedBVH->GetSourceTriangleCount() == TriangleCount;
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("[MeshBVH] Error loading cache %s: %s", BVHBinPathFileName.c_str(), e.what());
+        }
+
+        if (bLoaded)
+        {
+            MeshBVHCache.Add(ObjPath, LoadedBVH);
+
+            std::chrono::duration<double, std::milli> LoadTime = std::chrono::high_resolution_clock::now() - LoadStart;
+            UE_LOG("[MeshBVH] Mapped %s from cache: %u tris, %.2f ms", ObjPath.c_str(), TriangleCount, LoadTime.count());
+            return LoadedBVH;
+        }
+
+        delete LoadedBVH;
+        fs::remove(BVHBinPathFileName);
+    }
+#endif // USE_OBJ_CACHE
+
+    // 2. 캐시가 없거나 오래되었으면 빌드
+    auto BuildStart = std::chrono::high_resolution_clock::now();
+
     FMeshBVH* NewBVH = new FMeshBVH();
     NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
     MeshBVHCache.Add(ObjPath, NewBVH);
+
+    std::chrono::duration<double, std::milli> BuildTime = std::chrono::high_resolution_clock::now() - BuildStart;
+    UE_LOG("[MeshBVH] Built %s: %u tris, %d nodes, %.2f ms", ObjPath.c_str(),
+        TriangleCount, NewBVH->GetNodeCount(), BuildTime.count());
+
+#ifdef USE_OBJ_CACHE
+    // 3. 다음 세션을 위해 저장
+    fs::path CacheFileDirPath(BVHBinPathFileName);
+    if (CacheFileDirPath.has_parent_path())
+    {
+        fs::create_directories(CacheFileDirPath.parent_path());
+    }
+
+    FWindowsBinWriter Writer(BVHBinPathFileName);
+    Writer << *NewBVH;
+    Writer.Close();
+#endif // USE_OBJ_CACHE
+
     return NewBVH;
 }
 
@@ -25,6 +25,7 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVer
         CreateVertexBuffer(SkeletalMeshAsset, InDevice, InVertexType);
         CreateIndexBuffer(SkeletalMeshAsset, InDevice);
         CreateLocalBound(SkeletalMeshAsset);
+        SkinningSource.Build(SkeletalMeshAsset->SkinnedVertices);
         VertexCount = static_cast<uint32>(SkeletalMeshAsset->Vertices.size());
         IndexCount = static_cast<uint32>(SkeletalMeshAsset->Indices.size());
     }
@@ -45,6 +46,19 @@ void USkeletalMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayou
     IndexCount = static_cast<uint32>(InData->Indices.size());
 }
 
+void USkeletalMesh::SetSkeletalMeshAsset(FSkeletalMesh* InSkeletalMesh)
+{
+    SkeletalMeshAsset = InSkeletalMesh;
+    if (SkeletalMeshAsset)
+    {
+        SkinningSource.Build(SkeletalMeshAsset->SkinnedVertices);
+    }
+    else
+    {
+        SkinningSource.Empty();
+    }
+}
+
 void USkeletalMesh::SetVertexType(EVertexLayoutType InVertexLayoutType)
 {
     VertexType = InVertexLayoutType;
@@ -181,6 +195,7 @@ USkeletalMesh* USkeletalMesh::DuplicateForEditor(USkeletalMesh* Original, ID3D11
     Duplicate->VertexCount = Original->VertexCount;
     Duplicate->IndexCount = Original->IndexCount;
     Duplicate->LocalBound = Original->LocalBound;
+    Duplicate->SkinningSource = Original->SkinningSource;
 
     // GPU 버퍼만 독립적으로 생성 (격리를 위한 핵심)
     Duplicate->CreateVertexBuffer(Duplicate->SkeletalMeshAsset, Device, Duplicate->VertexType);
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "ResourceBase.h"
+#include "SkinningKernel.h"
 
 class USkeletalMeshComponent;
 
@@ -27,8 +28,10 @@ public:
     uint32 GetVertexStride() const { return VertexStride; };
 
 	const FString& GetAssetPathFileName() const { return SkeletalMeshAsset ? SkeletalMeshAsset->PathFileName : FilePath; }
-    void SetSkeletalMeshAsset(FSkeletalMesh* InSkeletalMesh) { SkeletalMeshAsset = InSkeletalMesh; }
+    void SetSkeletalMeshAsset(FSkeletalMesh* InSkeletalMesh);
 	FSkeletalMesh* GetSkeletalMeshAsset() const { return SkeletalMeshAsset; }
+    // CPU 스키닝용 SoA 입력 (SkeletalMeshAsset 지정 시 생성)
+    const FSkinningSourceStreams& GetSkinningSource() const { return SkinningSource; }
 
     const TArray<FGroupInfo>& GetMeshGroupInfo() const { return SkeletalMeshAsset->GroupInfos; }
     bool HasMaterial() const { return SkeletalMeshAsset->bHasMaterial; }
@@ -76,6 +79,7 @@ private:
 
 	// CPU 리소스
     FSkeletalMesh* SkeletalMeshAsset = nullptr;
+    FSkinningSourceStreams SkinningSource;
 
     // 메시 단위 BVH (ResourceManager에서 캐싱, 소유)
     // 초기화되지 않는 멤버변수 (참조도 ResourceManager에서만 이루어짐) 
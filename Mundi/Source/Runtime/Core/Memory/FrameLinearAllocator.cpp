@@ -0,0 +1,85 @@
+﻿#include "pch.h"
+#include "FrameLinearAllocator.h"
+
+FFrameLinearAllocator::FFrameLinearAllocator(size_t InInitialCapacity)
+	: InitialCapacity(InInitialCapacity)
+{
+}
+
+FFrameLinearAllocator::~FFrameLinearAllocator()
+{
+	FreeChunks();
+}
+
+void* FFrameLinearAllocator::Allocate(size_t Size, size_t Alignment)
+{
+	if (Size == 0)
+		return nullptr;
+
+	if (CurrentChunk >= 0)
+	{
+		const FChunk& Chunk = Chunks[CurrentChunk];
+		const size_t AlignedOffset = (CurrentOffset + Alignment - 1) & ~(Alignment - 1);
+		if (AlignedOffset + Size <= Chunk.Size)
+		{
+			UsedBytes += AlignedOffset + Size - CurrentOffset;
+			CurrentOffset = AlignedOffset + Size;
+			return Chunk.Data + AlignedOffset;
+		}
+	}
+
+	// 현재 청크에 자리가 없으면 새 청크 (직전 청크의 2배 이상)
+	AddChunk(Size + Alignment);
+	const FChunk& Chunk = Chunks[CurrentChunk];
+	const size_t AlignedOffset = (reinterpret_cast<uintptr_t>(Chunk.Data) + Alignment - 1) & ~(Alignment - 1);
+	const size_t Offset = AlignedOffset - reinterpret_cast<uintptr_t>(Chunk.Data);
+	UsedBytes += Offset + Size;
+	CurrentOffset = Offset + Size;
+	return Chunk.Data + Offset;
+}
+
+void FFrameLinearAllocator::Reset()
+{
+	if (Chunks.Num() > 1)
+	{
+		// 이번 프레임에 필요했던 전체 크기로 청크 하나를 다시 잡는다
+		const size_t MergedSize = CapacityBytes;
+		FreeChunks();
+		AddChunk(MergedSize);
+	}
+
+	CurrentChunk = Chunks.IsEmpty() ? -1 : 0;
+	CurrentOffset = 0;
+	UsedBytes = 0;
+}
+
+void FFrameLinearAllocator::AddChunk(size_t MinSize)
+{
+	const size_t LastSize = Chunks.IsEmpty() ? InitialCapacity : Chunks[Chunks.Num() - 1].Size * 2;
+
+	FChunk Chunk;
+	Chunk.Size = FMath::Max(LastSize, MinSize);
+	Chunk.Data = static_cast<uint8*>(malloc(Chunk.Size));
+	if (!Chunk.Data)
+	{
+		throw std::bad_alloc();
+	}
+
+	Chunks.Add(Chunk);
+	CurrentChunk = Chunks.Num() - 1;
+	CurrentOffset = 0;
+	CapacityBytes += Chunk.Size;
+	++ChunkAllocationCount;
+}
+
+void FFrameLinearAllocator::FreeChunks()
+{
+	for (FChunk& Chunk : Chunks)
+	{
+		free(Chunk.Data);
+	}
+	Chunks.Empty();
+	CurrentChunk = -1;
+	CurrentOffset = 0;
+	CapacityBytes = 0;
+}
@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include <type_traits>
+#include "UEContainer.h"
+
+/**
+ * 프레임 단위 선형(bump) 할당기
+ *
+ * - 청크 안에서 오프셋만 밀어 할당하고, 개별 해제는 없다. Reset으로 한 번에 비운다
+ * - 청크가 모자라면 새 청크를 붙이고, 다음 Reset에서 전체 크기의 청크 하나로 합친다
+ *   → 필요한 크기에 한 번 도달하면 이후 프레임은 힙 할당이 없다
+ * - 소멸자를 호출하지 않으므로 trivially destructible 타입만 담는다
+ * - 스레드 안전하지 않다 (렌더 스레드 전용)
+ */
+class FFrameLinearAllocator
+{
+public:
+	explicit FFrameLinearAllocator(size_t InInitialCapacity = 64 * 1024);
+	~FFrameLinearAllocator();
+
+	FFrameLinearAllocator(const FFrameLinearAllocator&) = delete;
+	FFrameLinearAllocator& operator=(const FFrameLinearAllocator&) = delete;
+
+	void* Allocate(size_t Size, size_t Alignment = 16);
+
+	template<typename T>
+	T* AllocateArray(uint32 Count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "FFrameLinearAllocator never runs destructors");
+		return static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+	}
+
+	// 이번 프레임 할당을 모두 무효화한다. 청크가 여러 개였으면 합쳐서 하나로 다시 잡는다
+	void Reset();
+
+	size_t GetUsedBytes() const { return UsedBytes; }
+	size_t GetCapacityBytes() const { return CapacityBytes; }
+	// 누적 청크(힙) 할당 횟수. 정상 상태에서는 증가하지 않아야 한다
+	uint32 GetChunkAllocationCount() const { return ChunkAllocationCount; }
+
+private:
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		size_t Size = 0;
+	};
+
+	void AddChunk(size_t MinSize);
+	void FreeChunks();
+
+	TArray<FChunk> Chunks;
+	int32 CurrentChunk = -1;
+	size_t CurrentOffset = 0;
+
+	size_t InitialCapacity;
+	size_t UsedBytes = 0;
+	size_t CapacityBytes = 0;
+	uint32 ChunkAllocationCount = 0;
+};
@@ -1,26 +1,236 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
 #include <cstddef>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
 
-uint32 CMemoryManager::TotalAllocationBytes = 0;
-uint32 CMemoryManager::TotalAllocationCount = 0;
-
-void* CMemoryManager::Allocate(size_t size)
+namespace
 {
-    size_t totalSize = size + sizeof(size_t);
+    class FSlabPool;
+
+    // 모든 블록 앞에 붙는 헤더. 16바이트라서 사용자 영역도 16바이트 정렬을 유지한다
+    struct alignas(16) FBlockHeader
+    {
+        FSlabPool* Owner;   // nullptr = 풀을 거치지 않은 큰 할당
+        uint32 Size;        // 요청 크기
+        uint32 Bucket;
+    };
+    static_assert(sizeof(FBlockHeader) == 16, "FBlockHeader must keep 16-byte alignment");
+
+    // 버킷: ~256B는 16B 간격, ~1KB는 64B 간격, ~4KB는 256B 간격 (내부 단편화 25% 이하)
+    constexpr uint32 BucketCount = 16 + 12 + 12;
+    constexpr size_t PageSize = 64 * 1024;
+
+    uint32 GetBucketIndex(size_t Size)
+    {
+        if (Size <= 256)
+        {
+            return Size == 0 ? 0 : static_cast<uint32>((Size + 15) / 16 - 1);
+        }
+        if (Size <= 1024)
+        {
+            return 16 + static_cast<uint32>((Size - 256 + 63) / 64 - 1);
+        }
+        return 28 + static_cast<uint32>((Size - 1024 + 255) / 256 - 1);
+    }
+
+    size_t GetBucketSize(uint32 Bucket)
+    {
+        if (Bucket < 16)
+        {
+            return (Bucket + 1) * 16;
+        }
+        if (Bucket < 28)
+        {
+            return 256 + (Bucket - 16 + 1) * 64;
+        }
+        return 1024 + (Bucket - 28 + 1) * 256;
+    }
+
+    void* RawAlloc(size_t Size)
+    {
 #if defined(_MSC_VER) && defined(_DEBUG)
-    void* raw = _malloc_dbg(totalSize, _NORMAL_BLOCK, nullptr, 0);
+        return _malloc_dbg(Size, _NORMAL_BLOCK, nullptr, 0);
 #else
-    void* raw = std::malloc(totalSize);
+        return std::malloc(Size);
 #endif
-    if (!raw)
+    }
+
+    void RawFree(void* Ptr)
+    {
+#if defined(_MSC_VER) && defined(_DEBUG)
+        _free_dbg(Ptr, _NORMAL_BLOCK);
+#else
+        std::free(Ptr);
+#endif
+    }
+
+    std::atomic<uint64> GTotalAllocationBytes{ 0 };
+    std::atomic<uint32> GTotalAllocationCount{ 0 };
+    std::atomic<uint64> GPoolReservedBytes{ 0 };
+    std::atomic<uint64> GLargeAllocationBytes{ 0 };
+    std::atomic<uint32> GLargeAllocationCount{ 0 };
+    std::atomic<uint64> GAllocationEventCount{ 0 };
+    std::atomic<uint64> GGlobalHeapAllocationCount{ 0 };
+    thread_local uint64 GThreadHeapAllocationCount = 0;
+#ifdef _DEBUG
+    std::atomic<bool> GGlobalHeapCountingEnabled{ true };
+#else
+    std::atomic<bool> GGlobalHeapCountingEnabled{ false };
+#endif
+
+    // 버킷별 슬랩 풀 묶음. 전역 풀 1개 + PIE 아레나
+    class FSlabPool
+    {
+    public:
+        ~FSlabPool()
+        {
+            for (FBucket& Bucket : Buckets)
+            {
+                for (void* Page : Bucket.Pages)
+                {
+                    RawFree(Page);
+                }
+                GPoolReservedBytes -= Bucket.Pages.Num() * PageSize;
+            }
+        }
+
+        FBlockHeader* AllocateBlock(uint32 BucketIndex)
+        {
+            FBucket& Bucket = Buckets[BucketIndex];
+            std::lock_guard<std::mutex> Lock(Bucket.Mutex);
+
+            if (!Bucket.FreeList && !AddPage(Bucket, BucketIndex))
+            {
+                return nullptr;
+            }
+
+            FFreeBlock* Block = Bucket.FreeList;
+            Bucket.FreeList = Block->Next;
+            RefCount.fetch_add(1, std::memory_order_relaxed);
+
+            FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(Block);
+            Header->Owner = this;
+            Header->Bucket = BucketIndex;
+            return Header;
+        }
+
+        // @return 해제 후 남은 참조 수. 0이면 호출자가 풀을 삭제해야 한다 (이후 풀에 접근 금지)
+        uint32 FreeBlock(FBlockHeader* Header)
+        {
+            FBucket& Bucket = Buckets[Header->Bucket];
+            {
+                std::lock_guard<std::mutex> Lock(Bucket.Mutex);
+                FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Header);
+                Block->Next = Bucket.FreeList;
+                Bucket.FreeList = Block;
+            }
+            return RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        }
+
+        // 소유 참조 반납 (ReleaseArena). @return FreeBlock과 같다
+        uint32 ReleaseOwnership()
+        {
+            return RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        }
+
+        uint32 GetLiveCount() const { return RefCount.load(std::memory_order_relaxed) - 1; }
+
+        uint64 GetReservedBytes() const { return ReservedBytes.load(); }
+
+    private:
+        struct FFreeBlock
+        {
+            FFreeBlock* Next;
+        };
+
+        struct FBucket
+        {
+            std::mutex Mutex;
+            FFreeBlock* FreeList = nullptr;
+            TArray<void*> Pages;
+        };
+
+        // 페이지 하나를 블록으로 쪼개 free list에 연결한다 (버킷 lock 보유 상태에서 호출)
+        bool AddPage(FBucket& Bucket, uint32 BucketIndex)
+        {
+            unsigned char* Page = static_cast<unsigned char*>(RawAlloc(PageSize));
+            if (!Page)
+            {
+                return false;
+            }
+            Bucket.Pages.Add(Page);
+            ReservedBytes += PageSize;
+            GPoolReservedBytes += PageSize;
+
+            const size_t BlockSize = sizeof(FBlockHeader) + GetBucketSize(BucketIndex);
+            const size_t BlockCount = PageSize / BlockSize;
+            for (size_t i = BlockCount; i-- > 0;)
+            {
+                FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Page + i * BlockSize);
+                Block->Next = Bucket.FreeList;
+                Bucket.FreeList = Block;
+            }
+            return true;
+        }
+
+        FBucket Buckets[BucketCount];
+        std::atomic<uint64> ReservedBytes{ 0 };
+        // 살아 있는 블록 수 + 소유 참조 1. 전역 풀은 소유 참조를 반납하지 않고, 아레나는 ReleaseArena에서 반납한다.
+        // 마지막 블록 해제와 ReleaseArena가 겹쳐도 감소는 원자적이므로 0을 본 쪽 하나만 풀을 삭제한다
+        std::atomic<uint32> RefCount{ 1 };
+    };
+
+    // 전역 풀은 종료 시점까지 살아 있어야 하므로(정적 소멸 이후 해제되는 UObject 대비) 의도적으로 해제하지 않는다
+    FSlabPool& GetGlobalPool()
+    {
+        static FSlabPool* GlobalPool = new FSlabPool();
+        return *GlobalPool;
+    }
+
+    bool GArenaModeEnabled = false;
+    // 할당을 받는 아레나 (BeginArena ~ EndArena)
+    std::atomic<FSlabPool*> GActiveArena{ nullptr };
+    // 아직 ReleaseArena되지 않은 아레나
+    FSlabPool* GCurrentArena = nullptr;
+}
+
+void* CMemoryManager::Allocate(size_t size)
+{
+    FBlockHeader* Header = nullptr;
+    if (size <= MaxPooledSize)
+    {
+        FSlabPool* Pool = GActiveArena.load(std::memory_order_acquire);
+        if (!Pool)
+        {
+            Pool = &GetGlobalPool();
+        }
+        Header = Pool->AllocateBlock(GetBucketIndex(size));
+    }
+    else
+    {
+        Header = static_cast<FBlockHeader*>(RawAlloc(sizeof(FBlockHeader) + size));
+        if (Header)
+        {
+            Header->Owner = nullptr;
+            Header->Bucket = UINT32_MAX;
+            GLargeAllocationBytes += size;
+            ++GLargeAllocationCount;
+        }
+    }
+
+    if (!Header)
         return nullptr;
 
-    *reinterpret_cast<size_t*>(raw) = size;
-    TotalAllocationBytes += static_cast<uint32>(size);
-    TotalAllocationCount++;
+    Header->Size = static_cast<uint32>(size);
+    GTotalAllocationBytes += size;
+    ++GTotalAllocationCount;
+    GAllocationEventCount.fetch_add(1, std::memory_order_relaxed);
 
-    return static_cast<void*>(static_cast<unsigned char*>(raw) + sizeof(size_t));
+    return Header + 1;
 }
 
 void CMemoryManager::Deallocate(void* ptr)
@@ -28,17 +238,317 @@ void CMemoryManager::Deallocate(void* ptr)
     if (!ptr)
         return;
 
-    unsigned char* userPtr = static_cast<unsigned char*>(ptr);
-    unsigned char* raw = userPtr - sizeof(size_t);
-    size_t size = *reinterpret_cast<size_t*>(raw);
+    FBlockHeader* Header = static_cast<FBlockHeader*>(ptr) - 1;
+    const size_t Size = Header->Size;
 
-    TotalAllocationBytes -= static_cast<uint32>(size);
-    TotalAllocationCount--;
-#if defined(_MSC_VER) && defined(_DEBUG)
-    _free_dbg(raw, _NORMAL_BLOCK);
+    GTotalAllocationBytes -= Size;
+    --GTotalAllocationCount;
+
+    FSlabPool* Owner = Header->Owner;
+    if (!Owner)
+    {
+        GLargeAllocationBytes -= Size;
+        --GLargeAllocationCount;
+        RawFree(Header);
+        return;
+    }
+
+    if (Owner->FreeBlock(Header) == 0)
+    {
+        // ReleaseArena 이후까지 남아 있던 마지막 아레나 블록
+        delete Owner;
+    }
+}
+
+uint64 CMemoryManager::GetTotalAllocationBytes()
+{
+    return GTotalAllocationBytes.load(std::memory_order_relaxed);
+}
+
+uint32 CMemoryManager::GetTotalAllocationCount()
+{
+    return GTotalAllocationCount.load(std::memory_order_relaxed);
+}
+
+uint64 CMemoryManager::GetPoolReservedBytes()
+{
+    return GPoolReservedBytes.load(std::memory_order_relaxed);
+}
+
+uint64 CMemoryManager::GetLargeAllocationBytes()
+{
+    return GLargeAllocationBytes.load(std::memory_order_relaxed);
+}
+
+uint32 CMemoryManager::GetLargeAllocationCount()
+{
+    return GLargeAllocationCount.load(std::memory_order_relaxed);
+}
+
+uint64 CMemoryManager::GetAllocationEventCount()
+{
+    return GAllocationEventCount.load(std::memory_order_relaxed);
+}
+
+uint64 CMemoryManager::GetGlobalHeapAllocationCount()
+{
+    return GGlobalHeapAllocationCount.load(std::memory_order_relaxed);
+}
+
+uint64 CMemoryManager::GetThreadHeapAllocationCount()
+{
+    return GThreadHeapAllocationCount;
+}
+
+void CMemoryManager::SetGlobalHeapCountingEnabled(bool bEnabled)
+{
+    GGlobalHeapCountingEnabled.store(bEnabled && IsGlobalHeapCountingSupported(), std::memory_order_relaxed);
+}
+
+bool CMemoryManager::IsGlobalHeapCountingEnabled()
+{
+    return GGlobalHeapCountingEnabled.load(std::memory_order_relaxed);
+}
+
+void CMemoryManager::SetArenaModeEnabled(bool bEnabled)
+{
+    GArenaModeEnabled = bEnabled;
+}
+
+bool CMemoryManager::IsArenaModeEnabled()
+{
+    return GArenaModeEnabled;
+}
+
+void CMemoryManager::BeginArena()
+{
+    if (!GArenaModeEnabled || GCurrentArena)
+        return;
+
+    GCurrentArena = new FSlabPool();
+    GActiveArena.store(GCurrentArena, std::memory_order_release);
+}
+
+void CMemoryManager::EndArena()
+{
+    GActiveArena.store(nullptr, std::memory_order_release);
+}
+
+void CMemoryManager::ReleaseArena()
+{
+    EndArena();
+
+    FSlabPool* Arena = GCurrentArena;
+    if (!Arena)
+        return;
+    GCurrentArena = nullptr;
+
+    // 반납 이후에는 다른 스레드가 마지막 블록을 해제하며 삭제할 수 있으므로 Arena에 접근하지 않는다
+    const uint32 LiveCount = Arena->ReleaseOwnership();
+    if (LiveCount == 0)
+    {
+        delete Arena;
+    }
+    else
+    {
+        // 아레나 구간에 생성되어 월드 밖에서 참조되는 오브젝트(예: PIE 중 로드된 리소스)가 있다
+        UE_LOG("[Memory] PIE arena: %u objects still alive, page release deferred", LiveCount);
+    }
+}
+
+bool CMemoryManager::IsArenaActive()
+{
+    return GActiveArena.load(std::memory_order_relaxed) != nullptr;
+}
+
+uint32 CMemoryManager::GetArenaLiveCount()
+{
+    return GCurrentArena ? GCurrentArena->GetLiveCount() : 0;
+}
+
+uint64 CMemoryManager::GetArenaReservedBytes()
+{
+    return GCurrentArena ? GCurrentArena->GetReservedBytes() : 0;
+}
+
+int32 CMemoryManager::VerifyArenaCycles(int32 Cycles, int32 BlocksPerCycle)
+{
+    // 진행 중인 PIE 아레나를 건드리지 않는다
+    if (GCurrentArena || Cycles <= 0 || BlocksPerCycle <= 0)
+        return GCurrentArena ? -1 : 0;
+
+    const bool bSavedArenaMode = GArenaModeEnabled;
+    GArenaModeEnabled = true;
+
+    // 검증 중에 다른 스레드가 UObject를 할당하지 않는다고 가정한다 (메인 스레드 콘솔 명령에서 호출)
+    const uint32 BaseCount = GetTotalAllocationCount();
+    const uint64 BaseBytes = GetTotalAllocationBytes();
+    const uint64 BaseReserved = GetPoolReservedBytes();
+
+    constexpr int32 WorkerCount = 4;
+    int32 FailedCycles = 0;
+    TArray<void*> Blocks;
+    Blocks.reserve(BlocksPerCycle);
+
+    for (int32 Cycle = 0; Cycle < Cycles; ++Cycle)
+    {
+        bool bPassed = true;
+
+        BeginArena();
+        for (int32 i = 0; i < BlocksPerCycle; ++i)
+        {
+            // 모든 버킷을 고루 거치도록 크기를 바꿔 가며 할당하고, 사용자 영역 끝까지 써 본다
+            const size_t Size = (static_cast<size_t>(i) * 37 + Cycle) % MaxPooledSize + 1;
+            void* Ptr = Allocate(Size);
+            if (!Ptr)
+            {
+                bPassed = false;
+                continue;
+            }
+            std::memset(Ptr, 0xCD, Size);
+            Blocks.Add(Ptr);
+        }
+        bPassed &= GetArenaLiveCount() == static_cast<uint32>(Blocks.Num());
+        EndArena();
+
+        if (Cycle % 2 == 0)
+        {
+            // 즉시 반환 경로: 모든 블록을 먼저 해제한 뒤 ReleaseArena
+            for (void* Ptr : Blocks)
+            {
+                Deallocate(Ptr);
+            }
+            bPassed &= GetArenaLiveCount() == 0;
+            ReleaseArena();
+        }
+        else
+        {
+            // 지연 반환 경로: 절반만 해제하고 ReleaseArena, 남은 블록은 여러 스레드가 동시에 해제해 마지막 해제가 아레나를 삭제한다
+            const int32 HalfCount = Blocks.Num() / 2;
+            for (int32 i = 0; i < HalfCount; ++i)
+            {
+                Deallocate(Blocks[i]);
+            }
+            ReleaseArena();
+
+            const int32 RemainingCount = Blocks.Num() - HalfCount;
+            TArray<std::thread> Workers;
+            for (int32 Worker = 0; Worker < WorkerCount; ++Worker)
+            {
+                const int32 Begin = HalfCount + RemainingCount * Worker / WorkerCount;
+                const int32 End = HalfCount + RemainingCount * (Worker + 1) / WorkerCount;
+                Workers.emplace_back([&Blocks, Begin, End]()
+                {
+                    for (int32 i = Begin; i < End; ++i)
+                    {
+                        Deallocate(Blocks[i]);
+                    }
+                });
+            }
+            for (std::thread& Worker : Workers)
+            {
+                Worker.join();
+            }
+        }
+        Blocks.clear();
+
+        // 아레나가 삭제되어야 예약 페이지가 시작 값으로 돌아온다
+        bPassed &= GetTotalAllocationCount() == BaseCount;
+        bPassed &= GetTotalAllocationBytes() == BaseBytes;
+        bPassed &= GetPoolReservedBytes() == BaseReserved;
+        FailedCycles += bPassed ? 0 : 1;
+    }
+
+    GArenaModeEnabled = bSavedArenaMode;
+    return FailedCycles;
+}
+
+// UObject 할당은 클래스별 operator로 CMemoryManager를 거친다.
+// 전역 operator new/delete는 MUNDI_COUNT_HEAP_ALLOCS 빌드에서 대체하며, 라우팅 없이 CRT 힙으로 넘기고 집계가 켜진 동안 호출 횟수만 센다.
+#if MUNDI_COUNT_HEAP_ALLOCS
+namespace
+{
+    inline void CountHeapAllocation()
+    {
+        if (GGlobalHeapCountingEnabled.load(std::memory_order_relaxed))
+        {
+            GGlobalHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+            ++GThreadHeapAllocationCount;
+        }
+    }
+
+    void* CountedHeapAlloc(size_t Size)
+    {
+        CountHeapAllocation();
+        return RawAlloc(Size ? Size : 1);
+    }
+
+    void* CountedAlignedHeapAlloc(size_t Size, std::align_val_t Alignment)
+    {
+        CountHeapAllocation();
+        const size_t Align = static_cast<size_t>(Alignment);
+#if defined(_MSC_VER)
+        return _aligned_malloc(Size ? Size : 1, Align);
 #else
-    std::free(raw);
+        return std::aligned_alloc(Align, (FMath::Max(Size, size_t(1)) + Align - 1) & ~(Align - 1));
 #endif
+    }
+
+    void AlignedHeapFree(void* Ptr)
+    {
+#if defined(_MSC_VER)
+        _aligned_free(Ptr);
+#else
+        std::free(Ptr);
+#endif
+    }
+}
+
+void* operator new(size_t Size)
+{
+    if (void* Ptr = CountedHeapAlloc(Size))
+        return Ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t Size)
+{
+    if (void* Ptr = CountedHeapAlloc(Size))
+        return Ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t Size, const std::nothrow_t&) noexcept { return CountedHeapAlloc(Size); }
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept { return CountedHeapAlloc(Size); }
+
+void operator delete(void* Ptr) noexcept { if (Ptr) RawFree(Ptr); }
+void operator delete[](void* Ptr) noexcept { if (Ptr) RawFree(Ptr); }
+void operator delete(void* Ptr, size_t) noexcept { if (Ptr) RawFree(Ptr); }
+void operator delete[](void* Ptr, size_t) noexcept { if (Ptr) RawFree(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { if (Ptr) RawFree(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { if (Ptr) RawFree(Ptr); }
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+    if (void* Ptr = CountedAlignedHeapAlloc(Size, Alignment))
+        return Ptr;
+    throw std::bad_alloc();
 }
 
-// Global operators removed. Allocation is scoped to UObject via class-specific operators.
+void* operator new[](size_t Size, std::align_val_t Alignment)
+{
+    if (void* Ptr = CountedAlignedHeapAlloc(Size, Alignment))
+        return Ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return CountedAlignedHeapAlloc(Size, Alignment); }
+void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return CountedAlignedHeapAlloc(Size, Alignment); }
+
+void operator delete(void* Ptr, std::align_val_t) noexcept { AlignedHeapFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { AlignedHeapFree(Ptr); }
+void operator delete(void* Ptr, size_t, std::align_val_t) noexcept { AlignedHeapFree(Ptr); }
+void operator delete[](void* Ptr, size_t, std::align_val_t) noexcept { AlignedHeapFree(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { AlignedHeapFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { AlignedHeapFree(Ptr); }
+#endif // MUNDI_COUNT_HEAP_ALLOCS
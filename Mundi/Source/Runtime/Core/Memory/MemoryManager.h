@@ -10,12 +10,70 @@
 #   include <crtdbg.h>
 #endif
 
+// 전역 operator new/delete 호출 횟수 집계 (개발용 계측). 모든 빌드에 들어가며 집계 자체는 런타임 스위치로 켠다
+// (기본: Debug 켜짐, Release 꺼짐 → 꺼져 있으면 할당마다 플래그 한 번 읽는 비용뿐). 0으로 정의하면 대체 연산자를 빼고 CRT 기본 연산자를 쓴다
+#ifndef MUNDI_COUNT_HEAP_ALLOCS
+#   define MUNDI_COUNT_HEAP_ALLOCS 1
+#endif
+
+/**
+ * UObject 전용 할당기
+ *
+ * - 크기 구간(버킷)별 슬랩 풀: 64KB 페이지를 같은 크기 블록으로 쪼개 두고 해제된 블록은 버킷 free list로 돌려 재사용한다.
+ *   MaxPooledSize보다 큰 요청만 malloc으로 보낸다
+ * - 모든 블록 앞에 16바이트 헤더(소유 풀, 요청 크기, 버킷)를 두므로 반환 주소는 16바이트 정렬이 유지된다
+ * - 통계는 atomic이라 어느 스레드에서 할당/해제해도 안전하다 (버킷은 각자의 mutex로 보호)
+ * - 아레나 모드: BeginArena ~ EndArena 사이의 할당은 별도 슬랩 풀(아레나)로 가고,
+ *   ReleaseArena 시점에 아레나 페이지를 한 번에 반환한다 (PIE 월드 수명용)
+ * - MUNDI_COUNT_HEAP_ALLOCS 빌드(기본)에서는 전역 operator new/delete를 malloc/free로 그대로 넘기며,
+ *   SetGlobalHeapCountingEnabled로 켠 동안 호출 횟수를 전역/스레드별로 센다 (렌더링 중 힙 할당 확인용)
+ */
 class CMemoryManager
 {
 public:
-    static uint32 TotalAllocationBytes;
-    static uint32 TotalAllocationCount;
-
     static void* Allocate(size_t size);
     static void Deallocate(void* ptr);
-};
\ No newline at end of file
+
+    // ===== 통계 (살아 있는 블록 기준) =====
+    static uint64 GetTotalAllocationBytes();
+    static uint32 GetTotalAllocationCount();
+    // 슬랩 페이지로 확보한 바이트 (전역 풀 + 현재/보류 중인 아레나)
+    static uint64 GetPoolReservedBytes();
+    // 풀을 거치지 않은 큰 할당
+    static uint64 GetLargeAllocationBytes();
+    static uint32 GetLargeAllocationCount();
+
+    // ===== 누적 할당 횟수 (구간 전후 값의 차로 사용) =====
+    // CMemoryManager::Allocate 호출 횟수 (UObject)
+    static uint64 GetAllocationEventCount();
+    // 전역 operator new 호출 횟수 (TArray, FString 등 모든 C++ 힙 할당). 집계가 꺼져 있던 동안의 할당은 빠진다
+    static uint64 GetGlobalHeapAllocationCount();
+    // 호출한 스레드의 operator new 호출 횟수 (다른 스레드 할당이 섞이지 않아야 하는 구간 측정용)
+    static uint64 GetThreadHeapAllocationCount();
+    static constexpr bool IsGlobalHeapCountingSupported() { return MUNDI_COUNT_HEAP_ALLOCS != 0; }
+    static void SetGlobalHeapCountingEnabled(bool bEnabled);
+    static bool IsGlobalHeapCountingEnabled();
+
+    // ===== 아레나 (PIE) =====
+    static void SetArenaModeEnabled(bool bEnabled);
+    static bool IsArenaModeEnabled();
+
+    // 아레나 모드가 켜져 있으면 새 아레나를 만들고 이후 할당을 그쪽으로 보낸다
+    static void BeginArena();
+    // 할당 라우팅만 끝낸다. 아레나 블록은 여전히 유효하다
+    static void EndArena();
+    // 아레나 페이지 일괄 반환. 아직 살아 있는 블록이 있으면 마지막 블록이 해제될 때까지 미룬다
+    static void ReleaseArena();
+
+    static bool IsArenaActive();
+    static uint32 GetArenaLiveCount();
+    static uint64 GetArenaReservedBytes();
+
+    // 아레나 검증 (콘솔용): Begin/End/Release 주기를 Cycles번 반복하며 주기마다 BlocksPerCycle개를 할당/해제한다.
+    // 홀수 주기는 ReleaseArena 이후 작업 스레드들이 남은 블록을 동시에 해제해 지연 삭제 경로를 거친다.
+    // 주기가 끝날 때 살아 있는 블록 수, 할당 통계, 예약 페이지가 시작 값으로 돌아와야 통과
+    // @return 실패한 주기 수. PIE 아레나가 열려 있어 수행하지 못하면 -1
+    static int32 VerifyArenaCycles(int32 Cycles, int32 BlocksPerCycle);
+
+    static constexpr size_t MaxPooledSize = 4096;
+};
@@ -11,10 +11,14 @@ public:
     virtual ~FArchive() {}
 
     virtual void Serialize(void* Data, int64 Length) = 0;
-    /*virtual void Seek(size_t Position) = 0;
-    virtual size_t Tell() const = 0;*/
+    virtual void Seek(int64 Position) = 0;
+    virtual int64 Tell() const = 0;
     virtual bool Close() = 0;
 
+    // 현재 위치의 Length 바이트를 복사 없이 가리키는 포인터를 반환하고 그만큼 전진한다.
+    // 메모리 매핑 아카이브만 지원하며, 그 외에는 nullptr (호출자는 Serialize로 복사해야 함)
+    virtual const void* MapRegion(int64 Length) { return nullptr; }
+
     // 상태 확인 함수
     bool IsLoading() const { return bIsLoading; }
     bool IsSaving() const { return bIsSaving; }
@@ -44,11 +48,9 @@ namespace Serialization
             Ar.Serialize((void*)Str.data(), Len);
     }
 
-    inline void ReadString(FArchive& Ar, FString& Str)
+    // 길이를 이미 읽은 경우 (구버전 캐시 헤더 판별 등) 본문만 읽는다.
+    inline void ReadStringOfLength(FArchive& Ar, FString& Str, uint32 Len)
     {
-        uint32 Len;
-        Ar << Len;
-
         // Sanity Check: 비정상적인 크기의 문자열 할당 시도 방지
         if (Len > MAX_REASONABLE_ARRAY_SIZE)
         {
@@ -60,6 +62,13 @@ namespace Serialization
             Ar.Serialize(&Str[0], Len);
     }
 
+    inline void ReadString(FArchive& Ar, FString& Str)
+    {
+        uint32 Len;
+        Ar << Len;
+        ReadStringOfLength(Ar, Str, Len);
+    }
+
     template<typename T>
     inline void WriteArray(FArchive& Ar, const TArray<T>& Arr)
     {
@@ -85,4 +94,97 @@ namespace Serialization
         if (Count > 0)
             Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
     }
+
+    // 벌크 블록 시작 정렬. 매핑된 영역을 그대로 T*로 쓰려면 파일 내 오프셋도 alignof(T)를 만족해야 한다.
+    constexpr int64 BulkDataAlignment = 16;
+
+    inline void AlignArchive(FArchive& Ar)
+    {
+        const int64 Position = Ar.Tell();
+        const int64 Padding = (BulkDataAlignment - (Position % BulkDataAlignment)) % BulkDataAlignment;
+        if (Padding == 0)
+            return;
+
+        if (Ar.IsSaving())
+        {
+            uint8 Zeros[BulkDataAlignment] = {};
+            Ar.Serialize(Zeros, Padding);
+        }
+        else
+        {
+            Ar.Seek(Position + Padding);
+        }
+    }
+
+    template<typename T>
+    inline void WriteAlignedArray(FArchive& Ar, const TArray<T>& Arr)
+    {
+        uint32 Count = (uint32)Arr.size();
+        Ar << Count;
+        AlignArchive(Ar);
+        if (Count > 0)
+            Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
+    }
+
+    template<typename T>
+    inline void ReadAlignedArray(FArchive& Ar, TArray<T>& Arr)
+    {
+        uint32_t Count;
+        Ar << Count;
+        if (Count > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Aligned array size is unreasonable.");
+        }
+
+        AlignArchive(Ar);
+        Arr.resize(Count);
+        if (Count > 0)
+            Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
+    }
+
+    /**
+     * WriteAlignedArray로 쓴 블록을 복사 없이 가리킨다 (매핑된 아카이브 전용).
+     * @return 아카이브가 MapRegion을 지원하지 않으면 false (위치는 블록 시작에 그대로 둔다)
+     */
+    template<typename T>
+    inline bool ViewAlignedArray(FArchive& Ar, const T*& OutData, uint32& OutCount)
+    {
+        const int64 Start = Ar.Tell();
+
+        uint32_t Count;
+        Ar << Count;
+        if (Count > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Aligned array size is unreasonable.");
+        }
+
+        AlignArchive(Ar);
+        const void* Region = Ar.MapRegion(static_cast<int64>(sizeof(T)) * Count);
+        if (!Region)
+        {
+            Ar.Seek(Start);
+            return false;
+        }
+
+        OutData = static_cast<const T*>(Region);
+        OutCount = Count;
+        return true;
+    }
+
+    // 요소별 operator<< 로 읽는다. 구버전 캐시 마이그레이션 전용 (신규 포맷은 ReadArray의 단일 블록 사용)
+    template<typename T>
+    inline void ReadArrayPerElement(FArchive& Ar, TArray<T>& Arr)
+    {
+        uint32_t Count;
+        Ar << Count;
+
+        if (Count > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Legacy array size is unreasonable.");
+        }
+
+        Arr.resize(Count);
+        for (T& Element : Arr)
+            Ar << Element;
+    }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 //#include "Enums.h"
 #include "Archive.h"
 #include <d3d11.h>
+#include <type_traits>
 
 struct FMaterialInfo
 {
@@ -150,21 +151,51 @@ struct FNormalVertex
     }
 };
 
-// Template specialization for TArray<FNormalVertex> to force element-by-element serialization
-namespace Serialization {
-    template<>
-    inline void WriteArray<FNormalVertex>(FArchive& Ar, const TArray<FNormalVertex>& Arr) {
-        uint32 Count = (uint32)Arr.size();
-        Ar << Count;
-        for (const auto& Vtx : Arr) Ar << const_cast<FNormalVertex&>(Vtx);
+// 캐시 v2부터 TArray<FNormalVertex>는 메모리 레이아웃 그대로 한 블록으로 직렬화된다.
+// (operator<<의 멤버별 순서는 구버전 캐시 마이그레이션에만 사용)
+static_assert(std::is_trivially_copyable_v<FNormalVertex>, "FNormalVertex must stay POD for bulk cache serialization");
+static_assert(sizeof(FNormalVertex) == 64, "FNormalVertex layout changed: bump Serialization::MeshCacheVersion");
+
+namespace Serialization
+{
+    // 메시 캐시(.sm.bin / .sk.bin) 헤더 매직 ('MESH')
+    // 구버전 캐시는 헤더 없이 PathFileName 길이로 시작하므로, MAX_REASONABLE_ARRAY_SIZE보다 큰 값으로 두 포맷을 구분한다.
+    constexpr uint32 MeshCacheMagic = 0x4853454D;
+
+    // 1 : 헤더 없음, 정점/본을 요소별로 직렬화 (구버전)
+    // 2 : 정점/인덱스/스킨 정점/본 행렬을 연속 POD 블록으로 직렬화
+    constexpr uint32 LegacyMeshCacheVersion = 1;
+    constexpr uint32 MeshCacheVersion = 2;
+
+    inline void WriteMeshCacheHeader(FArchive& Ar)
+    {
+        uint32 Magic = MeshCacheMagic;
+        uint32 Version = MeshCacheVersion;
+        Ar << Magic;
+        Ar << Version;
     }
 
-    template<>
-    inline void ReadArray<FNormalVertex>(FArchive& Ar, TArray<FNormalVertex>& Arr) {
-        uint32 Count;
-        Ar << Count;
-        Arr.resize(Count);
-        for (auto& Vtx : Arr) Ar << Vtx;
+    /**
+     * @brief 메시 캐시 헤더를 읽고 포맷 버전을 반환합니다.
+     * 구버전 캐시라면 이미 읽은 첫 4바이트가 PathFileName 길이이므로 OutLegacyPathLength로 돌려줍니다.
+     */
+    inline uint32 ReadMeshCacheHeader(FArchive& Ar, uint32& OutLegacyPathLength)
+    {
+        uint32 First = 0;
+        Ar << First;
+        if (First != MeshCacheMagic)
+        {
+            OutLegacyPathLength = First;
+            return LegacyMeshCacheVersion;
+        }
+
+        uint32 Version = 0;
+        Ar << Version;
+        if (Version != MeshCacheVersion)
+        {
+            throw std::runtime_error("Cache incompatible: Unknown mesh cache version.");
+        }
+        return Version;
     }
 }
 
@@ -181,10 +212,14 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // 로드한 캐시의 포맷 버전 (직렬화 대상 아님). 구버전이면 로더가 캐시를 다시 저장한다.
+    uint32 LoadedCacheVersion = Serialization::MeshCacheVersion;
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
         {
+            Serialization::WriteMeshCacheHeader(Ar);
             Serialization::WriteString(Ar, Mesh.PathFileName);
             Serialization::WriteArray(Ar, Mesh.Vertices);
             Serialization::WriteArray(Ar, Mesh.Indices);
@@ -197,8 +232,19 @@ struct FStaticMesh
         }
         else if (Ar.IsLoading())
         {
-            Serialization::ReadString(Ar, Mesh.PathFileName);
-            Serialization::ReadArray(Ar, Mesh.Vertices);
+            uint32 LegacyPathLength = 0;
+            Mesh.LoadedCacheVersion = Serialization::ReadMeshCacheHeader(Ar, LegacyPathLength);
+
+            if (Mesh.LoadedCacheVersion == Serialization::LegacyMeshCacheVersion)
+            {
+                Serialization::ReadStringOfLength(Ar, Mesh.PathFileName, LegacyPathLength);
+                Serialization::ReadArrayPerElement(Ar, Mesh.Vertices);
+            }
+            else
+            {
+                Serialization::ReadString(Ar, Mesh.PathFileName);
+                Serialization::ReadArray(Ar, Mesh.Vertices);
+            }
             Serialization::ReadArray(Ar, Mesh.Indices);
 
             uint32_t gCount;
@@ -284,6 +330,70 @@ struct FSkinnedVertex
     }
 };
 
+static_assert(std::is_trivially_copyable_v<FSkinnedVertex>, "FSkinnedVertex must stay POD for bulk cache serialization");
+
+namespace Serialization
+{
+    // 본 이름만 요소별로 쓰고, 부모 인덱스와 행렬 4종은 각각 연속 블록으로 쓴다.
+    inline void WriteBoneArray(FArchive& Ar, const TArray<FBoneInfo>& Bones)
+    {
+        uint32 BoneCount = (uint32)Bones.size();
+        Ar << BoneCount;
+
+        TArray<int32> ParentIndices;
+        TArray<FMatrix> Matrices;
+        ParentIndices.Reserve(BoneCount);
+        Matrices.Reserve(BoneCount * 4);
+        for (const FBoneInfo& Bone : Bones)
+        {
+            WriteString(Ar, Bone.BoneName);
+            ParentIndices.Add(Bone.ParentIndex);
+            Matrices.Add(Bone.BindPoseLocalTransform);
+            Matrices.Add(Bone.InverseBindPoseMatrix);
+            Matrices.Add(Bone.GlobalTransform);
+            Matrices.Add(Bone.SkinningMatrix);
+        }
+
+        WriteArray(Ar, ParentIndices);
+        WriteArray(Ar, Matrices);
+    }
+
+    inline void ReadBoneArray(FArchive& Ar, TArray<FBoneInfo>& Bones)
+    {
+        uint32 BoneCount;
+        Ar << BoneCount;
+        if (BoneCount > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Bone count is unreasonable.");
+        }
+
+        Bones.resize(BoneCount);
+        for (FBoneInfo& Bone : Bones)
+        {
+            ReadString(Ar, Bone.BoneName);
+        }
+
+        TArray<int32> ParentIndices;
+        TArray<FMatrix> Matrices;
+        ReadArray(Ar, ParentIndices);
+        ReadArray(Ar, Matrices);
+        if (ParentIndices.Num() != (int32)BoneCount || Matrices.Num() != (int32)BoneCount * 4)
+        {
+            throw std::runtime_error("Cache corrupt: Bone block size mismatch.");
+        }
+
+        for (uint32 i = 0; i < BoneCount; ++i)
+        {
+            FBoneInfo& Bone = Bones[i];
+            Bone.ParentIndex = ParentIndices[i];
+            Bone.BindPoseLocalTransform = Matrices[4 * i + 0];
+            Bone.InverseBindPoseMatrix = Matrices[4 * i + 1];
+            Bone.GlobalTransform = Matrices[4 * i + 2];
+            Bone.SkinningMatrix = Matrices[4 * i + 3];
+        }
+    }
+}
+
 //// Cooked Data
 struct FSkeletalMesh
 {
@@ -300,10 +410,14 @@ struct FSkeletalMesh
     TArray<FBoneInfo> Bones;           // Skeleton (Bone Hierarchy)
     TArray<FSkinnedVertex> SkinnedVertices;  // Skinning 정보가 포함된 정점들
 
+    // 로드한 캐시의 포맷 버전 (직렬화 대상 아님). 구버전이면 로더가 캐시를 다시 저장한다.
+    uint32 LoadedCacheVersion = Serialization::MeshCacheVersion;
+
     friend FArchive& operator<<(FArchive& Ar, FSkeletalMesh& Mesh)
     {
         if (Ar.IsSaving())
         {
+            Serialization::WriteMeshCacheHeader(Ar);
             Serialization::WriteString(Ar, Mesh.PathFileName);
             Serialization::WriteArray(Ar, Mesh.Vertices);
             Serialization::WriteArray(Ar, Mesh.Indices);
@@ -315,18 +429,25 @@ struct FSkeletalMesh
             Ar << Mesh.bHasMaterial;
 
             // Skeletal Mesh 전용 데이터
-            uint32_t boneCount = (uint32_t)Mesh.Bones.size();
-            Ar << boneCount;
-            for (auto& bone : Mesh.Bones) Ar << bone;
-
-            uint32_t skinnedVtxCount = (uint32_t)Mesh.SkinnedVertices.size();
-            Ar << skinnedVtxCount;
-            for (auto& vtx : Mesh.SkinnedVertices) Ar << vtx;
+            Serialization::WriteBoneArray(Ar, Mesh.Bones);
+            Serialization::WriteArray(Ar, Mesh.SkinnedVertices);
         }
         else if (Ar.IsLoading())
         {
-            Serialization::ReadString(Ar, Mesh.PathFileName);
-            Serialization::ReadArray(Ar, Mesh.Vertices);
+            uint32 LegacyPathLength = 0;
+            Mesh.LoadedCacheVersion = Serialization::ReadMeshCacheHeader(Ar, LegacyPathLength);
+            const bool bLegacy = (Mesh.LoadedCacheVersion == Serialization::LegacyMeshCacheVersion);
+
+            if (bLegacy)
+            {
+                Serialization::ReadStringOfLength(Ar, Mesh.PathFileName, LegacyPathLength);
+                Serialization::ReadArrayPerElement(Ar, Mesh.Vertices);
+            }
+            else
+            {
+                Serialization::ReadString(Ar, Mesh.PathFileName);
+                Serialization::ReadArray(Ar, Mesh.Vertices);
+            }
             Serialization::ReadArray(Ar, Mesh.Indices);
 
             uint32_t gCount;
@@ -337,15 +458,16 @@ struct FSkeletalMesh
             Ar << Mesh.bHasMaterial;
 
             // Skeletal Mesh 전용 데이터
-            uint32_t boneCount;
-            Ar << boneCount;
-            Mesh.Bones.resize(boneCount);
-            for (auto& bone : Mesh.Bones) Ar << bone;
-
-            uint32_t skinnedVtxCount;
-            Ar << skinnedVtxCount;
-            Mesh.SkinnedVertices.resize(skinnedVtxCount);
-            for (auto& vtx : Mesh.SkinnedVertices) Ar << vtx;
+            if (bLegacy)
+            {
+                Serialization::ReadArrayPerElement(Ar, Mesh.Bones);
+                Serialization::ReadArrayPerElement(Ar, Mesh.SkinnedVertices);
+            }
+            else
+            {
+                Serialization::ReadBoneArray(Ar, Mesh.Bones);
+                Serialization::ReadArray(Ar, Mesh.SkinnedVertices);
+            }
         }
         return Ar;
     }
@@ -555,7 +677,7 @@ enum class EEngineShowFlags : uint64
 
     SF_OctreeDebug = 1ull << 7,  // Show/hide octree debug bounds
     SF_BVHDebug = 1ull << 8,  // Show/hide BVH debug bounds
-    SF_Culling = 1ull << 9,          // Show/hide world grid
+    SF_Culling = 1ull << 9,          // Enable/disable component frustum culling
 
     SF_Decals = 1ull << 10,
     SF_Fog = 1ull << 11,
@@ -570,7 +692,7 @@ enum class EEngineShowFlags : uint64
     SF_SkeletalMesh = 1ull << 18,
 
     // Default enabled flags
-    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA | SF_Billboard | SF_SkeletalMesh,
+    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Culling | SF_Decals | SF_Fog | SF_FXAA | SF_Billboard | SF_SkeletalMesh,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
@@ -0,0 +1,159 @@
+﻿#include "pch.h"
+#include "MemoryMappedReader.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FMemoryMappedReader::FMemoryMappedReader(const FString& Filename)
+    : FArchive(true, false) // Loading 모드
+{
+#ifdef _WIN32
+    // 한글 경로 지원: UTF-8 → UTF-16
+    const FWideString WFilename = UTF8ToWide(Filename);
+    HANDLE File = CreateFileW(WFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(File, &FileSize))
+    {
+        CloseHandle(File);
+        return;
+    }
+
+    FileHandle = File;
+    Size = static_cast<int64>(FileSize.QuadPart);
+    bOpened = true;
+
+    // 크기 0인 파일은 매핑할 수 없으므로 열기만 성공 처리
+    if (Size == 0)
+    {
+        return;
+    }
+
+    HANDLE Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!Mapping)
+    {
+        Close();
+        return;
+    }
+    MappingHandle = Mapping;
+
+    Data = static_cast<const uint8*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!Data)
+    {
+        Close();
+    }
+#else
+    FileDescriptor = open(Filename.c_str(), O_RDONLY);
+    if (FileDescriptor < 0)
+    {
+        return;
+    }
+
+    struct stat FileStat;
+    if (fstat(FileDescriptor, &FileStat) != 0)
+    {
+        Close();
+        return;
+    }
+
+    Size = static_cast<int64>(FileStat.st_size);
+    bOpened = true;
+
+    if (Size == 0)
+    {
+        return;
+    }
+
+    void* Mapped = mmap(nullptr, static_cast<size_t>(Size), PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    if (Mapped == MAP_FAILED)
+    {
+        Close();
+        return;
+    }
+    Data = static_cast<const uint8*>(Mapped);
+#endif
+}
+
+void FMemoryMappedReader::Serialize(void* OutData, int64 Length)
+{
+    if (Length <= 0)
+        return;
+
+    if (Length > Size - Position)
+    {
+        throw std::runtime_error("Cache corrupt: Read past end of mapped file.");
+    }
+
+    std::memcpy(OutData, Data + Position, static_cast<size_t>(Length));
+    Position += Length;
+}
+
+void FMemoryMappedReader::Seek(int64 InPosition)
+{
+    if (InPosition < 0 || InPosition > Size)
+    {
+        throw std::runtime_error("Cache corrupt: Seek out of mapped file range.");
+    }
+    Position = InPosition;
+}
+
+const void* FMemoryMappedReader::MapRegion(int64 Length)
+{
+    if (Length < 0 || Length > Size - Position)
+    {
+        throw std::runtime_error("Cache corrupt: Mapped region exceeds file size.");
+    }
+
+    const void* Region = Data + Position;
+    Position += Length;
+    return Region;
+}
+
+bool FMemoryMappedReader::Close()
+{
+    const bool bWasOpen = bOpened;
+
+#ifdef _WIN32
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(MappingHandle));
+        MappingHandle = nullptr;
+    }
+    if (FileHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(FileHandle));
+        FileHandle = nullptr;
+    }
+#else
+    if (Data)
+    {
+        munmap(const_cast<uint8*>(Data), static_cast<size_t>(Size));
+    }
+    if (FileDescriptor >= 0)
+    {
+        close(FileDescriptor);
+        FileDescriptor = -1;
+    }
+#endif
+
+    Data = nullptr;
+    Size = 0;
+    Position = 0;
+    bOpened = false;
+    return bWasOpen;
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+#include "Archive.h"
+#include "UEContainer.h"
+
+/**
+ * 읽기 전용 메모리 매핑 기반 FArchive (DerivedDataCache 로드용)
+ * - Serialize는 매핑 영역에서 memcpy만 수행 (스트림 버퍼 경유 없음)
+ * - MapRegion으로 매핑 영역을 복사 없이 그대로 넘겨줄 수 있다. 이 경우 반환된 포인터는 Reader가 살아있는 동안만 유효하다.
+ * - 범위를 벗어난 읽기는 std::runtime_error (손상된 캐시 처리 경로와 동일)
+ */
+class FMemoryMappedReader : public FArchive
+{
+public:
+    FMemoryMappedReader(const FString& Filename);
+    ~FMemoryMappedReader() { Close(); }
+
+    FMemoryMappedReader(const FMemoryMappedReader&) = delete;
+    FMemoryMappedReader& operator=(const FMemoryMappedReader&) = delete;
+
+    bool IsOpen() const { return bOpened; }
+
+    void Serialize(void* OutData, int64 Length) override;
+    void Seek(int64 Position) override;
+    int64 Tell() const override { return Position; }
+    bool Close() override;
+
+    const void* MapRegion(int64 Length) override;
+
+    int64 GetSize() const { return Size; }
+    const uint8* GetData() const { return Data; }
+
+private:
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Position = 0;
+    bool bOpened = false;
+
+#ifdef _WIN32
+    void* FileHandle = nullptr;     // HANDLE
+    void* MappingHandle = nullptr;  // HANDLE
+#else
+    int FileDescriptor = -1;
+#endif
+};
@@ -2,19 +2,28 @@
 
 #include "ObjectFactory.h"
 
+/**
+ * TObject와 그 자손 클래스의 살아 있는 인스턴스를 순회한다.
+ * GUObjectArray 전체를 훑지 않고 클래스 트리 구간 [ClassTreeIndex, ClassTreeEnd)의 클래스별 인스턴스 목록만 돈다.
+ * 순회 중 해당 클래스 오브젝트를 삭제/생성하는 것은 지원하지 않는다 (swap-remove로 순서가 바뀜)
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
+		UClass* Class = TObject::StaticClass();
+		UClass::EnsureClassTree();
+		ClassIndex = Class->ClassTreeIndex;
+		ClassEnd = Class->ClassTreeEnd;
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++InstanceIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +31,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 ClassIndex/InstanceIndex는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(UClass::GetClassTree()[ClassIndex]->Instances[InstanceIndex]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +44,36 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassIndex != Other.ClassIndex || InstanceIndex != Other.InstanceIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		// 아직 순회할 클래스 구간이 남아 있는지 확인
+		return ClassIndex < ClassEnd;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 위치부터 시작하여 인스턴스가 남아 있는 다음 클래스를 찾는 헬퍼 함수
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		const TArray<UClass*>& ClassTree = UClass::GetClassTree();
+		while (ClassIndex < ClassEnd)
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			if (InstanceIndex < ClassTree[ClassIndex]->Instances.Num())
 			{
 				break;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			// 다음 (자손) 클래스로 이동
+			++ClassIndex;
+			InstanceIndex = 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	int32 ClassIndex = 0;
+	int32 ClassEnd = 0;
+	int32 InstanceIndex = -1;
 };
@@ -0,0 +1,179 @@
+﻿#include "pch.h"
+#include "ParallelFor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	// 현재 스레드가 ParallelFor 본문을 실행 중인지 (중첩 호출은 순차 실행)
+	thread_local bool GIsInParallelFor = false;
+
+	class FParallelForPool
+	{
+	public:
+		static FParallelForPool& Get()
+		{
+			static FParallelForPool Instance;
+			return Instance;
+		}
+
+		int32 GetThreadCount() const { return static_cast<int32>(Workers.size()) + 1; }
+
+		// 다른 작업이 실행 중이면 false (호출자가 순차 실행)
+		bool TryRun(int32 Num, int32 BatchSize, const std::function<void(int32, int32)>& Body, int32 MaxThreads)
+		{
+			std::unique_lock<std::mutex> SubmitLock(SubmitMutex, std::try_to_lock);
+			if (!SubmitLock.owns_lock())
+			{
+				return false;
+			}
+
+			const int32 BatchCount = (Num + BatchSize - 1) / BatchSize;
+			const int32 ThreadLimit = MaxThreads > 0 ? std::min(MaxThreads, GetThreadCount()) : GetThreadCount();
+
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				JobBody = &Body;
+				JobNum = Num;
+				JobBatchSize = BatchSize;
+				NextBatch.store(0, std::memory_order_relaxed);
+				// 배치 수보다 많은 워커를 깨울 필요는 없음
+				FreeSlots = std::min(ThreadLimit, BatchCount) - 1;
+				++Generation;
+			}
+			WakeCondition.notify_all();
+
+			ExecuteBatches(Body, Num, BatchSize);
+
+			// 더 이상 참여를 받지 않고, 이미 참여한 워커가 끝날 때까지 대기 (Body가 호출자 스택에 있음)
+			std::unique_lock<std::mutex> Lock(Mutex);
+			FreeSlots = 0;
+			DoneCondition.wait(Lock, [this]() { return ActiveWorkers == 0; });
+			JobBody = nullptr;
+			return true;
+		}
+
+	private:
+		FParallelForPool()
+		{
+			const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+			const int32 WorkerCount = std::max(HardwareThreads - 1, 0);
+			Workers.reserve(WorkerCount);
+			for (int32 i = 0; i < WorkerCount; ++i)
+			{
+				Workers.emplace_back([this]() { WorkerLoop(); });
+			}
+		}
+
+		~FParallelForPool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bShutdown = true;
+			}
+			WakeCondition.notify_all();
+			for (std::thread& Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+
+		void ExecuteBatches(const std::function<void(int32, int32)>& Body, int32 Num, int32 BatchSize)
+		{
+			GIsInParallelFor = true;
+			while (true)
+			{
+				const int32 Begin = NextBatch.fetch_add(BatchSize, std::memory_order_relaxed);
+				if (Begin >= Num)
+				{
+					break;
+				}
+				Body(Begin, std::min(Begin + BatchSize, Num));
+			}
+			GIsInParallelFor = false;
+		}
+
+		void WorkerLoop()
+		{
+			uint64 SeenGeneration = 0;
+			while (true)
+			{
+				const std::function<void(int32, int32)>* Body = nullptr;
+				int32 Num = 0;
+				int32 BatchSize = 1;
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					WakeCondition.wait(Lock, [&]() { return bShutdown || Generation != SeenGeneration; });
+					if (bShutdown)
+					{
+						return;
+					}
+
+					SeenGeneration = Generation;
+					if (FreeSlots <= 0)
+					{
+						continue;
+					}
+					--FreeSlots;
+					++ActiveWorkers;
+					Body = JobBody;
+					Num = JobNum;
+					BatchSize = JobBatchSize;
+				}
+
+				ExecuteBatches(*Body, Num, BatchSize);
+
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					--ActiveWorkers;
+				}
+				DoneCondition.notify_one();
+			}
+		}
+
+	private:
+		TArray<std::thread> Workers;
+
+		std::mutex SubmitMutex;
+		std::mutex Mutex;
+		std::condition_variable WakeCondition;
+		std::condition_variable DoneCondition;
+
+		// 현재 작업 (Mutex로 보호)
+		const std::function<void(int32, int32)>* JobBody = nullptr;
+		int32 JobNum = 0;
+		int32 JobBatchSize = 1;
+		int32 FreeSlots = 0;
+		int32 ActiveWorkers = 0;
+		uint64 Generation = 0;
+		bool bShutdown = false;
+
+		std::atomic<int32> NextBatch{ 0 };
+	};
+}
+
+void ParallelFor(int32 Num, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body, int32 MaxThreads)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+	BatchSize = std::max(BatchSize, 1);
+
+	// 배치가 하나뿐이거나 단일 스레드로 제한된 경우 풀을 거치지 않음
+	if (Num <= BatchSize || MaxThreads == 1 || GIsInParallelFor || !FParallelForPool::Get().TryRun(Num, BatchSize, Body, MaxThreads))
+	{
+		for (int32 Begin = 0; Begin < Num; Begin += BatchSize)
+		{
+			Body(Begin, std::min(Begin + BatchSize, Num));
+		}
+	}
+}
+
+int32 GetParallelForThreadCount()
+{
+	return FParallelForPool::Get().GetThreadCount();
+}
@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <functional>
+
+/**
+ * PPL(concurrency::parallel_for)에 의존하지 않는 병렬 루프
+ * 프로세스 전역 워커 스레드 풀을 재사용하며, 호출 스레드도 작업에 참여한다.
+ * 다른 ParallelFor가 실행 중일 때(중첩 호출 포함) 들어온 호출은 호출 스레드에서 순차 실행된다.
+ */
+
+// [0, Num)을 BatchSize 크기 구간으로 나눠 Body(Begin, End)를 실행한다.
+// MaxThreads > 0이면 참여 스레드 수(호출 스레드 포함)를 제한한다 (벤치마크/디버깅용).
+void ParallelFor(int32 Num, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body, int32 MaxThreads = 0);
+
+// 호출 스레드를 포함해 ParallelFor에 참여할 수 있는 최대 스레드 수
+int32 GetParallelForThreadCount();
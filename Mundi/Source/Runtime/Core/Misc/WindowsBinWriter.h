@@ -17,8 +17,8 @@ public:
     {
         File.write(reinterpret_cast<char*>(Data), Length);
     }
-    /*void Seek(size_t Position) override { File.seekp(Position); }
-    size_t Tell() const override { return (size_t)File.tellp(); }*/
+    void Seek(int64 Position) override { File.seekp(Position); }
+    int64 Tell() const override { return static_cast<int64>(File.tellp()); }
     bool Close() override
     {
         if (File.is_open()) { File.close(); return true; }
@@ -26,5 +26,6 @@ public:
     }
 
 private:
-    std::ofstream File;
+    // tellp()가 non-const라 Tell() const에서 쓰기 위해 mutable
+    mutable std::ofstream File;
 };
\ No newline at end of file
@@ -522,7 +522,6 @@ void AActor::DuplicateSubObjects()
 	bIsPicked = false;
 	bCanEverTick = true;
 	bHiddenInEditor = false;
-	bIsCulled = false;
 	World = nullptr; // PIE World는 복제 프로세스의 상위 레벨에서 설정해 주어야 합니다.
 
 	if (OwnedComponents.empty())
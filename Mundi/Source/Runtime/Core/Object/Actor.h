@@ -91,6 +91,10 @@ public:
     bool IsPendingKill() const { return bPendingKill; }
     void MarkPendingKill() { bPendingKill = true; }
 
+    // ===== 액터 풀 (UWorld가 관리) =====
+    bool IsPooled() const { return bPooled; }
+    void SetPooled(bool bInPooled) { bPooled = bInPooled; }
+
     // ───────────────
     // Transform API
     // ───────────────
@@ -131,15 +135,6 @@ public:
     virtual FAABB GetBounds() const { return FAABB(); }
     void SetIsPicked(bool picked) { bIsPicked = picked; }
     bool GetIsPicked() { return bIsPicked; }
-    void SetCulled(bool InCulled) 
-    { 
-        bIsCulled = InCulled;
-        if (SceneComponents.empty())
-        {
-            return;
-        }
-    }
-    bool GetCulled() { return bIsCulled; }
 
     // 가시성
     void SetActorHiddenInEditor(bool bNewHidden);
@@ -204,10 +199,10 @@ protected:
     bool bHiddenInEditor = false;
     bool bPendingDestroy = false;
     bool bPendingKill = false;  // 지연 삭제 플래그
+    bool bPooled = false;       // UWorld 액터 풀에 반납된 상태 (레벨/충돌/파티션에서 빠져 있음)
 
     bool bIsPicked = false;
     bool bCanEverTick = true;
-    bool bIsCulled = false;
 
     /** 게임 시작 여부 (델리게이트로 관리) */
     bool bGameStarted = false;
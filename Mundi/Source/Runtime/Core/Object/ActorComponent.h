@@ -38,6 +38,11 @@ public:
     virtual void OnUnregister();                       // 내부 훅 (오버라이드 지점)
     void DestroyComponent();                           // 소멸(EndPlay 포함)
 
+    // ─────────────── 액터 풀 (UWorld::ReleaseActor / AcquireActor)
+    // 월드 시스템(충돌, 라이트 등) 등록만 해제/복구한다. 부착 계층, 리소스, 게임 수명 상태는 그대로 둔다
+    virtual void OnActorPooled() {}
+    virtual void OnActorUnpooled() {}
+
     // ─────────────── 활성화/틱
     void SetActive(bool bNewActive) 
     { 
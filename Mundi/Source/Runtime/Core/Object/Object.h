@@ -29,6 +29,19 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 살아 있는 인스턴스 통계 (ObjectFactory 등록/삭제 시 갱신, 메인 스레드 전용)
+    uint32 LiveObjectCount = 0;
+    uint64 LiveObjectBytes = 0;
+
+    // 정확히 이 클래스인 살아 있는 인스턴스 목록 (ObjectFactory가 유지, 순서 없음)
+    TArray<UObject*> Instances;
+
+    // 클래스 트리 전위 순회 번호. 이 클래스와 자손 클래스는 GetClassTree()의 [ClassTreeIndex, ClassTreeEnd)에 연속으로 놓인다
+    mutable int32 ClassTreeIndex = -1;
+    mutable int32 ClassTreeEnd = -1;
+
+    inline static bool bClassTreeDirty = true;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, std::size_t z)
         :Name(n), Super(s), Size(z) {
@@ -36,11 +49,69 @@ struct UClass
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        // 클래스 트리가 최신이면 구간 검사 (부모 체인 순회 없음)
+        if (!bClassTreeDirty && ClassTreeIndex >= 0 && Base->ClassTreeIndex >= 0)
+            return Base->ClassTreeIndex <= ClassTreeIndex && ClassTreeIndex < Base->ClassTreeEnd;
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
     }
 
+    // 전위 순회 순서의 클래스 트리 (등록되지 않은 조상인 UObject 포함). EnsureClassTree 이후 유효
+    static TArray<UClass*>& GetClassTree()
+    {
+        static TArray<UClass*> ClassTree;
+        return ClassTree;
+    }
+
+    // 새 클래스가 등록되었으면 트리 번호를 다시 매긴다 (메인 스레드에서 호출)
+    static void EnsureClassTree()
+    {
+        if (bClassTreeDirty)
+        {
+            RebuildClassTree();
+        }
+    }
+
+    static void RebuildClassTree()
+    {
+        // 등록된 클래스와 그 조상들을 모아 부모 → 자식 목록 구성
+        TArray<UClass*> Roots;
+        TMap<const UClass*, TArray<UClass*>> Children;
+        TSet<const UClass*> Visited;
+        for (UClass* Class : GetAllClasses())
+        {
+            for (UClass* C = Class; C && !Visited.Contains(C); C = const_cast<UClass*>(C->Super))
+            {
+                Visited.Add(C);
+                if (C->Super)
+                    Children[C->Super].Add(C);
+                else
+                    Roots.Add(C);
+            }
+        }
+
+        TArray<UClass*>& ClassTree = GetClassTree();
+        ClassTree.Empty();
+        ClassTree.reserve(Visited.Num());
+
+        auto Visit = [&](auto& Self, UClass* Class) -> void
+        {
+            Class->ClassTreeIndex = ClassTree.Num();
+            ClassTree.Add(Class);
+            if (TArray<UClass*>* ChildClasses = Children.Find(Class))
+            {
+                for (UClass* Child : *ChildClasses)
+                    Self(Self, Child);
+            }
+            Class->ClassTreeEnd = ClassTree.Num();
+        };
+        for (UClass* Root : Roots)
+            Visit(Visit, Root);
+
+        bClassTreeDirty = false;
+    }
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -52,6 +123,7 @@ struct UClass
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            bClassTreeDirty = true;
         }
     }
     static UClass* FindClass(const FName& InClassName)
@@ -163,6 +235,8 @@ public:
 
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
+    // UClass::Instances 내 위치 (ObjectFactory가 관리)
+    uint32_t ClassInstanceIndex = UINT32_MAX;
     FName    ObjectName;   // ← 객체 개별 이름 추가
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
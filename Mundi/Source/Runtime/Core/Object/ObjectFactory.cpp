@@ -5,6 +5,44 @@ TArray<UObject*> GUObjectArray;
 
 namespace ObjectFactory
 {
+    // GUObjectArray에 등록된 살아 있는 오브젝트 (DeleteObject가 역참조 전에 유효성 확인용)
+    static TSet<UObject*>& GetLiveObjects()
+    {
+        static TSet<UObject*> LiveObjects;
+        return LiveObjects;
+    }
+
+    // 클래스별 살아 있는 인스턴스 수/바이트 (STAT MEMORY) + 클래스별 인스턴스 목록
+    static void TrackObjectCreated(UObject* Obj)
+    {
+        UClass::EnsureClassTree();
+
+        UClass* Class = Obj->GetClass();
+        ++Class->LiveObjectCount;
+        Class->LiveObjectBytes += Class->Size;
+
+        Obj->ClassInstanceIndex = static_cast<uint32>(Class->Instances.Num());
+        Class->Instances.Add(Obj);
+        GetLiveObjects().Add(Obj);
+    }
+
+    static void TrackObjectDestroyed(UObject* Obj)
+    {
+        UClass* Class = Obj->GetClass();
+        --Class->LiveObjectCount;
+        Class->LiveObjectBytes -= Class->Size;
+
+        // swap-remove: 마지막 인스턴스를 빈 자리로 옮긴다
+        const uint32 Index = Obj->ClassInstanceIndex;
+        UObject* Last = Class->Instances.back();
+        Class->Instances[Index] = Last;
+        Last->ClassInstanceIndex = Index;
+        Class->Instances.pop_back();
+        Obj->ClassInstanceIndex = UINT32_MAX;
+
+        GetLiveObjects().Remove(Obj);
+    }
+
     TMap<UClass*, ConstructFunc>& GetRegistry()
     {
         static TMap<UClass*, ConstructFunc> Registry;
@@ -34,6 +72,7 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
 
         Obj->InternalIndex = static_cast<uint32>(idx);
+        TrackObjectCreated(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -60,6 +99,7 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
         //}
         Obj->InternalIndex = static_cast<uint32>(idx);
+        TrackObjectCreated(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,26 +121,38 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        if (!GetLiveObjects().Contains(Obj))
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[foundIndex] = nullptr;
+        GUObjectArray[Obj->InternalIndex] = nullptr;
+        TrackObjectDestroyed(Obj);
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
         Obj->DestroyInternal();
     }
 
+    void GetObjectsOfClass(UClass* Class, TArray<UObject*>& OutObjects, bool bIncludeDerivedClasses)
+    {
+        if (!Class) return;
+
+        if (!bIncludeDerivedClasses)
+        {
+            OutObjects.insert(OutObjects.end(), Class->Instances.begin(), Class->Instances.end());
+            return;
+        }
+
+        // 전위 순회 번호 구간 = Class와 모든 자손 클래스
+        UClass::EnsureClassTree();
+        const TArray<UClass*>& ClassTree = UClass::GetClassTree();
+        for (int32 i = Class->ClassTreeIndex; i < Class->ClassTreeEnd; ++i)
+        {
+            const TArray<UObject*>& Instances = ClassTree[i]->Instances;
+            OutObjects.insert(OutObjects.end(), Instances.begin(), Instances.end());
+        }
+    }
+
     void DeleteAll(bool bCallBeginDestroy)
     {
         // 실제 삭제 (역순 안전)
@@ -48,6 +48,21 @@ namespace ObjectFactory
     void DeleteAll(bool bCallBeginDestroy = true);
     // Null 슬롯 압축하여 배열 크기 축소
     void CompactNullSlots();
+
+    // Class(와 자손 클래스)의 살아 있는 인스턴스를 OutObjects에 추가. O(일치하는 오브젝트 수)
+    void GetObjectsOfClass(UClass* Class, TArray<UObject*>& OutObjects, bool bIncludeDerivedClasses = true);
+
+    template<class T>
+    inline void GetObjectsOfClass(TArray<T*>& OutObjects, bool bIncludeDerivedClasses = true)
+    {
+        TArray<UObject*> Objects;
+        GetObjectsOfClass(T::StaticClass(), Objects, bIncludeDerivedClasses);
+        OutObjects.reserve(OutObjects.Num() + Objects.Num());
+        for (UObject* Obj : Objects)
+        {
+            OutObjects.Add(static_cast<T*>(Obj));
+        }
+    }
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
@@ -0,0 +1,496 @@
+﻿#include "pch.h"
+#include "AnimSequence.h"
+
+#include <chrono>
+
+namespace
+{
+	// 'AANM'
+	constexpr uint32 AnimSequenceCacheMagic = 0x4D4E4141;
+
+	// 가장 큰 성분을 뺀 나머지 세 성분의 최대 절댓값 (1/sqrt(2))
+	constexpr float QuatComponentRange = 0.70710678f;
+	constexpr float QuatQuantizeScale = 32767.0f;
+	constexpr uint16 QuatValueMask = 0x7FFF;
+
+	// uint16 프레임 번호로 표현 가능한 최대 프레임 수
+	constexpr int32 MaxAnimFrames = 65536;
+
+	uint16 QuantizeQuatComponent(float Value)
+	{
+		const float Normalized = std::clamp(Value / QuatComponentRange * 0.5f + 0.5f, 0.0f, 1.0f);
+		return static_cast<uint16>(Normalized * QuatQuantizeScale + 0.5f);
+	}
+
+	float DequantizeQuatComponent(uint16 Bits)
+	{
+		return (static_cast<float>(Bits & QuatValueMask) / QuatQuantizeScale * 2.0f - 1.0f) * QuatComponentRange;
+	}
+
+	// 정규화 선형 보간 (최단 경로). 키 감소 오차 측정과 샘플링이 같은 보간을 써야 허용 오차가 보장된다.
+	FQuat NlerpQuat(const FQuat& A, const FQuat& B, float Alpha)
+	{
+		const float Bias = FQuat::Dot(A, B) >= 0.0f ? 1.0f : -1.0f;
+		FQuat Result(
+			A.X + (B.X * Bias - A.X) * Alpha,
+			A.Y + (B.Y * Bias - A.Y) * Alpha,
+			A.Z + (B.Z * Bias - A.Z) * Alpha,
+			A.W + (B.W * Bias - A.W) * Alpha);
+		Result.Normalize();
+		return Result;
+	}
+
+	float QuatAngleError(const FQuat& A, const FQuat& B)
+	{
+		const float AbsDot = std::min(std::fabs(FQuat::Dot(A, B)), 1.0f);
+		return 2.0f * std::acos(AbsDot);
+	}
+
+	float VectorError(const FVector& A, const FVector& B)
+	{
+		return (A - B).Size();
+	}
+
+	/**
+	 * 선형 보간으로 복원 가능한 중간 키를 제거하고 남길 프레임 번호를 OutFrames에 채운다.
+	 * 전 구간이 첫 키와 허용 오차 이내면 키 1개(상수 트랙), 아니면 첫/마지막 프레임을 항상 포함한다.
+	 */
+	template<typename T, typename TLerp, typename TError>
+	void ReduceChannelKeys(const TArray<T>& Samples, float Tolerance, TLerp Lerp, TError Error, TArray<uint16>& OutFrames)
+	{
+		OutFrames.Empty();
+		OutFrames.Add(0);
+
+		const int32 Num = Samples.Num();
+		bool bConstant = true;
+		for (int32 i = 1; i < Num && bConstant; ++i)
+		{
+			bConstant = Error(Samples[0], Samples[i]) <= Tolerance;
+		}
+		if (bConstant)
+		{
+			return;
+		}
+
+		// 구간 [Start, End]의 끝을 늘려도 내부 샘플이 모두 허용 오차 안에 드는 동안 확장한다
+		int32 Start = 0;
+		while (Start < Num - 1)
+		{
+			int32 End = Start + 1;
+			while (End + 1 < Num)
+			{
+				const int32 Candidate = End + 1;
+				const float InvLength = 1.0f / static_cast<float>(Candidate - Start);
+				bool bFits = true;
+				for (int32 i = Start + 1; i < Candidate && bFits; ++i)
+				{
+					const T Interpolated = Lerp(Samples[Start], Samples[Candidate], static_cast<float>(i - Start) * InvLength);
+					bFits = Error(Interpolated, Samples[i]) <= Tolerance;
+				}
+				if (!bFits)
+				{
+					break;
+				}
+				End = Candidate;
+			}
+			OutFrames.Add(static_cast<uint16>(End));
+			Start = End;
+		}
+	}
+
+	void ValidateKeyRange(const FAnimKeyRange& Range, size_t FrameCount, size_t KeyCount)
+	{
+		if (Range.Count == 0 || FrameCount != KeyCount || static_cast<size_t>(Range.Offset) + Range.Count > KeyCount)
+		{
+			throw std::runtime_error("Cache corrupt: AnimSequence key range out of bounds.");
+		}
+	}
+
+	// Cursor부터 Frame을 포함하는 구간 [Key, Key + 1]을 찾는다 (Count >= 2)
+	uint32 FindKeySegment(const uint16* Frames, uint32 Count, float Frame, uint32& Cursor)
+	{
+		uint32 Key = Cursor < Count - 1 ? Cursor : 0;
+		if (Frames[Key] <= Frame && Frame <= Frames[Key + 1])
+		{
+			return Key;
+		}
+
+		// 재생이 앞으로 진행되면 대부분 바로 다음 구간
+		if (Frames[Key + 1] < Frame && Key + 2 < Count && Frame <= Frames[Key + 2])
+		{
+			Cursor = Key + 1;
+			return Cursor;
+		}
+
+		const uint16* Upper = std::upper_bound(Frames, Frames + Count, Frame,
+			[](float Value, uint16 KeyFrame) { return Value < static_cast<float>(KeyFrame); });
+		const uint32 UpperIndex = static_cast<uint32>(Upper - Frames);
+		Key = std::min(UpperIndex > 0 ? UpperIndex - 1 : 0u, Count - 2);
+		Cursor = Key;
+		return Key;
+	}
+
+	template<typename TKey, typename TDecode, typename TBlend>
+	auto SampleChannel(const FAnimKeyRange& Range, const TArray<uint16>& Frames, const TArray<TKey>& Keys, float Frame,
+		uint32& Cursor, TDecode Decode, TBlend Blend)
+	{
+		const TKey* ChannelKeys = Keys.data() + Range.Offset;
+		if (Range.Count == 1)
+		{
+			return Decode(ChannelKeys[0]);
+		}
+
+		const uint16* ChannelFrames = Frames.data() + Range.Offset;
+		const uint32 Key = FindKeySegment(ChannelFrames, Range.Count, Frame, Cursor);
+		const float FrameA = static_cast<float>(ChannelFrames[Key]);
+		const float FrameB = static_cast<float>(ChannelFrames[Key + 1]);
+		const float Alpha = std::clamp((Frame - FrameA) / (FrameB - FrameA), 0.0f, 1.0f);
+		return Blend(Decode(ChannelKeys[Key]), Decode(ChannelKeys[Key + 1]), Alpha);
+	}
+}
+
+FQuantizedQuat FQuantizedQuat::Quantize(const FQuat& Rotation)
+{
+	const FQuat Normalized = Rotation.GetNormalized();
+	const float Components[4] = { Normalized.X, Normalized.Y, Normalized.Z, Normalized.W };
+
+	uint16 Largest = 0;
+	for (uint16 i = 1; i < 4; ++i)
+	{
+		if (std::fabs(Components[i]) > std::fabs(Components[Largest]))
+		{
+			Largest = i;
+		}
+	}
+
+	// q와 -q는 같은 회전이므로 버리는 성분이 양수가 되도록 부호를 맞춘다
+	const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+	uint16 Values[3];
+	int32 ValueIndex = 0;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (i != Largest)
+		{
+			Values[ValueIndex++] = QuantizeQuatComponent(Components[i] * Sign);
+		}
+	}
+
+	FQuantizedQuat Result;
+	Result.Data[0] = static_cast<uint16>(Values[0] | ((Largest >> 1) << 15));
+	Result.Data[1] = static_cast<uint16>(Values[1] | ((Largest & 1) << 15));
+	Result.Data[2] = Values[2];
+	return Result;
+}
+
+FQuat FQuantizedQuat::Dequantize() const
+{
+	const int32 Largest = ((Data[0] >> 15) << 1) | (Data[1] >> 15);
+
+	float Components[4];
+	float SumSquared = 0.0f;
+	int32 ValueIndex = 0;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (i == Largest)
+		{
+			continue;
+		}
+		Components[i] = DequantizeQuatComponent(Data[ValueIndex++]);
+		SumSquared += Components[i] * Components[i];
+	}
+	Components[Largest] = std::sqrt(std::max(0.0f, 1.0f - SumSquared));
+
+	return FQuat(Components[0], Components[1], Components[2], Components[3]);
+}
+
+void FAnimSequence::Compress(const FString& InName, float InFrameRate, int32 InNumFrames, const TArray<FString>& BoneNames,
+	const TArray<FTransform>& RawKeys, const FAnimCompressionSettings& Settings)
+{
+	Name = InName;
+	FrameRate = InFrameRate > 0.0f ? InFrameRate : 30.0f;
+	NumFrames = std::min(InNumFrames, MaxAnimFrames);
+	TrackBoneNames.Empty();
+	Tracks.Empty();
+	RotationFrames.Empty();
+	RotationKeys.Empty();
+	TranslationFrames.Empty();
+	TranslationKeys.Empty();
+	ScaleFrames.Empty();
+	ScaleKeys.Empty();
+
+	const int32 NumBones = BoneNames.Num();
+	if (NumFrames <= 0 || NumBones == 0 || RawKeys.Num() < static_cast<size_t>(InNumFrames) * NumBones)
+	{
+		NumFrames = 0;
+		return;
+	}
+
+	TrackBoneNames = BoneNames;
+	Tracks.SetNum(NumBones);
+
+	// 본 하나의 채널을 모아 두는 임시 버퍼 (임포트 시에만 사용)
+	TArray<FQuat> Rotations;
+	TArray<FVector> Translations;
+	TArray<FVector> Scales;
+	TArray<uint16> KeptFrames;
+	Rotations.SetNum(NumFrames);
+	Translations.SetNum(NumFrames);
+	Scales.SetNum(NumFrames);
+
+	for (int32 Bone = 0; Bone < NumBones; ++Bone)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const FTransform& Key = RawKeys[static_cast<size_t>(Frame) * NumBones + Bone];
+			Rotations[Frame] = Key.Rotation.GetNormalized();
+			Translations[Frame] = Key.Translation;
+			Scales[Frame] = Key.Scale3D;
+		}
+
+		FAnimTrack& Track = Tracks[Bone];
+
+		ReduceChannelKeys(Rotations, Settings.RotationTolerance, NlerpQuat, QuatAngleError, KeptFrames);
+		Track.Rotation = { static_cast<uint32>(RotationKeys.Num()), static_cast<uint32>(KeptFrames.Num()) };
+		for (uint16 Frame : KeptFrames)
+		{
+			RotationFrames.Add(Frame);
+			RotationKeys.Add(FQuantizedQuat::Quantize(Rotations[Frame]));
+		}
+
+		ReduceChannelKeys(Translations, Settings.TranslationTolerance, FVector::Lerp, VectorError, KeptFrames);
+		Track.Translation = { static_cast<uint32>(TranslationKeys.Num()), static_cast<uint32>(KeptFrames.Num()) };
+		for (uint16 Frame : KeptFrames)
+		{
+			TranslationFrames.Add(Frame);
+			TranslationKeys.Add(Translations[Frame]);
+		}
+
+		ReduceChannelKeys(Scales, Settings.ScaleTolerance, FVector::Lerp, VectorError, KeptFrames);
+		Track.Scale = { static_cast<uint32>(ScaleKeys.Num()), static_cast<uint32>(KeptFrames.Num()) };
+		for (uint16 Frame : KeptFrames)
+		{
+			ScaleFrames.Add(Frame);
+			ScaleKeys.Add(Scales[Frame]);
+		}
+	}
+}
+
+size_t FAnimSequence::GetCompressedSize() const
+{
+	const size_t FrameCount = RotationFrames.Num() + TranslationFrames.Num() + ScaleFrames.Num();
+	return Tracks.Num() * sizeof(FAnimTrack)
+		+ FrameCount * sizeof(uint16)
+		+ RotationKeys.Num() * sizeof(FQuantizedQuat)
+		+ (TranslationKeys.Num() + ScaleKeys.Num()) * sizeof(FVector);
+}
+
+int32 FAnimSequence::GetConstantChannelCount() const
+{
+	int32 Count = 0;
+	for (const FAnimTrack& Track : Tracks)
+	{
+		Count += (Track.Rotation.Count == 1) + (Track.Translation.Count == 1) + (Track.Scale.Count == 1);
+	}
+	return Count;
+}
+
+FArchive& operator<<(FArchive& Ar, FAnimSequence& Sequence)
+{
+	uint32 Magic = AnimSequenceCacheMagic;
+	uint32 Version = FAnimSequence::CacheVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Ar.IsLoading() && (Magic != AnimSequenceCacheMagic || Version != FAnimSequence::CacheVersion))
+	{
+		throw std::runtime_error("Cache incompatible: AnimSequence magic/version mismatch.");
+	}
+
+	Ar << Sequence.FrameRate;
+	Ar << Sequence.NumFrames;
+
+	if (Ar.IsSaving())
+	{
+		Serialization::WriteString(Ar, Sequence.Name);
+
+		uint32 NameCount = static_cast<uint32>(Sequence.TrackBoneNames.Num());
+		Ar << NameCount;
+		for (const FString& BoneName : Sequence.TrackBoneNames)
+		{
+			Serialization::WriteString(Ar, BoneName);
+		}
+
+		Serialization::WriteArray(Ar, Sequence.Tracks);
+		Serialization::WriteArray(Ar, Sequence.RotationFrames);
+		Serialization::WriteArray(Ar, Sequence.RotationKeys);
+		Serialization::WriteArray(Ar, Sequence.TranslationFrames);
+		Serialization::WriteArray(Ar, Sequence.TranslationKeys);
+		Serialization::WriteArray(Ar, Sequence.ScaleFrames);
+		Serialization::WriteArray(Ar, Sequence.ScaleKeys);
+	}
+	else if (Ar.IsLoading())
+	{
+		Serialization::ReadString(Ar, Sequence.Name);
+
+		uint32 NameCount = 0;
+		Ar << NameCount;
+		if (NameCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cache corrupt: AnimSequence track count is unreasonable.");
+		}
+		Sequence.TrackBoneNames.SetNum(NameCount);
+		for (FString& BoneName : Sequence.TrackBoneNames)
+		{
+			Serialization::ReadString(Ar, BoneName);
+		}
+
+		Serialization::ReadArray(Ar, Sequence.Tracks);
+		Serialization::ReadArray(Ar, Sequence.RotationFrames);
+		Serialization::ReadArray(Ar, Sequence.RotationKeys);
+		Serialization::ReadArray(Ar, Sequence.TranslationFrames);
+		Serialization::ReadArray(Ar, Sequence.TranslationKeys);
+		Serialization::ReadArray(Ar, Sequence.ScaleFrames);
+		Serialization::ReadArray(Ar, Sequence.ScaleKeys);
+
+		if (Sequence.Tracks.Num() != Sequence.TrackBoneNames.Num() || Sequence.FrameRate <= 0.0f)
+		{
+			throw std::runtime_error("Cache corrupt: AnimSequence header mismatch.");
+		}
+		for (const FAnimTrack& Track : Sequence.Tracks)
+		{
+			ValidateKeyRange(Track.Rotation, Sequence.RotationFrames.Num(), Sequence.RotationKeys.Num());
+			ValidateKeyRange(Track.Translation, Sequence.TranslationFrames.Num(), Sequence.TranslationKeys.Num());
+			ValidateKeyRange(Track.Scale, Sequence.ScaleFrames.Num(), Sequence.ScaleKeys.Num());
+		}
+	}
+	return Ar;
+}
+
+void FAnimSampler::Bind(const FAnimSequence* InSequence, const TArray<FBoneInfo>& TargetBones)
+{
+	Sequence = InSequence;
+	TrackToBone.Empty();
+	Cursors.Empty();
+	BoundTrackCount = 0;
+	if (!Sequence)
+	{
+		return;
+	}
+
+	const int32 NumTracks = Sequence->GetNumTracks();
+	TrackToBone.SetNum(NumTracks);
+	Cursors.SetNum(static_cast<size_t>(NumTracks) * 3);
+
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		int32 BoneIndex = TrackIndex;
+		if (!TargetBones.IsEmpty())
+		{
+			// 같은 스켈레톤에서 임포트한 경우 순서가 같으므로 먼저 같은 인덱스를 확인한다
+			const FString& TrackName = Sequence->TrackBoneNames[TrackIndex];
+			if (TrackIndex >= TargetBones.Num() || TargetBones[TrackIndex].BoneName != TrackName)
+			{
+				BoneIndex = -1;
+				for (int32 i = 0; i < TargetBones.Num(); ++i)
+				{
+					if (TargetBones[i].BoneName == TrackName)
+					{
+						BoneIndex = i;
+						break;
+					}
+				}
+			}
+		}
+
+		TrackToBone[TrackIndex] = BoneIndex;
+		BoundTrackCount += BoneIndex >= 0 ? 1 : 0;
+	}
+}
+
+float FAnimSampler::TimeToFrame(float Time, bool bLoop) const
+{
+	const float Duration = Sequence->GetDuration();
+	if (Duration <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	if (bLoop)
+	{
+		Time = std::fmod(Time, Duration);
+		if (Time < 0.0f)
+		{
+			Time += Duration;
+		}
+	}
+	else
+	{
+		Time = std::clamp(Time, 0.0f, Duration);
+	}
+	return std::min(Time * Sequence->FrameRate, static_cast<float>(Sequence->NumFrames - 1));
+}
+
+void FAnimSampler::Evaluate(float Time, bool bLoop, FTransform* OutLocalPose, int32 NumBones)
+{
+	if (!Sequence || !OutLocalPose || Sequence->NumFrames <= 0)
+	{
+		return;
+	}
+
+	const FAnimSequence& Seq = *Sequence;
+	const float Frame = TimeToFrame(Time, bLoop);
+
+	auto DecodeRotation = [](const FQuantizedQuat& Key) { return Key.Dequantize(); };
+	auto DecodeVector = [](const FVector& Key) { return Key; };
+
+	const int32 NumTracks = Seq.GetNumTracks();
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		const int32 BoneIndex = TrackToBone[TrackIndex];
+		if (BoneIndex < 0 || BoneIndex >= NumBones)
+		{
+			continue;
+		}
+
+		const FAnimTrack& Track = Seq.Tracks[TrackIndex];
+		uint32* TrackCursors = &Cursors[static_cast<size_t>(TrackIndex) * 3];
+		FTransform& OutTransform = OutLocalPose[BoneIndex];
+
+		OutTransform.Rotation = SampleChannel(Track.Rotation, Seq.RotationFrames, Seq.RotationKeys, Frame,
+			TrackCursors[0], DecodeRotation, NlerpQuat);
+		OutTransform.Translation = SampleChannel(Track.Translation, Seq.TranslationFrames, Seq.TranslationKeys, Frame,
+			TrackCursors[1], DecodeVector, FVector::Lerp);
+		OutTransform.Scale3D = SampleChannel(Track.Scale, Seq.ScaleFrames, Seq.ScaleKeys, Frame,
+			TrackCursors[2], DecodeVector, FVector::Lerp);
+	}
+}
+
+double FAnimSampler::Benchmark(const FAnimSequence& Sequence, int32 Iterations)
+{
+	const int32 NumTracks = Sequence.GetNumTracks();
+	if (NumTracks == 0 || Iterations <= 0)
+	{
+		return 0.0;
+	}
+
+	FAnimSampler Sampler;
+	Sampler.Bind(&Sequence, TArray<FBoneInfo>());
+
+	TArray<FTransform> Pose;
+	Pose.SetNum(NumTracks);
+
+	constexpr float TimeStep = 1.0f / 60.0f;
+	float Time = 0.0f;
+
+	// 워밍업 (키 배열 캐시 적재)
+	Sampler.Evaluate(Time, true, Pose.data(), NumTracks);
+
+	const auto Start = std::chrono::high_resolution_clock::now();
+	for (int32 Iter = 0; Iter < Iterations; ++Iter)
+	{
+		Time += TimeStep;
+		Sampler.Evaluate(Time, true, Pose.data(), NumTracks);
+	}
+	const double ElapsedSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - Start).count();
+
+	return ElapsedSeconds > 0.0 ? static_cast<double>(Iterations) / ElapsedSeconds : 0.0;
+}
@@ -0,0 +1,130 @@
+﻿#pragma once
+
+class FArchive;
+struct FBoneInfo;
+
+/**
+ * Smallest-three 양자화 쿼터니언 (48비트)
+ * 절댓값이 가장 큰 성분을 버리고(복원 시 단위 길이로 계산) 나머지 세 성분을 15비트씩 저장한다.
+ * 버린 성분의 인덱스(2비트)는 Data[0], Data[1]의 최상위 비트에 나눠 담는다.
+ */
+struct FQuantizedQuat
+{
+	uint16 Data[3] = { 0, 0, 0 };
+
+	static FQuantizedQuat Quantize(const FQuat& Rotation);
+	FQuat Dequantize() const;
+};
+
+// 채널 하나의 키 구간 (시퀀스 키 배열 내 Offset부터 Count개). Count == 1 이면 상수 트랙
+struct FAnimKeyRange
+{
+	uint32 Offset = 0;
+	uint32 Count = 0;
+};
+
+// 본 하나의 압축 트랙
+struct FAnimTrack
+{
+	FAnimKeyRange Rotation;
+	FAnimKeyRange Translation;
+	FAnimKeyRange Scale;
+};
+
+// 키 감소 허용 오차 (임포트 시 사용)
+struct FAnimCompressionSettings
+{
+	float RotationTolerance = 0.0005f;     // 라디안
+	float TranslationTolerance = 0.0001f;  // 미터
+	float ScaleTolerance = 0.0001f;
+};
+
+/**
+ * 애니메이션 시퀀스 (FBX 애님 스택 하나)
+ *
+ * 트랙은 본 단위이고 R/T/S 채널마다 독립적으로 압축된다.
+ * - 회전: FQuantizedQuat, 이동/스케일: FVector
+ * - 선형 보간으로 복원 가능한 중간 키는 제거하고, 남은 키마다 프레임 번호(uint16)를 둔다
+ * - 전 구간이 허용 오차 이내로 같으면 키 1개짜리 상수 트랙
+ * 모든 키는 채널별 연속 배열에 모여 있어 샘플링 시 트랙당 포인터 추적이 없다.
+ */
+struct FAnimSequence
+{
+	// 디스크 캐시(.anim.bin) 포맷 버전. 키 레이아웃이나 압축 방식이 바뀌면 올린다.
+	static constexpr uint32 CacheVersion = 1;
+
+	FString Name;
+	float FrameRate = 30.0f;
+	int32 NumFrames = 0;
+
+	// 트랙 i가 구동하는 본 이름 (임포트한 스켈레톤의 본 순서)
+	TArray<FString> TrackBoneNames;
+	TArray<FAnimTrack> Tracks;
+
+	TArray<uint16> RotationFrames;
+	TArray<FQuantizedQuat> RotationKeys;
+	TArray<uint16> TranslationFrames;
+	TArray<FVector> TranslationKeys;
+	TArray<uint16> ScaleFrames;
+	TArray<FVector> ScaleKeys;
+
+	float GetDuration() const { return NumFrames > 1 ? static_cast<float>(NumFrames - 1) / FrameRate : 0.0f; }
+	int32 GetNumTracks() const { return Tracks.Num(); }
+
+	/**
+	 * 균일 샘플링된 원본 키로부터 압축 트랙을 만든다.
+	 * @param RawKeys 프레임 우선 배치 (RawKeys[Frame * BoneNames.Num() + Bone]), 본 로컬 변환
+	 */
+	void Compress(const FString& InName, float InFrameRate, int32 InNumFrames, const TArray<FString>& BoneNames,
+		const TArray<FTransform>& RawKeys, const FAnimCompressionSettings& Settings = FAnimCompressionSettings());
+
+	// 압축 데이터가 차지하는 바이트 수 (이름 문자열 제외)
+	size_t GetCompressedSize() const;
+	// 같은 클립을 프레임마다 FTransform으로 저장했을 때의 바이트 수
+	size_t GetRawSize() const { return static_cast<size_t>(NumFrames) * Tracks.Num() * sizeof(FTransform); }
+	// 상수 트랙(키 1개) 채널 수
+	int32 GetConstantChannelCount() const;
+
+	// 헤더(매직/버전) + 키 배열 직렬화. 버전이 다르면 로드 시 예외를 던진다.
+	friend FArchive& operator<<(FArchive& Ar, FAnimSequence& Sequence);
+};
+
+/**
+ * 시퀀스 샘플러
+ *
+ * Bind 시점에 트랙 → 출력 본 매핑과 채널별 키 커서를 한 번 할당하고,
+ * Evaluate는 호출자가 넘긴 연속 로컬 변환 버퍼에 직접 쓰므로 프레임당 할당이 없다.
+ * 커서는 직전 샘플의 키 구간을 기억해 재생 시간이 단조 증가하면 이진 탐색 없이 다음 구간으로 넘어간다.
+ */
+class FAnimSampler
+{
+public:
+	// TargetBones와 이름이 같은 본에 트랙을 연결한다. 비어 있으면 트랙 i → 본 i
+	void Bind(const FAnimSequence* InSequence, const TArray<FBoneInfo>& TargetBones);
+
+	const FAnimSequence* GetSequence() const { return Sequence; }
+	// 본에 연결된 트랙 수
+	int32 GetBoundTrackCount() const { return BoundTrackCount; }
+
+	/**
+	 * Time(초) 시점의 로컬 포즈를 OutLocalPose[0, NumBones)에 기록한다.
+	 * 트랙이 없는 본은 건드리지 않으므로 호출자가 바인드 포즈로 채워 둔다.
+	 * @param bLoop true면 Duration으로 감싸고, false면 끝 프레임에서 멈춘다
+	 */
+	void Evaluate(float Time, bool bLoop, FTransform* OutLocalPose, int32 NumBones);
+
+	/**
+	 * 초당 포즈 샘플 수를 측정한다 (STAT이 아닌 콘솔 벤치마크용).
+	 * 매 샘플마다 재생 시간을 1/60초씩 진행해 게임 루프의 접근 패턴을 흉내 낸다.
+	 */
+	static double Benchmark(const FAnimSequence& Sequence, int32 Iterations);
+
+private:
+	float TimeToFrame(float Time, bool bLoop) const;
+
+	const FAnimSequence* Sequence = nullptr;
+	TArray<int32> TrackToBone;
+	// 트랙당 R/T/S 3개, 직전 샘플이 속했던 구간의 시작 키 (채널 Offset 기준 상대 인덱스)
+	TArray<uint32> Cursors;
+	int32 BoundTrackCount = 0;
+};
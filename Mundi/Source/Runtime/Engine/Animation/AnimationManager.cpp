@@ -0,0 +1,137 @@
+﻿#include "pch.h"
+#include "AnimationManager.h"
+#include "AnimationStats.h"
+#include "ParallelFor.h"
+#include "SkeletalMeshComponent.h"
+
+#include <chrono>
+
+void FAnimationManager::RegisterComponent(USkeletalMeshComponent* Component)
+{
+	if (!Component || Components.Contains(Component))
+	{
+		return;
+	}
+	Components.Add(Component);
+	Component->SetUpdateRateOffset(NextUpdateRateOffset++);
+}
+
+void FAnimationManager::DeRegisterComponent(USkeletalMeshComponent* Component)
+{
+	Components.Remove(Component);
+}
+
+void FAnimationManager::NotifyRendered(USkeletalMeshComponent* Component, float ScreenSize)
+{
+	if (Component)
+	{
+		Component->MarkRendered(FrameNumber, ScreenSize);
+	}
+}
+
+int32 FAnimationManager::GetUpdateInterval(float ScreenSize)
+{
+	// 화면 높이 대비 바운딩 구 지름 비율 → 갱신 간격
+	if (ScreenSize >= 0.25f) { return 1; }
+	if (ScreenSize >= 0.1f) { return 2; }
+	if (ScreenSize >= 0.04f) { return 4; }
+	return 8;
+}
+
+void FAnimationManager::Update()
+{
+	const uint64 LastRenderedFrame = FrameNumber++;
+
+	uint32 ThrottledCount = 0;
+	uint32 PausedCount = 0;
+	uint32 SavedVertexCount = 0;
+
+	DirtyComponents.Empty();
+	for (USkeletalMeshComponent* Component : Components)
+	{
+		if (!Component || !Component->IsSkinningDirty() || !Component->GetSkeletalMesh())
+		{
+			continue;
+		}
+
+		// 직전 프레임에 그려지지 않았으면 갱신 중지. 다시 보이는 프레임에 EnsureSkinningReady가 직접 스키닝한다
+		if (!Component->WasRenderedInFrame(LastRenderedFrame))
+		{
+			Component->SetSkinningThrottled(false);
+			++PausedCount;
+			SavedVertexCount += static_cast<uint32>(Component->GetSkinningVertexCount());
+			continue;
+		}
+
+		// 작게 보이는 컴포넌트는 N 프레임에 한 번만 갱신 (컴포넌트마다 갱신 프레임을 엇갈리게 배치)
+		const int32 Interval = GetUpdateInterval(Component->GetLastRenderedScreenSize());
+		if (Interval > 1 && (FrameNumber + Component->GetUpdateRateOffset()) % Interval != 0)
+		{
+			Component->SetSkinningThrottled(true);
+			++ThrottledCount;
+			SavedVertexCount += static_cast<uint32>(Component->GetSkinningVertexCount());
+			continue;
+		}
+
+		Component->SetSkinningThrottled(false);
+		DirtyComponents.Add(Component);
+	}
+
+	FAnimationStatManager& Stats = FAnimationStatManager::GetInstance();
+	Stats.RecordSkipped(ThrottledCount, PausedCount, SavedVertexCount);
+
+	if (DirtyComponents.IsEmpty())
+	{
+		return;
+	}
+
+	using Clock = std::chrono::high_resolution_clock;
+	const int32 ComponentCount = static_cast<int32>(DirtyComponents.Num());
+
+	// 1. 포즈 평가 (컴포넌트끼리 공유 상태가 없으므로 컴포넌트 단위로 병렬)
+	const auto PoseStart = Clock::now();
+	ParallelFor(ComponentCount, 1, [this](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			DirtyComponents[i]->EvaluateBoneTransforms();
+		}
+	});
+	const double PoseMS = std::chrono::duration<double, std::milli>(Clock::now() - PoseStart).count();
+
+	// 2. 스키닝 준비 (출력 버퍼 재할당 가능성이 있으므로 직렬) + 작업 목록 펼치기
+	uint32 BoneCount = 0;
+	uint32 VertexCount = 0;
+	SkinningJobs.Empty();
+	for (USkeletalMeshComponent* Component : DirtyComponents)
+	{
+		BoneCount += static_cast<uint32>(Component->GetSkinningBoneCount());
+
+		const int32 ComponentVertexCount = Component->PrepareBatchedSkinning();
+		for (int32 Begin = 0; Begin < ComponentVertexCount; Begin += FSkinningKernel::BatchSize)
+		{
+			SkinningJobs.Add({ Component, Begin, std::min(Begin + FSkinningKernel::BatchSize, ComponentVertexCount) });
+		}
+		VertexCount += static_cast<uint32>(ComponentVertexCount);
+	}
+
+	// 3. 모든 인스턴스를 한 번에 스키닝 (작은 메시 여러 개도 워커 전체에 고르게 분배)
+	const auto SkinningStart = Clock::now();
+	ParallelFor(static_cast<int32>(SkinningJobs.Num()), 1, [this](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const FSkinningJob& Job = SkinningJobs[i];
+			Job.Component->SkinBatchedRange(Job.Begin, Job.End);
+		}
+	});
+	const double SkinningMS = std::chrono::duration<double, std::milli>(Clock::now() - SkinningStart).count();
+
+	for (USkeletalMeshComponent* Component : DirtyComponents)
+	{
+		Component->FinishBatchedSkinning();
+	}
+
+	Stats.RecordPose(static_cast<uint32>(ComponentCount), BoneCount, PoseMS);
+	Stats.RecordSkinning(VertexCount, static_cast<uint32>(SkinningJobs.Num()), SkinningMS);
+}
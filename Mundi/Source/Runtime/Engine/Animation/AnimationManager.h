@@ -0,0 +1,56 @@
+﻿#pragma once
+
+class USkeletalMeshComponent;
+
+/**
+ * 월드 단위 애니메이션 갱신 단계
+ *
+ * 액터 틱이 끝난 뒤 스키닝이 필요한(더티) 스켈레탈 메시 컴포넌트를 모아 두 단계로 처리한다.
+ * 1. 포즈 평가: 애니메이션 샘플링 → 컴포넌트 공간 계층 → 스키닝 팔레트 (컴포넌트 단위 병렬)
+ * 2. 일괄 스키닝: 모든 인스턴스의 정점을 FSkinningKernel::BatchSize 단위 작업으로 펼쳐 한 번의 ParallelFor로 처리
+ * 정점 버퍼 업로드는 렌더 시점(USkeletalMeshComponent::EnsureSkinningReady)에 보이는 컴포넌트만 한다.
+ *
+ * 업데이트 빈도 최적화: FSceneRenderer가 가시성 판정 결과를 NotifyRendered로 알려 주면
+ *   (카메라 뷰와 섀도우 뷰 모두. 화면 밖에서 그림자만 드리우는 메시도 그려진 것으로 본다)
+ * - 직전 프레임에 그려지지 않은 컴포넌트는 갱신을 멈춘다 (다시 보이면 렌더 시점에 한 번 스키닝)
+ * - 그려진 컴포넌트는 화면 크기가 작을수록 N 프레임에 한 번만 갱신하고, 나머지 프레임은 이전 결과를 그린다
+ * 애니메이션 시간은 틱에서 계속 흐르므로 갱신하는 프레임에는 항상 현재 시간의 포즈가 나온다.
+ */
+class FAnimationManager
+{
+public:
+	FAnimationManager() = default;
+	~FAnimationManager() = default;
+
+	void RegisterComponent(USkeletalMeshComponent* Component);
+	void DeRegisterComponent(USkeletalMeshComponent* Component);
+
+	void Update();
+
+	// 렌더러가 이번 프레임에 컴포넌트를 그렸음을 알린다. 다음 Update의 갱신 여부/빈도 결정에 쓰인다
+	void NotifyRendered(USkeletalMeshComponent* Component, float ScreenSize);
+
+	// 화면 크기(FSceneView::GetScreenSize)에 따른 갱신 간격 (프레임). 1 = 매 프레임
+	static int32 GetUpdateInterval(float ScreenSize);
+
+	int32 GetRegisteredComponentCount() const { return Components.Num(); }
+
+private:
+	// 컴포넌트 하나의 [Begin, End) 정점 스키닝 작업
+	struct FSkinningJob
+	{
+		USkeletalMeshComponent* Component = nullptr;
+		int32 Begin = 0;
+		int32 End = 0;
+	};
+
+	TArray<USkeletalMeshComponent*> Components;
+
+	// Update마다 1씩 증가. 렌더 결과는 직전 Update의 프레임 번호로 기록된다
+	uint64 FrameNumber = 0;
+	uint32 NextUpdateRateOffset = 0;
+
+	// 프레임마다 재사용하는 작업 목록 (용량 유지)
+	TArray<USkeletalMeshComponent*> DirtyComponents;
+	TArray<FSkinningJob> SkinningJobs;
+};
@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 한 프레임 동안의 애니메이션/CPU 스키닝 갱신 통계
+ */
+struct FAnimationFrameStats
+{
+	uint32_t ComponentCount = 0;	// 포즈와 스키닝을 갱신한 스켈레탈 메시 컴포넌트 수
+	uint32_t BoneCount = 0;			// 평가한 본 수 (포즈 샘플링 + 컴포넌트 공간 계층)
+	uint32_t VertexCount = 0;		// CPU 스키닝한 정점 수
+	uint32_t SkinningJobCount = 0;	// 일괄 스키닝 작업(정점 배치) 수
+	uint32_t ThrottledComponentCount = 0;	// 화면 크기가 작아 이번 프레임 갱신을 건너뛴 컴포넌트 수
+	uint32_t PausedComponentCount = 0;		// 직전 프레임에 그려지지 않아 갱신을 멈춘 컴포넌트 수
+	uint32_t SavedVertexCount = 0;			// 위 두 경우로 스키닝을 생략한 정점 수
+	double PoseTimeMS = 0.0;
+	double SkinningTimeMS = 0.0;
+};
+
+/**
+ * @class FAnimationStatManager
+ * @brief 월드 애니메이션 갱신 단계의 본/정점 처리량과 소요 시간을 수집하는 싱글톤 클래스입니다.
+ * 갱신은 World Tick(일괄) 또는 렌더링 직전(EnsureSkinningReady)에 일어나므로, 프레임 시작 시 직전 프레임 값을 보관해 두고 그 값을 표시합니다.
+ */
+class FAnimationStatManager
+{
+public:
+	static FAnimationStatManager& GetInstance()
+	{
+		static FAnimationStatManager Instance;
+		return Instance;
+	}
+
+	/** @brief 매 프레임 렌더링 시작 시 호출하여 누적 값을 표시용으로 넘기고 초기화합니다. */
+	void ResetFrameStats()
+	{
+		LastFrameStats = CurrentStats;
+		CurrentStats = FAnimationFrameStats();
+	}
+
+	/** @return 직전 프레임의 애니메이션 갱신 통계 */
+	const FAnimationFrameStats& GetStats() const { return LastFrameStats; }
+
+	/** @brief 포즈 평가 결과를 기록합니다. */
+	void RecordPose(uint32_t InComponentCount, uint32_t InBoneCount, double TimeMS)
+	{
+		CurrentStats.ComponentCount += InComponentCount;
+		CurrentStats.BoneCount += InBoneCount;
+		CurrentStats.PoseTimeMS += TimeMS;
+	}
+
+	/** @brief CPU 스키닝 결과를 기록합니다. */
+	void RecordSkinning(uint32_t InVertexCount, uint32_t InJobCount, double TimeMS)
+	{
+		CurrentStats.VertexCount += InVertexCount;
+		CurrentStats.SkinningJobCount += InJobCount;
+		CurrentStats.SkinningTimeMS += TimeMS;
+	}
+
+	/** @brief 업데이트 빈도 최적화로 갱신을 생략한 결과를 기록합니다. */
+	void RecordSkipped(uint32_t InThrottledCount, uint32_t InPausedCount, uint32_t InSavedVertexCount)
+	{
+		CurrentStats.ThrottledComponentCount += InThrottledCount;
+		CurrentStats.PausedComponentCount += InPausedCount;
+		CurrentStats.SavedVertexCount += InSavedVertexCount;
+	}
+
+private:
+	FAnimationStatManager() = default;
+	~FAnimationStatManager() = default;
+
+	FAnimationStatManager(const FAnimationStatManager&) = delete;
+	FAnimationStatManager& operator=(const FAnimationStatManager&) = delete;
+
+private:
+	FAnimationFrameStats CurrentStats;
+	FAnimationFrameStats LastFrameStats;
+};
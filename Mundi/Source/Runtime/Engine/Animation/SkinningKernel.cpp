@@ -0,0 +1,381 @@
+﻿#include "pch.h"
+#include "SkinningKernel.h"
+#include "ParallelFor.h"
+
+#include <chrono>
+#include <xmmintrin.h>
+
+void FSkinningSourceStreams::Build(const TArray<FSkinnedVertex>& SkinnedVertices)
+{
+	const int32 VertexCount = static_cast<int32>(SkinnedVertices.Num());
+
+	PositionX.SetNum(VertexCount); PositionY.SetNum(VertexCount); PositionZ.SetNum(VertexCount);
+	NormalX.SetNum(VertexCount); NormalY.SetNum(VertexCount); NormalZ.SetNum(VertexCount);
+	TangentX.SetNum(VertexCount); TangentY.SetNum(VertexCount); TangentZ.SetNum(VertexCount);
+	BoneIndices.SetNum(VertexCount * MaxInfluences);
+	BoneWeights.SetNum(VertexCount * MaxInfluences);
+
+	for (int32 i = 0; i < VertexCount; ++i)
+	{
+		const FSkinnedVertex& Vertex = SkinnedVertices[i];
+		PositionX[i] = Vertex.BaseVertex.pos.X;
+		PositionY[i] = Vertex.BaseVertex.pos.Y;
+		PositionZ[i] = Vertex.BaseVertex.pos.Z;
+		NormalX[i] = Vertex.BaseVertex.normal.X;
+		NormalY[i] = Vertex.BaseVertex.normal.Y;
+		NormalZ[i] = Vertex.BaseVertex.normal.Z;
+		TangentX[i] = Vertex.BaseVertex.Tangent.X;
+		TangentY[i] = Vertex.BaseVertex.Tangent.Y;
+		TangentZ[i] = Vertex.BaseVertex.Tangent.Z;
+
+		for (int32 j = 0; j < MaxInfluences; ++j)
+		{
+			// 무시할 영향은 가중치 0으로 정리해 커널에서 분기 한 번으로 건너뛴다
+			const bool bValid = Vertex.BoneWeights[j] > KINDA_SMALL_NUMBER;
+			BoneIndices[i * MaxInfluences + j] = bValid ? Vertex.BoneIndices[j] : 0;
+			BoneWeights[i * MaxInfluences + j] = bValid ? Vertex.BoneWeights[j] : 0.0f;
+		}
+	}
+}
+
+void FSkinningSourceStreams::Empty()
+{
+	PositionX.Empty(); PositionY.Empty(); PositionZ.Empty();
+	NormalX.Empty(); NormalY.Empty(); NormalZ.Empty();
+	TangentX.Empty(); TangentY.Empty(); TangentZ.Empty();
+	BoneIndices.Empty();
+	BoneWeights.Empty();
+}
+
+bool FSkinningKernel::PrepareOutput(const TArray<FSkinnedVertex>& SkinnedVertices, TArray<FNormalVertex>& InOutVertices, bool bForceInit)
+{
+	const int32 VertexCount = static_cast<int32>(SkinnedVertices.Num());
+	if (!bForceInit && InOutVertices.Num() == VertexCount)
+	{
+		return false;
+	}
+
+	InOutVertices.SetNum(VertexCount);
+	for (int32 i = 0; i < VertexCount; ++i)
+	{
+		// Tangent의 W는 Bitangent의 방향 요소이므로 원본 보존 (스키닝은 pos/normal/Tangent xyz만 갱신)
+		InOutVertices[i] = SkinnedVertices[i].BaseVertex;
+	}
+	return true;
+}
+
+void FSkinningKernel::SkinRange(const FSkinningSourceStreams& Source, const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices,
+	int32 BoneCount, int32 Begin, int32 End, FNormalVertex* OutVertices)
+{
+	const uint8* Indices = Source.BoneIndices.data();
+	const float* Weights = Source.BoneWeights.data();
+
+	for (int32 i = Begin; i < End; ++i)
+	{
+		// 1) 영향 본 행렬 가중 합산 (위치/탄젠트용 4행, 법선용 3행)
+		__m128 M0 = _mm_setzero_ps(), M1 = _mm_setzero_ps(), M2 = _mm_setzero_ps(), M3 = _mm_setzero_ps();
+		__m128 N0 = _mm_setzero_ps(), N1 = _mm_setzero_ps(), N2 = _mm_setzero_ps();
+
+		const int32 InfluenceBase = i * FSkinningSourceStreams::MaxInfluences;
+		for (int32 j = 0; j < FSkinningSourceStreams::MaxInfluences; ++j)
+		{
+			const float Weight = Weights[InfluenceBase + j];
+			const int32 BoneIndex = Indices[InfluenceBase + j];
+			if (Weight == 0.0f || BoneIndex >= BoneCount)
+			{
+				continue;
+			}
+
+			const __m128 W = _mm_set1_ps(Weight);
+			const FMatrix& S = SkinningMatrices[BoneIndex];
+			const FMatrix& N = NormalMatrices[BoneIndex];
+			M0 = _mm_add_ps(M0, _mm_mul_ps(W, S.Rows[0]));
+			M1 = _mm_add_ps(M1, _mm_mul_ps(W, S.Rows[1]));
+			M2 = _mm_add_ps(M2, _mm_mul_ps(W, S.Rows[2]));
+			M3 = _mm_add_ps(M3, _mm_mul_ps(W, S.Rows[3]));
+			N0 = _mm_add_ps(N0, _mm_mul_ps(W, N.Rows[0]));
+			N1 = _mm_add_ps(N1, _mm_mul_ps(W, N.Rows[1]));
+			N2 = _mm_add_ps(N2, _mm_mul_ps(W, N.Rows[2]));
+		}
+
+		// 2) 합산 행렬로 한 번만 변환 (행벡터 * 행렬)
+		__m128 Pos = _mm_mul_ps(_mm_set1_ps(Source.PositionX[i]), M0);
+		Pos = _mm_add_ps(Pos, _mm_mul_ps(_mm_set1_ps(Source.PositionY[i]), M1));
+		Pos = _mm_add_ps(Pos, _mm_mul_ps(_mm_set1_ps(Source.PositionZ[i]), M2));
+		Pos = _mm_add_ps(Pos, M3);
+
+		__m128 Normal = _mm_mul_ps(_mm_set1_ps(Source.NormalX[i]), N0);
+		Normal = _mm_add_ps(Normal, _mm_mul_ps(_mm_set1_ps(Source.NormalY[i]), N1));
+		Normal = _mm_add_ps(Normal, _mm_mul_ps(_mm_set1_ps(Source.NormalZ[i]), N2));
+
+		__m128 Tangent = _mm_mul_ps(_mm_set1_ps(Source.TangentX[i]), M0);
+		Tangent = _mm_add_ps(Tangent, _mm_mul_ps(_mm_set1_ps(Source.TangentY[i]), M1));
+		Tangent = _mm_add_ps(Tangent, _mm_mul_ps(_mm_set1_ps(Source.TangentZ[i]), M2));
+
+		alignas(16) float PosOut[4], NormalOut[4], TangentOut[4];
+		_mm_store_ps(PosOut, Pos);
+		_mm_store_ps(NormalOut, Normal);
+		_mm_store_ps(TangentOut, Tangent);
+
+		// 3) 정규화 + 그람 슈미트 (기존 PerformCPUSkinning과 동일한 순서)
+		FNormalVertex& OutVertex = OutVertices[i];
+		OutVertex.pos = FVector(PosOut[0], PosOut[1], PosOut[2]);
+
+		FVector OutNormal(NormalOut[0], NormalOut[1], NormalOut[2]);
+		OutNormal.Normalize();
+		FVector Tangent3(TangentOut[0], TangentOut[1], TangentOut[2]);
+		Tangent3.Normalize();
+
+		const float Scalar = FVector::Dot(OutNormal, Tangent3);
+		Tangent3 = (Tangent3 - (Scalar * OutNormal)).GetSafeNormal();
+
+		OutVertex.normal = OutNormal;
+		OutVertex.Tangent.X = Tangent3.X;
+		OutVertex.Tangent.Y = Tangent3.Y;
+		OutVertex.Tangent.Z = Tangent3.Z;
+	}
+}
+
+void FSkinningKernel::Skin(const FSkinningSourceStreams& Source, const TArray<FMatrix>& SkinningMatrices, const TArray<FMatrix>& NormalMatrices,
+	TArray<FNormalVertex>& OutVertices, int32 MaxThreads)
+{
+	const int32 VertexCount = std::min(Source.Num(), static_cast<int32>(OutVertices.Num()));
+	const int32 BoneCount = static_cast<int32>(std::min(SkinningMatrices.Num(), NormalMatrices.Num()));
+	if (VertexCount == 0 || BoneCount == 0)
+	{
+		return;
+	}
+
+	const FMatrix* Skinning = SkinningMatrices.data();
+	const FMatrix* Normals = NormalMatrices.data();
+	FNormalVertex* Out = OutVertices.data();
+	ParallelFor(VertexCount, BatchSize, [&](int32 Begin, int32 End)
+	{
+		SkinRange(Source, Skinning, Normals, BoneCount, Begin, End, Out);
+	}, MaxThreads);
+}
+
+void FSkinningKernel::BuildNormalMatrices(const TArray<FMatrix>& SkinningMatrices, TArray<FMatrix>& OutNormalMatrices)
+{
+	const int32 BoneCount = static_cast<int32>(SkinningMatrices.Num());
+	OutNormalMatrices.SetNum(BoneCount);
+	for (int32 i = 0; i < BoneCount; ++i)
+	{
+		FMatrix Matrix = SkinningMatrices[i];
+		if (Matrix.IsOrtho())
+		{
+			OutNormalMatrices[i] = Matrix;
+		}
+		else
+		{
+			OutNormalMatrices[i] = Matrix.InverseAffine().Transpose();
+		}
+	}
+}
+
+bool FSkinningKernel::BuildDualQuatPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FDualQuatBone>& OutPalette)
+{
+	// 본 행렬 누적 오차를 고려해 IsOrtho(1e-4)보다 느슨하게 판정
+	constexpr float RigidTolerance = 1e-3f;
+
+	const int32 BoneCount = static_cast<int32>(SkinningMatrices.Num());
+	OutPalette.SetNum(BoneCount);
+	for (int32 i = 0; i < BoneCount; ++i)
+	{
+		const FMatrix& M = SkinningMatrices[i];
+		const FVector Row0(M.M[0][0], M.M[0][1], M.M[0][2]);
+		const FVector Row1(M.M[1][0], M.M[1][1], M.M[1][2]);
+		const FVector Row2(M.M[2][0], M.M[2][1], M.M[2][2]);
+
+		const bool bRigid =
+			std::fabs(FVector::Dot(Row0, Row0) - 1.0f) < RigidTolerance &&
+			std::fabs(FVector::Dot(Row1, Row1) - 1.0f) < RigidTolerance &&
+			std::fabs(FVector::Dot(Row2, Row2) - 1.0f) < RigidTolerance &&
+			std::fabs(FVector::Dot(Row0, Row1)) < RigidTolerance &&
+			std::fabs(FVector::Dot(Row0, Row2)) < RigidTolerance &&
+			std::fabs(FVector::Dot(Row1, Row2)) < RigidTolerance &&
+			FVector::Dot(FVector::Cross(Row0, Row1), Row2) > 0.0f; // 반사 제외
+		if (!bRigid)
+		{
+			return false;
+		}
+
+		// 행벡터 규약(p' = p * M)이므로 열벡터 기준인 FromRotationMatrix에는 전치해서 넘긴다
+		const FQuat Rotation = FQuat::FromRotationMatrix(M.Transpose());
+		const FVector Translation(M.M[3][0], M.M[3][1], M.M[3][2]);
+		const FVector RotationXYZ(Rotation.X, Rotation.Y, Rotation.Z);
+
+		// Dual = 0.5 * (t, 0) * Real
+		const FVector DualXYZ = (Translation * Rotation.W + FVector::Cross(Translation, RotationXYZ)) * 0.5f;
+		const float DualW = -0.5f * FVector::Dot(Translation, RotationXYZ);
+
+		FDualQuatBone& Bone = OutPalette[i];
+		Bone.Real[0] = Rotation.X; Bone.Real[1] = Rotation.Y; Bone.Real[2] = Rotation.Z; Bone.Real[3] = Rotation.W;
+		Bone.Dual[0] = DualXYZ.X; Bone.Dual[1] = DualXYZ.Y; Bone.Dual[2] = DualXYZ.Z; Bone.Dual[3] = DualW;
+	}
+	return true;
+}
+
+void FSkinningKernel::SkinRangeDualQuat(const FSkinningSourceStreams& Source, const FDualQuatBone* Palette,
+	int32 BoneCount, int32 Begin, int32 End, FNormalVertex* OutVertices)
+{
+	const uint8* Indices = Source.BoneIndices.data();
+	const float* Weights = Source.BoneWeights.data();
+
+	for (int32 i = Begin; i < End; ++i)
+	{
+		// 1) 듀얼 쿼터니언 가중 합산. 첫 영향 본과 반대 반구에 있는 쿼터니언은 부호를 뒤집어 최단 경로로 블렌드한다.
+		__m128 BlendReal = _mm_setzero_ps();
+		__m128 BlendDual = _mm_setzero_ps();
+		__m128 PivotReal = _mm_setzero_ps();
+		bool bHasPivot = false;
+
+		const int32 InfluenceBase = i * FSkinningSourceStreams::MaxInfluences;
+		for (int32 j = 0; j < FSkinningSourceStreams::MaxInfluences; ++j)
+		{
+			float Weight = Weights[InfluenceBase + j];
+			const int32 BoneIndex = Indices[InfluenceBase + j];
+			if (Weight == 0.0f || BoneIndex >= BoneCount)
+			{
+				continue;
+			}
+
+			const __m128 Real = _mm_load_ps(Palette[BoneIndex].Real);
+			const __m128 Dual = _mm_load_ps(Palette[BoneIndex].Dual);
+			if (!bHasPivot)
+			{
+				PivotReal = Real;
+				bHasPivot = true;
+			}
+			else
+			{
+				alignas(16) float Products[4];
+				_mm_store_ps(Products, _mm_mul_ps(PivotReal, Real));
+				if (Products[0] + Products[1] + Products[2] + Products[3] < 0.0f)
+				{
+					Weight = -Weight;
+				}
+			}
+
+			const __m128 W = _mm_set1_ps(Weight);
+			BlendReal = _mm_add_ps(BlendReal, _mm_mul_ps(W, Real));
+			BlendDual = _mm_add_ps(BlendDual, _mm_mul_ps(W, Dual));
+		}
+
+		alignas(16) float R[4], D[4];
+		_mm_store_ps(R, BlendReal);
+		_mm_store_ps(D, BlendDual);
+
+		const float LengthSquared = R[0] * R[0] + R[1] * R[1] + R[2] * R[2] + R[3] * R[3];
+		if (LengthSquared <= KINDA_SMALL_NUMBER)
+		{
+			// 유효한 영향이 없으면 바인드 포즈 유지 (LBS 경로의 0 벡터 결과 대신)
+			R[0] = R[1] = R[2] = 0.0f; R[3] = 1.0f;
+			D[0] = D[1] = D[2] = D[3] = 0.0f;
+		}
+		else
+		{
+			const float InvLength = 1.0f / std::sqrt(LengthSquared);
+			for (int32 k = 0; k < 4; ++k)
+			{
+				R[k] *= InvLength;
+				D[k] *= InvLength;
+			}
+		}
+
+		// 2) 회전 p' = p + 2r x (r x p + w p), 이동 t = 2(w_r d - w_d r + r x d)
+		const FVector RealXYZ(R[0], R[1], R[2]);
+		const FVector DualXYZ(D[0], D[1], D[2]);
+		auto Rotate = [&](const FVector& V)
+		{
+			return V + FVector::Cross(RealXYZ, FVector::Cross(RealXYZ, V) + V * R[3]) * 2.0f;
+		};
+		const FVector Translation = (DualXYZ * R[3] - RealXYZ * D[3] + FVector::Cross(RealXYZ, DualXYZ)) * 2.0f;
+
+		FNormalVertex& OutVertex = OutVertices[i];
+		OutVertex.pos = Rotate(FVector(Source.PositionX[i], Source.PositionY[i], Source.PositionZ[i])) + Translation;
+
+		// 강체 변환이므로 법선/탄젠트는 회전만 적용 (역전치 불필요)
+		FVector OutNormal = Rotate(FVector(Source.NormalX[i], Source.NormalY[i], Source.NormalZ[i]));
+		OutNormal.Normalize();
+		FVector Tangent3 = Rotate(FVector(Source.TangentX[i], Source.TangentY[i], Source.TangentZ[i]));
+		Tangent3.Normalize();
+
+		// 그람 슈미트 (LBS 경로와 동일)
+		const float Scalar = FVector::Dot(OutNormal, Tangent3);
+		Tangent3 = (Tangent3 - (Scalar * OutNormal)).GetSafeNormal();
+
+		OutVertex.normal = OutNormal;
+		OutVertex.Tangent.X = Tangent3.X;
+		OutVertex.Tangent.Y = Tangent3.Y;
+		OutVertex.Tangent.Z = Tangent3.Z;
+	}
+}
+
+void FSkinningKernel::SkinDualQuat(const FSkinningSourceStreams& Source, const TArray<FDualQuatBone>& Palette,
+	TArray<FNormalVertex>& OutVertices, int32 MaxThreads)
+{
+	const int32 VertexCount = std::min(Source.Num(), static_cast<int32>(OutVertices.Num()));
+	const int32 BoneCount = static_cast<int32>(Palette.Num());
+	if (VertexCount == 0 || BoneCount == 0)
+	{
+		return;
+	}
+
+	const FDualQuatBone* Bones = Palette.data();
+	FNormalVertex* Out = OutVertices.data();
+	ParallelFor(VertexCount, BatchSize, [&](int32 Begin, int32 End)
+	{
+		SkinRangeDualQuat(Source, Bones, BoneCount, Begin, End, Out);
+	}, MaxThreads);
+}
+
+double FSkinningKernel::Benchmark(const FSkeletalMesh& Mesh, ESkinningMode Mode, int32 MaxThreads, int32 Iterations)
+{
+	FSkinningSourceStreams Source;
+	Source.Build(Mesh.SkinnedVertices);
+
+	// 바인드 포즈 스키닝 행렬 (InverseBindPose * BindPose)
+	const int32 BoneCount = static_cast<int32>(Mesh.Bones.size());
+	TArray<FMatrix> SkinningMatrices;
+	SkinningMatrices.SetNum(BoneCount);
+	for (int32 i = 0; i < BoneCount; ++i)
+	{
+		const FMatrix& InverseBindPose = Mesh.Bones[i].InverseBindPoseMatrix;
+		SkinningMatrices[i] = InverseBindPose * InverseBindPose.InverseAffine();
+	}
+
+	TArray<FNormalVertex> OutVertices;
+	PrepareOutput(Mesh.SkinnedVertices, OutVertices, true);
+	if (Source.Num() == 0 || BoneCount == 0 || Iterations <= 0)
+	{
+		return 0.0;
+	}
+
+	TArray<FMatrix> NormalMatrices;
+	TArray<FDualQuatBone> DualQuatPalette;
+	auto SkinOnce = [&]()
+	{
+		if (Mode == ESkinningMode::DualQuaternion && BuildDualQuatPalette(SkinningMatrices, DualQuatPalette))
+		{
+			SkinDualQuat(Source, DualQuatPalette, OutVertices, MaxThreads);
+		}
+		else
+		{
+			BuildNormalMatrices(SkinningMatrices, NormalMatrices);
+			Skin(Source, SkinningMatrices, NormalMatrices, OutVertices, MaxThreads);
+		}
+	};
+
+	// 워밍업 (워커 기동, 캐시 적재)
+	SkinOnce();
+
+	const auto Start = std::chrono::high_resolution_clock::now();
+	for (int32 Iter = 0; Iter < Iterations; ++Iter)
+	{
+		SkinOnce();
+	}
+	const double ElapsedMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+	return ElapsedMS > 0.0 ? (static_cast<double>(Source.Num()) * Iterations) / ElapsedMS : 0.0;
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+
+struct FSkinnedVertex;
+struct FNormalVertex;
+struct FSkeletalMesh;
+struct FMatrix;
+
+// 스키닝 방식
+enum class ESkinningMode : uint8
+{
+	Linear,          // 선형 블렌드 (LBS): 본 행렬 가중 합
+	DualQuaternion,  // 듀얼 쿼터니언 (DQS): 강체 본 전용, 관절 부피 손실(candy-wrapper) 없음
+};
+
+/**
+ * 본 하나의 듀얼 쿼터니언 (float 8개, 32바이트)
+ * Real = 회전 쿼터니언 (x, y, z, w), Dual = 0.5 * 이동(t, 0) * Real
+ * 본 팔레트 크기가 행렬 2개(위치/법선용, 128바이트) 대비 1/4로 줄어든다.
+ */
+struct alignas(16) FDualQuatBone
+{
+	float Real[4];
+	float Dual[4];
+};
+
+/**
+ * CPU 스키닝 입력 스트림 (SoA)
+ * FSkinnedVertex(AoS, 96바이트)에서 스키닝에 필요한 성분만 분리해 둔다. 메시 로드 시 한 번 생성한다.
+ * 영향도가 KINDA_SMALL_NUMBER 이하인 본은 생성 시점에 가중치 0으로 정리된다.
+ */
+struct FSkinningSourceStreams
+{
+	TArray<float> PositionX, PositionY, PositionZ;
+	TArray<float> NormalX, NormalY, NormalZ;
+	TArray<float> TangentX, TangentY, TangentZ;
+
+	// 정점당 MaxInfluences개 (정점 i의 j번째 영향 = [i * MaxInfluences + j])
+	TArray<uint8> BoneIndices;
+	TArray<float> BoneWeights;
+
+	static constexpr int32 MaxInfluences = 4;
+
+	void Build(const TArray<FSkinnedVertex>& SkinnedVertices);
+	void Empty();
+	int32 Num() const { return static_cast<int32>(PositionX.Num()); }
+};
+
+/**
+ * 선형 블렌드 스키닝 커널 (SSE)
+ * 정점마다 영향 본 행렬을 먼저 가중 합산한 뒤 한 번만 변환한다.
+ * 위치/탄젠트는 SkinningMatrices, 법선은 NormalMatrices(역전치)로 변환한다.
+ */
+class FSkinningKernel
+{
+public:
+	// 스키닝 결과 배열을 준비한다. 크기가 다르거나 ForceInit이면 재할당하고 UV/색상/탄젠트 W 등 정적 성분을 채운다.
+	// 반환값: 재초기화 여부
+	static bool PrepareOutput(const TArray<FSkinnedVertex>& SkinnedVertices, TArray<FNormalVertex>& InOutVertices, bool bForceInit);
+
+	// [Begin, End) 정점의 pos/normal/Tangent(xyz)만 덮어쓴다.
+	static void SkinRange(const FSkinningSourceStreams& Source, const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices,
+		int32 BoneCount, int32 Begin, int32 End, FNormalVertex* OutVertices);
+
+	// 전체 정점을 ParallelFor로 스키닝한다. OutVertices는 PrepareOutput으로 준비되어 있어야 한다.
+	static void Skin(const FSkinningSourceStreams& Source, const TArray<FMatrix>& SkinningMatrices, const TArray<FMatrix>& NormalMatrices,
+		TArray<FNormalVertex>& OutVertices, int32 MaxThreads = 0);
+
+	// LBS용 법선 행렬(역전치) 팔레트. 직교 행렬은 그대로 복사한다.
+	static void BuildNormalMatrices(const TArray<FMatrix>& SkinningMatrices, TArray<FMatrix>& OutNormalMatrices);
+
+	// 스키닝 행렬을 듀얼 쿼터니언 팔레트로 변환한다.
+	// 스케일/전단/반사가 있는 본이 하나라도 있으면 false (호출자는 LBS로 대체)
+	static bool BuildDualQuatPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FDualQuatBone>& OutPalette);
+
+	// 듀얼 쿼터니언 블렌드로 [Begin, End) 정점의 pos/normal/Tangent(xyz)를 덮어쓴다.
+	static void SkinRangeDualQuat(const FSkinningSourceStreams& Source, const FDualQuatBone* Palette,
+		int32 BoneCount, int32 Begin, int32 End, FNormalVertex* OutVertices);
+
+	static void SkinDualQuat(const FSkinningSourceStreams& Source, const TArray<FDualQuatBone>& Palette,
+		TArray<FNormalVertex>& OutVertices, int32 MaxThreads = 0);
+
+	/**
+	 * 스레드 수별 스키닝 처리량 측정 (콘솔 벤치마크용)
+	 * 바인드 포즈 기준 스키닝 행렬로 Iterations회 스키닝해 ms당 정점 수를 반환한다.
+	 * 매 반복마다 팔레트 준비(LBS: 역전치 행렬, DQS: 듀얼 쿼터니언)를 포함한다.
+	 */
+	static double Benchmark(const FSkeletalMesh& Mesh, ESkinningMode Mode, int32 MaxThreads, int32 Iterations);
+
+	// 병렬 배치 크기 (정점 수)
+	static constexpr int32 BatchSize = 1024;
+};
@@ -17,6 +17,13 @@ FVector FAABB::GetHalfExtent() const
 	return (Max - Min) * 0.5f;
 }
 
+// 표면적
+float FAABB::GetSurfaceArea() const
+{
+	const FVector Size = Max - Min;
+	return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
 // 다른 박스를 완전히 포함하는지 확인
 bool FAABB::Contains(const FAABB& Other) const
 {
@@ -27,6 +27,9 @@ struct FAABB
 	// 반쪽 크기 (Extent)
 	FVector GetHalfExtent() const;
 
+	// 표면적 (BVH SAH 비용 계산용)
+	float GetSurfaceArea() const;
+
 	// 다른 박스를 완전히 포함하는지 확인
 	bool Contains(const FAABB& Other) const;
 
@@ -6,8 +6,11 @@
 #include "CollisionBVH.h"
 #include "CollisionComponent/ShapeComponent.h"
 #include "Renderer.h"
+#include "BVHStats.h"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <random>
 
 // ────────────────────────────────────────────────────────────────────────────
 // Morton Code Helpers (LBVH용)
@@ -62,9 +65,13 @@ void FCollisionBVH::Clear()
 	// NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
 	ShapeComponentBounds = TMap<UShapeComponent*, FAABB>();
 	ShapeComponentArray = TArray<UShapeComponent*>();
+	SortedBounds = TArray<FAABB>();
+	ComponentIndices = TMap<UShapeComponent*, int32>();
 	Nodes = TArray<FLBVHNode>();
 	Bounds = FAABB();
+	BuildSAHCost = 0.0f;
 	bPendingRebuild = false;
+	bPendingRefit = false;
 }
 
 void FCollisionBVH::BulkUpdate(const TArray<UShapeComponent*>& Components)
@@ -83,6 +90,7 @@ void FCollisionBVH::BulkUpdate(const TArray<UShapeComponent*>& Components)
 	// 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
 	BuildLBVH();
 	bPendingRebuild = false;
+	bPendingRefit = false;
 }
 
 void FCollisionBVH::Update(UShapeComponent* InComponent)
@@ -101,8 +109,19 @@ void FCollisionBVH::Update(UShapeComponent* InComponent)
 
 	// Bounds 강제 업데이트 (World Transform이 설정된 후)
 	InComponent->UpdateBounds();
-	ShapeComponentBounds[InComponent] = InComponent->GetScaledBounds().GetBox();
-	bPendingRebuild = true;
+	const FAABB NewBound = InComponent->GetScaledBounds().GetBox();
+	ShapeComponentBounds[InComponent] = NewBound;
+
+	// 이미 트리에 있는 컴포넌트면 리프 AABB만 갱신하고 Refit 예약
+	if (const int32* Index = ComponentIndices.Find(InComponent))
+	{
+		SortedBounds[*Index] = NewBound;
+		bPendingRefit = true;
+	}
+	else
+	{
+		bPendingRebuild = true;
+	}
 }
 
 void FCollisionBVH::Remove(UShapeComponent* InComponent)
@@ -115,6 +134,7 @@ void FCollisionBVH::Remove(UShapeComponent* InComponent)
 	if (ShapeComponentBounds.Find(InComponent))
 	{
 		ShapeComponentBounds.Remove(InComponent);
+		ComponentIndices.Remove(InComponent);
 		bPendingRebuild = true;
 	}
 }
@@ -124,8 +144,14 @@ void FCollisionBVH::FlushRebuild()
 	if (bPendingRebuild)
 	{
 		BuildLBVH();
-		bPendingRebuild = false;
 	}
+	else if (bPendingRefit)
+	{
+		RefitLBVH();
+	}
+
+	bPendingRebuild = false;
+	bPendingRefit = false;
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -305,10 +331,15 @@ void FCollisionBVH::DebugDump() const
 
 void FCollisionBVH::BuildLBVH()
 {
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
 	// 1. 컴포넌트 배열 생성
 	ShapeComponentArray = ShapeComponentBounds.GetKeys();
 	const int N = ShapeComponentArray.Num();
 	Nodes = TArray<FLBVHNode>();
+	SortedBounds = TArray<FAABB>();
+	ComponentIndices = TMap<UShapeComponent*, int32>();
+	BuildSAHCost = 0.0f;
 
 	if (N == 0)
 	{
@@ -386,15 +417,186 @@ void FCollisionBVH::BuildLBVH()
 			return LHS.second < RHS.second;
 		});
 
+	SortedBounds.resize(N);
+	ComponentIndices.reserve(N);
 	for (int i = 0; i < N; ++i)
 	{
-		ShapeComponentArray[i] = ComponentCodePairs[i].first;
+		UShapeComponent* Comp = ComponentCodePairs[i].first;
+		ShapeComponentArray[i] = Comp;
+		SortedBounds[i] = ShapeComponentBounds[Comp];
+		ComponentIndices.Add(Comp, i);
 	}
 
 	// 5. BVH 트리 구축
 	Nodes.reserve(std::max(1, 2 * N));
 	Nodes.clear();
 	BuildRange(0, N);
+
+	// 6. Refit 품질 비교 기준 저장
+	BuildSAHCost = ComputeSAHCost();
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const std::chrono::duration<double, std::milli> Elapsed = EndTime - StartTime;
+	FBVHStatManager::GetInstance().RecordRebuild(EBVHStatTarget::Collision, Elapsed.count());
+}
+
+void FCollisionBVH::RefitLBVH()
+{
+	if (Nodes.empty())
+	{
+		return;
+	}
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	// 자식 노드가 항상 부모보다 뒤에 있으므로 역순 순회 = 상향식 갱신
+	for (int32 i = Nodes.Num() - 1; i >= 0; --i)
+	{
+		FLBVHNode& Node = Nodes[i];
+		if (Node.IsLeaf())
+		{
+			FAABB Accumulated = SortedBounds[Node.First];
+			for (int32 k = 1; k < Node.Count; ++k)
+			{
+				Accumulated = FAABB::Union(Accumulated, SortedBounds[Node.First + k]);
+			}
+			Node.Bounds = Accumulated;
+		}
+		else if (Node.Left >= 0 && Node.Right >= 0)
+		{
+			Node.Bounds = FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds);
+		}
+	}
+	Bounds = Nodes[0].Bounds;
+
+	// 트리 품질이 기준 이하로 떨어지면 재구축
+	const float Cost = ComputeSAHCost();
+	const float CostRatio = (BuildSAHCost > 0.0f) ? Cost / BuildSAHCost : 1.0f;
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const std::chrono::duration<double, std::milli> Elapsed = EndTime - StartTime;
+	FBVHStatManager::GetInstance().RecordRefit(EBVHStatTarget::Collision, Elapsed.count(), CostRatio);
+
+	if (CostRatio > RebuildCostThreshold)
+	{
+		BuildLBVH();
+	}
+}
+
+void FCollisionBVH::BenchmarkRefit(int32 ShapeCount, int32 Frames, double& OutRefitMS, double& OutRebuildMS, int32& OutThresholdRebuilds)
+{
+	OutRefitMS = 0.0;
+	OutRebuildMS = 0.0;
+	OutThresholdRebuilds = 0;
+	if (ShapeCount <= 0 || Frames <= 0)
+	{
+		return;
+	}
+
+	// 벤치마크 트리의 Refit/재구축 기록이 STAT BVH의 씬 통계에 섞이지 않도록 끝나면 되돌린다
+	FBVHStatManager& BVHStats = FBVHStatManager::GetInstance();
+	const FBVHTreeStats SavedStats = BVHStats.GetCurrentStats(EBVHStatTarget::Collision);
+
+	// 키는 식별용으로만 쓰이므로(바운드가 항상 맵에 있어 역참조하지 않음) 컴포넌트 없이 가짜 포인터 사용
+	auto MakeKey = [](int32 Index) { return reinterpret_cast<UShapeComponent*>(static_cast<uintptr_t>(Index + 1) * 16); };
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> PositionDist(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> VelocityDist(-2.0f, 2.0f);
+	TArray<FVector> StartCenters;
+	TArray<FVector> Velocities;
+	StartCenters.resize(ShapeCount);
+	Velocities.resize(ShapeCount);
+	for (int32 i = 0; i < ShapeCount; ++i)
+	{
+		StartCenters[i] = FVector(PositionDist(Rng), PositionDist(Rng), PositionDist(Rng));
+		Velocities[i] = FVector(VelocityDist(Rng), VelocityDist(Rng), VelocityDist(Rng));
+	}
+
+	const FVector HalfExtent(1.0f, 1.0f, 1.0f);
+	auto ShapeBounds = [&](int32 Index, int32 Frame)
+	{
+		const FVector Center = StartCenters[Index] + Velocities[Index] * static_cast<float>(Frame);
+		return FAABB(Center - HalfExtent, Center + HalfExtent);
+	};
+
+	auto InitTree = [&](FCollisionBVH& Tree)
+	{
+		for (int32 i = 0; i < ShapeCount; ++i)
+		{
+			Tree.ShapeComponentBounds.Add(MakeKey(i), ShapeBounds(i, 0));
+		}
+		Tree.BuildLBVH();
+	};
+
+	using Clock = std::chrono::high_resolution_clock;
+	const FAABB WorldBounds(FVector(-1000.0f, -1000.0f, -1000.0f), FVector(1000.0f, 1000.0f, 1000.0f));
+
+	// 현재 방식: 이동한 리프만 갱신하고 Refit (SAH 비용이 나빠지면 RefitLBVH가 재구축)
+	{
+		FCollisionBVH Tree(WorldBounds);
+		InitTree(Tree);
+		const auto Start = Clock::now();
+		for (int32 Frame = 1; Frame <= Frames; ++Frame)
+		{
+			for (int32 i = 0; i < ShapeCount; ++i)
+			{
+				UShapeComponent* Key = MakeKey(i);
+				const FAABB NewBound = ShapeBounds(i, Frame);
+				Tree.ShapeComponentBounds[Key] = NewBound;
+				Tree.SortedBounds[*Tree.ComponentIndices.Find(Key)] = NewBound;
+			}
+			Tree.bPendingRefit = true;
+
+			// 재구축은 BuildSAHCost를 새로 계산하므로 값이 바뀌면 재구축된 프레임
+			const float PrevBuildCost = Tree.BuildSAHCost;
+			Tree.FlushRebuild();
+			OutThresholdRebuilds += (Tree.BuildSAHCost != PrevBuildCost) ? 1 : 0;
+		}
+		OutRefitMS = std::chrono::duration<double, std::milli>(Clock::now() - Start).count() / Frames;
+	}
+
+	// 기존 방식: 이동이 있으면 매 프레임 Morton 정렬부터 전체 재구축
+	{
+		FCollisionBVH Tree(WorldBounds);
+		InitTree(Tree);
+		const auto Start = Clock::now();
+		for (int32 Frame = 1; Frame <= Frames; ++Frame)
+		{
+			for (int32 i = 0; i < ShapeCount; ++i)
+			{
+				Tree.ShapeComponentBounds[MakeKey(i)] = ShapeBounds(i, Frame);
+			}
+			Tree.bPendingRebuild = true;
+			Tree.FlushRebuild();
+		}
+		OutRebuildMS = std::chrono::duration<double, std::milli>(Clock::now() - Start).count() / Frames;
+	}
+
+	BVHStats.SetCurrentStats(EBVHStatTarget::Collision, SavedStats);
+}
+
+float FCollisionBVH::ComputeSAHCost() const
+{
+	if (Nodes.empty())
+	{
+		return 0.0f;
+	}
+
+	const float RootArea = Nodes[0].Bounds.GetSurfaceArea();
+	if (RootArea <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	float Cost = 0.0f;
+	for (const FLBVHNode& Node : Nodes)
+	{
+		const float Area = Node.Bounds.GetSurfaceArea();
+		Cost += Node.IsLeaf() ? Area * static_cast<float>(Node.Count) : Area;
+	}
+
+	return Cost / RootArea;
 }
 
 int FCollisionBVH::BuildRange(int s, int e)
@@ -416,14 +618,12 @@ int FCollisionBVH::BuildRange(int s, int e)
 
 		for (int i = s; i < e; ++i)
 		{
-			UShapeComponent* Comp = ShapeComponentArray[i];
-			if (!Comp)
+			if (!ShapeComponentArray[i])
 			{
 				continue;
 			}
 
-			const FAABB* Bound = ShapeComponentBounds.Find(Comp);
-			const FAABB LocalBound = Bound ? *Bound : Comp->GetScaledBounds().GetBox();
+			const FAABB& LocalBound = SortedBounds[i];
 
 			if (!bInitialized)
 			{
@@ -15,6 +15,8 @@ class URenderer;
  *
  * ShapeComponent 기반 충돌 감지를 위한 BVH 구조입니다.
  * LBVH (Linear BVH) 알고리즘을 사용하여 O(log N) 쿼리 성능을 제공합니다.
+ * 기존 컴포넌트가 이동만 한 경우 트리 구조는 유지한 채 Bounds만 상향식으로 갱신(Refit)하며,
+ * Refit으로 SAH 비용이 재구축 직후 대비 RebuildCostThreshold배를 넘으면 재구축합니다.
  *
  * 주요 기능:
  * - ShapeComponent 등록/해제/업데이트
@@ -73,11 +75,26 @@ public:
 	void Remove(UShapeComponent* InComponent);
 
 	/**
-	 * 보류 중인 BVH 재구축을 즉시 실행합니다.
+	 * 보류 중인 BVH 재구축 또는 Refit을 즉시 실행합니다.
 	 * Update 호출 후 쿼리 전에 호출해야 합니다.
 	 */
 	void FlushRebuild();
 
+	/** Refit 후 SAH 비용이 재구축 직후 대비 이 배율을 넘으면 재구축 */
+	static constexpr float RebuildCostThreshold = 1.5f;
+
+	/**
+	 * 움직이는 합성 AABB로 Refit 방식과 매 프레임 전체 재구축을 비교합니다 (콘솔 벤치마크용).
+	 * 측정 중 기록된 BVH 통계는 끝날 때 되돌립니다.
+	 *
+	 * @param ShapeCount - 도형 수
+	 * @param Frames - 모든 도형이 이동하는 프레임 수
+	 * @param OutRefitMS - Refit 방식의 프레임당 평균 시간 (ms)
+	 * @param OutRebuildMS - 전체 재구축 방식의 프레임당 평균 시간 (ms)
+	 * @param OutThresholdRebuilds - Refit 중 SAH 기준으로 재구축된 횟수
+	 */
+	static void BenchmarkRefit(int32 ShapeCount, int32 Frames, double& OutRefitMS, double& OutRebuildMS, int32& OutThresholdRebuilds);
+
 	// ────────────────────────────────────────────────
 	// 쿼리 API
 	// ────────────────────────────────────────────────
@@ -196,6 +213,19 @@ private:
 	 */
 	int BuildRange(int s, int e);
 
+	/**
+	 * 트리 구조를 유지한 채 리프부터 루트까지 Bounds를 다시 계산합니다.
+	 * BuildRange는 부모 노드를 자식보다 먼저 추가하므로 노드 배열을 역순으로 한 번 훑으면 됩니다.
+	 */
+	void RefitLBVH();
+
+	/**
+	 * 현재 트리의 SAH 비용을 계산합니다 (루트 표면적으로 정규화).
+	 *
+	 * @return 내부 노드 표면적 합 + 리프 표면적 * 컴포넌트 수 합, 루트 표면적 대비
+	 */
+	float ComputeSAHCost() const;
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -218,9 +248,21 @@ private:
 	/** 컴포넌트 배열 (BuildLBVH에서 정렬됨) */
 	TArray<UShapeComponent*> ShapeComponentArray;
 
+	/** ShapeComponentArray와 같은 순서의 AABB (Refit 시 제자리 갱신) */
+	TArray<FAABB> SortedBounds;
+
+	/** 컴포넌트 -> ShapeComponentArray 인덱스 (마지막 재구축 기준) */
+	TMap<UShapeComponent*, int32> ComponentIndices;
+
+	/** 마지막 재구축 직후의 SAH 비용 */
+	float BuildSAHCost = 0.0f;
+
 	/** LBVH 노드 배열 */
 	TArray<FLBVHNode> Nodes;
 
-	/** 재구축 대기 플래그 */
+	/** 재구축 대기 플래그 (컴포넌트 추가/제거) */
 	bool bPendingRebuild = false;
+
+	/** Refit 대기 플래그 (기존 컴포넌트 이동) */
+	bool bPendingRefit = false;
 };
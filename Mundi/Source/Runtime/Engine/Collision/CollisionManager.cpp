@@ -6,7 +6,9 @@
 #include "CollisionManager.h"
 #include "CollisionComponent/ShapeComponent.h"
 #include "World.h"
+#include "Actor.h"
 #include "Renderer.h"
+#include <algorithm>
 
 IMPLEMENT_CLASS(UCollisionManager)
 
@@ -38,8 +40,13 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 	}
 
 	// 이미 등록된 컴포넌트는 무시
-	if (RegisteredComponents.Contains(Component))
+	if (ComponentProxyIds.Contains(Component))
 	{
+		// 같은 업데이트 안에서 해제 후 재등록된 경우 해제 요청 취소
+		PendingUnregisters.erase(
+			std::remove(PendingUnregisters.begin(), PendingUnregisters.end(), Component),
+			PendingUnregisters.end()
+		);
 		return;
 	}
 
@@ -52,11 +59,15 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 	// 컴포넌트 등록
 	RegisteredComponents.push_back(Component);
 
-	// BVH에 추가
-	BVH->Update(Component);
+	// Sweep 프록시 추가 (Bounds는 다음 UpdateCollisions에서 갱신되며 그때 정렬 위치로 이동)
+	FSweepProxy Proxy;
+	Proxy.Component = Component;
+	Proxy.Id = NextProxyId++;
+	SweepProxies.push_back(Proxy);
+	ComponentProxyIds.Add(Component, Proxy.Id);
 
-	// 대량 등록 시 재구축 플래그 설정
-	bNeedsFullRebuild = true;
+	// BVH에 추가 (트리 재구성은 다음 FlushRebuild에서 한 번만 수행)
+	BVH->Update(Component);
 }
 
 void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
@@ -67,10 +78,62 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	}
 
 	// 등록되지 않은 컴포넌트는 무시
-	if (!RegisteredComponents.Contains(Component))
+	if (!ComponentProxyIds.Contains(Component))
+	{
+		return;
+	}
+
+	// 충돌 업데이트 중(이벤트 핸들러 내부 등)이면 순회가 끝난 뒤 처리
+	if (bIsUpdatingCollisions)
+	{
+		if (!PendingUnregisters.Contains(Component))
+		{
+			PendingUnregisters.push_back(Component);
+		}
+		return;
+	}
+
+	RemoveComponentInternal(Component);
+}
+
+void UCollisionManager::RemoveComponentInternal(UShapeComponent* Component)
+{
+	const uint32* ProxyIdPtr = ComponentProxyIds.Find(Component);
+	if (!ProxyIdPtr)
 	{
 		return;
 	}
+	const uint32 ProxyId = *ProxyIdPtr;
+	ComponentProxyIds.Remove(Component);
+
+	// Sweep 프록시 제거 (정렬 순서 유지)
+	SweepProxies.erase(
+		std::remove_if(SweepProxies.begin(), SweepProxies.end(),
+			[Component](const FSweepProxy& Proxy) { return Proxy.Component == Component; }),
+		SweepProxies.end()
+	);
+
+	// 이 프록시가 속한 쌍만 캐시에서 제거하고, 겹쳐있던 상대에게 End 이벤트 예약
+	TArray<UShapeComponent*> EndedPartners;
+	if (TArray<uint64>* PairKeys = ProxyPairKeys.Find(ProxyId))
+	{
+		for (const uint64 Key : *PairKeys)
+		{
+			const uint32 IdLow = static_cast<uint32>(Key >> 32);
+			const uint32 IdHigh = static_cast<uint32>(Key);
+			RemovePairKeyFromProxy(IdLow == ProxyId ? IdHigh : IdLow, Key);
+
+			if (const FOverlapPair* Pair = PairCache.Find(Key))
+			{
+				if (Pair->bOverlapping)
+				{
+					EndedPartners.push_back(Pair->A == Component ? Pair->B : Pair->A);
+				}
+				PairCache.Remove(Key);
+			}
+		}
+		ProxyPairKeys.Remove(ProxyId);
+	}
 
 	// 컴포넌트 제거
 	RegisteredComponents.erase(
@@ -82,12 +145,17 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	BVH->Remove(Component);
 
 	// Dirty 목록에서도 제거
-	DirtyComponents.erase(
-		std::remove(DirtyComponents.begin(), DirtyComponents.end(), Component),
-		DirtyComponents.end()
-	);
+	DirtyComponents.Remove(Component);
 
-	bNeedsFullRebuild = true;
+	// 해제되는 컴포넌트의 Overlap 기록은 이벤트 없이 정리
+	Component->OverlapInfos.clear();
+	Component->bIsOverlapping = false;
+
+	for (UShapeComponent* Partner : EndedPartners)
+	{
+		++OverlapEventsTriggered;
+		Partner->NotifyEndOverlap(Component);
+	}
 }
 
 void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
@@ -98,18 +166,12 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 	}
 
 	// 등록된 컴포넌트만 Dirty 마킹
-	if (!RegisteredComponents.Contains(Component))
+	if (!ComponentProxyIds.Contains(Component))
 	{
 		return;
 	}
 
-	// 이미 Dirty 목록에 있으면 무시
-	if (DirtyComponents.Contains(Component))
-	{
-		return;
-	}
-
-	DirtyComponents.push_back(Component);
+	DirtyComponents.Add(Component);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -120,61 +182,45 @@ void UCollisionManager::UpdateCollisions(float DeltaTime)
 {
 	// 통계 초기화
 	CollisionPairsChecked = 0;
+	CachedPairsReused = 0;
 	OverlapEventsTriggered = 0;
 
-	// 1. BVH 업데이트
-	if (bNeedsFullRebuild)
-	{
-		RebuildBVH();
-		bNeedsFullRebuild = false;
-	}
-	else if (!DirtyComponents.empty())
+	bIsUpdatingCollisions = true;
+	++CollisionFrame;
+
+	// 1. BVH 업데이트 (공간 쿼리 / 디버그 렌더링용)
+	if (!DirtyComponents.empty())
 	{
 		UpdateBVHIncremental();
 	}
 
-	// 2. BVH 재구축 플러시
+	// 2. BVH 재구축 플러시 (등록/해제가 있었으면 여기서 한 번만 재구성)
 	BVH->FlushRebuild();
 
-	// 3. 모든 컴포넌트에 대해 충돌 체크
-	for (UShapeComponent* Comp : RegisteredComponents)
-	{
-		if (!Comp || !Comp->bGenerateOverlapEvents)
-		{
-			continue;
-		}
+	// 3. Broad Phase: 새로 등록되었거나 이동한 프록시만 Bounds 갱신 후 정렬 유지
+	UpdateSweepProxies();
 
-		// BVH 쿼리: 이 컴포넌트와 겹칠 가능성이 있는 컴포넌트들만 반환 (Broad Phase)
-		TArray<UShapeComponent*> PotentialOverlaps = BVH->QueryOverlappingComponents(Comp);
+	// 4. Dirty 플래그 초기화 (이벤트 핸들러에서 발생한 이동은 다음 프레임에 반영)
+	ClearDirtyFlags();
 
-		// 자기 자신 제거
-		PotentialOverlaps.erase(
-			std::remove(PotentialOverlaps.begin(), PotentialOverlaps.end(), Comp),
-			PotentialOverlaps.end()
-		);
+	// 5. Sweep and Prune + Pair Cache 갱신 (이벤트는 쌓아두기만 함)
+	UpdateOverlapPairs();
 
-		CollisionPairsChecked += PotentialOverlaps.Num();
+	// 6. Begin/End Overlap 이벤트 발생
+	DispatchOverlapEvents();
 
-		// Narrow Phase: 정밀 충돌 체크 + 이벤트 발생
-		// UpdateOverlaps가 내부적으로 BeginOverlap/EndOverlap 델리게이트 호출
-		Comp->UpdateOverlaps(PotentialOverlaps);
-	}
+	bIsUpdatingCollisions = false;
 
-	// 4. Dirty 플래그 초기화
-	ClearDirtyFlags();
-}
-
-void UCollisionManager::RebuildBVH()
-{
-	if (!BVH)
+	// 7. 업데이트 중 요청된 해제 처리
+	if (!PendingUnregisters.empty())
 	{
-		return;
+		TArray<UShapeComponent*> Unregisters = std::move(PendingUnregisters);
+		PendingUnregisters.clear();
+		for (UShapeComponent* Comp : Unregisters)
+		{
+			RemoveComponentInternal(Comp);
+		}
 	}
-
-	//UE_LOG("CollisionManager: Rebuilding BVH with {} components", RegisteredComponents.Num());
-
-	// BVH 완전 재구축
-	BVH->BulkUpdate(RegisteredComponents);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -206,12 +252,22 @@ void UCollisionManager::GetStats(int& OutTotalComponents, int& OutTotalNodes, in
 	OutMaxDepth = BVH->MaxOccupiedDepth();
 }
 
+void UCollisionManager::GetPairStats(int& OutActivePairs, int& OutNarrowTests, int& OutCachedPairs, int& OutOverlapEvents) const
+{
+	OutActivePairs = PairCache.Num();
+	OutNarrowTests = CollisionPairsChecked;
+	OutCachedPairs = CachedPairsReused;
+	OutOverlapEvents = OverlapEventsTriggered;
+}
+
 void UCollisionManager::DebugDump() const
 {
 	UE_LOG("===== CollisionManager Debug Info =====");
 	UE_LOG("Registered Components: {}", RegisteredComponents.Num());
 	UE_LOG("Dirty Components: {}", DirtyComponents.Num());
+	UE_LOG("Active Pairs (Pair Cache): {}", PairCache.Num());
 	UE_LOG("Collision Pairs Checked (Last Frame): {}", CollisionPairsChecked);
+	UE_LOG("Cached Pairs Reused (Last Frame): {}", CachedPairsReused);
 	UE_LOG("Overlap Events Triggered (Last Frame): {}", OverlapEventsTriggered);
 
 	int TotalComponents, TotalNodes, MaxDepth;
@@ -238,6 +294,8 @@ void UCollisionManager::UpdateBVHIncremental()
 	}
 
 	// Dirty 컴포넌트만 증분 업데이트
+	// 이미 트리에 있는 컴포넌트는 Refit으로 처리되므로 Dirty 비율과 무관하게 재구축하지 않음
+	// (트리 품질 저하 시 재구축 여부는 FCollisionBVH가 SAH 비용으로 판단)
 	for (UShapeComponent* Comp : DirtyComponents)
 	{
 		if (Comp && Comp->bGenerateOverlapEvents)
@@ -245,15 +303,196 @@ void UCollisionManager::UpdateBVHIncremental()
 			BVH->Update(Comp);
 		}
 	}
+}
 
-	// 너무 많은 컴포넌트가 Dirty면 완전 재구축
-	if (DirtyComponents.Num() > RegisteredComponents.Num() / 2)
+void UCollisionManager::ClearDirtyFlags()
+{
+	DirtyComponents.clear();
+}
+
+void UCollisionManager::UpdateSweepProxies()
+{
+	// 새 프록시(bDirty)와 이동한 프록시만 Bounds 갱신
+	for (FSweepProxy& Proxy : SweepProxies)
 	{
-		bNeedsFullRebuild = true;
+		const bool bRefresh = Proxy.bDirty || DirtyComponents.Contains(Proxy.Component);
+		Proxy.bMoved = bRefresh;
+		Proxy.bDirty = false;
+
+		if (bRefresh && Proxy.Component)
+		{
+			Proxy.Bounds = Proxy.Component->GetScaledBounds().GetBox();
+		}
+	}
+
+	// 삽입 정렬: 대부분 이미 정렬되어 있으므로 거의 O(N)
+	const int32 Count = SweepProxies.Num();
+	for (int32 i = 1; i < Count; ++i)
+	{
+		if (!(SweepProxies[i].Bounds.Min.X < SweepProxies[i - 1].Bounds.Min.X))
+		{
+			continue;
+		}
+
+		FSweepProxy Key = SweepProxies[i];
+		int32 j = i - 1;
+		while (j >= 0 && Key.Bounds.Min.X < SweepProxies[j].Bounds.Min.X)
+		{
+			SweepProxies[j + 1] = SweepProxies[j];
+			--j;
+		}
+		SweepProxies[j + 1] = Key;
 	}
 }
 
-void UCollisionManager::ClearDirtyFlags()
+void UCollisionManager::UpdateOverlapPairs()
 {
-	DirtyComponents.clear();
+	// Sweep: Min.X 순으로 훑으면서 X 구간이 겹치는 뒤쪽 프록시와만 비교 (각 쌍은 한 번만 방문)
+	const int32 Count = SweepProxies.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FSweepProxy& ProxyA = SweepProxies[i];
+		const FAABB& BoxA = ProxyA.Bounds;
+
+		for (int32 j = i + 1; j < Count; ++j)
+		{
+			const FSweepProxy& ProxyB = SweepProxies[j];
+			const FAABB& BoxB = ProxyB.Bounds;
+
+			// 정렬되어 있으므로 이후 프록시는 모두 X축에서 분리됨
+			if (BoxB.Min.X > BoxA.Max.X)
+			{
+				break;
+			}
+
+			// 나머지 축 검사
+			if (BoxB.Min.Y > BoxA.Max.Y || BoxB.Max.Y < BoxA.Min.Y ||
+				BoxB.Min.Z > BoxA.Max.Z || BoxB.Max.Z < BoxA.Min.Z)
+			{
+				continue;
+			}
+
+			ProcessCandidatePair(ProxyA, ProxyB);
+		}
+	}
+
+	// 이번 프레임에 Broad Phase를 통과하지 못한 쌍은 분리된 것으로 보고 제거
+	for (auto It = PairCache.begin(); It != PairCache.end();)
+	{
+		const FOverlapPair& Pair = It->second;
+		if (Pair.LastVisitedFrame == CollisionFrame)
+		{
+			++It;
+			continue;
+		}
+
+		if (Pair.bOverlapping)
+		{
+			PendingOverlapEvents.push_back({ Pair.A, Pair.B, false });
+			PendingOverlapEvents.push_back({ Pair.B, Pair.A, false });
+		}
+
+		const uint64 Key = It->first;
+		RemovePairKeyFromProxy(static_cast<uint32>(Key >> 32), Key);
+		RemovePairKeyFromProxy(static_cast<uint32>(Key), Key);
+		It = PairCache.erase(It);
+	}
+}
+
+void UCollisionManager::RemovePairKeyFromProxy(uint32 ProxyId, uint64 Key)
+{
+	TArray<uint64>* PairKeys = ProxyPairKeys.Find(ProxyId);
+	if (!PairKeys)
+	{
+		return;
+	}
+
+	const int32 Index = PairKeys->Find(Key);
+	if (Index != -1)
+	{
+		(*PairKeys)[Index] = PairKeys->Last();
+		PairKeys->pop_back();
+	}
+}
+
+void UCollisionManager::ProcessCandidatePair(const FSweepProxy& ProxyA, const FSweepProxy& ProxyB)
+{
+	UShapeComponent* CompA = ProxyA.Id < ProxyB.Id ? ProxyA.Component : ProxyB.Component;
+	UShapeComponent* CompB = ProxyA.Id < ProxyB.Id ? ProxyB.Component : ProxyA.Component;
+	if (!CompA || !CompB)
+	{
+		return;
+	}
+
+	const uint64 Key = MakePairKey(ProxyA.Id, ProxyB.Id);
+	FOverlapPair* Pair = PairCache.Find(Key);
+	const bool bIsNewPair = (Pair == nullptr);
+	if (bIsNewPair)
+	{
+		FOverlapPair NewPair;
+		NewPair.A = CompA;
+		NewPair.B = CompB;
+		Pair = &(PairCache[Key] = NewPair);
+
+		ProxyPairKeys[ProxyA.Id].push_back(Key);
+		ProxyPairKeys[ProxyB.Id].push_back(Key);
+	}
+	Pair->LastVisitedFrame = CollisionFrame;
+
+	// 파괴 예정인 액터가 포함된 쌍은 상태를 유지한 채 건너뜀
+	AActor* OwnerA = CompA->GetOwner();
+	AActor* OwnerB = CompB->GetOwner();
+	if (!OwnerA || OwnerA->IsPendingKill() || !OwnerB || OwnerB->IsPendingKill())
+	{
+		return;
+	}
+
+	// 둘 다 움직이지 않은 기존 쌍은 Narrow Phase 결과 재사용
+	if (!bIsNewPair && !ProxyA.bMoved && !ProxyB.bMoved)
+	{
+		++CachedPairsReused;
+		return;
+	}
+
+	++CollisionPairsChecked;
+
+	// Narrow Phase: 한 쪽의 정밀 테스트만 있고 다른 쪽은 Bounds 체크로 떨어지는 조합(예: Capsule vs Box)이 있으므로
+	// 타입이 다르면 양쪽 판정이 모두 참이어야 겹침으로 처리
+	bool bOverlapping = CompA->CanOverlapWith(CompB) && CompA->IsOverlappingComponent(CompB);
+	if (bOverlapping && CompA->GetClass() != CompB->GetClass())
+	{
+		bOverlapping = CompB->IsOverlappingComponent(CompA);
+	}
+
+	if (bOverlapping != Pair->bOverlapping)
+	{
+		Pair->bOverlapping = bOverlapping;
+		PendingOverlapEvents.push_back({ CompA, CompB, bOverlapping });
+		PendingOverlapEvents.push_back({ CompB, CompA, bOverlapping });
+	}
+}
+
+void UCollisionManager::DispatchOverlapEvents()
+{
+	if (PendingOverlapEvents.empty())
+	{
+		return;
+	}
+
+	// 핸들러에서 새 이벤트가 쌓일 수 없도록 복사본으로 처리
+	TArray<FPendingOverlapEvent> Events = std::move(PendingOverlapEvents);
+	PendingOverlapEvents.clear();
+
+	for (const FPendingOverlapEvent& Event : Events)
+	{
+		++OverlapEventsTriggered;
+		if (Event.bBegin)
+		{
+			Event.Self->NotifyBeginOverlap(Event.Other);
+		}
+		else
+		{
+			Event.Self->NotifyEndOverlap(Event.Other);
+		}
+	}
 }
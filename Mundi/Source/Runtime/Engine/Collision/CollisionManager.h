@@ -16,13 +16,14 @@ class URenderer;
  * UCollisionManager
  *
  * 월드의 모든 ShapeComponent를 관리하고 충돌 감지를 수행하는 중앙 관리자입니다.
- * BVH(Bounding Volume Hierarchy)를 사용하여 O(log N) 성능의 충돌 감지를 제공합니다.
+ * Broad Phase는 X축 Sweep and Prune으로 수행하며, 결과는 영속 Pair Cache에 누적됩니다.
  *
  * 주요 기능:
  * - ShapeComponent 등록/해제
- * - 매 프레임 충돌 감지 업데이트
- * - BVH 기반 공간 분할 최적화
- * - Overlap 이벤트 발생
+ * - 매 프레임 충돌 감지 업데이트 (각 쌍은 프레임당 한 번만 방문)
+ * - 두 컴포넌트 모두 움직이지 않은 쌍은 Narrow Phase 생략 (이전 결과 재사용)
+ * - Pair Cache 상태 변화(diff)로 Begin/End Overlap 이벤트 발생
+ * - BVH 기반 공간 쿼리 및 디버그 렌더링
  *
  * 사용법:
  * - World::Initialize()에서 생성
@@ -82,12 +83,6 @@ public:
 	 */
 	void UpdateCollisions(float DeltaTime);
 
-	/**
-	 * BVH를 강제로 재구축합니다.
-	 * 대량의 컴포넌트가 추가/제거/이동한 경우 호출합니다.
-	 */
-	void RebuildBVH();
-
 	// ────────────────────────────────────────────────
 	// 디버그
 	// ────────────────────────────────────────────────
@@ -108,6 +103,16 @@ public:
 	 */
 	void GetStats(int& OutTotalComponents, int& OutTotalNodes, int& OutMaxDepth) const;
 
+	/**
+	 * 마지막 프레임의 Pair Cache 통계를 반환합니다.
+	 *
+	 * @param OutActivePairs - Broad Phase를 통과해 캐시에 유지 중인 쌍 수
+	 * @param OutNarrowTests - Narrow Phase를 실제로 수행한 쌍 수
+	 * @param OutCachedPairs - 이전 결과를 재사용한 쌍 수
+	 * @param OutOverlapEvents - 발생한 Begin/End Overlap 이벤트 수
+	 */
+	void GetPairStats(int& OutActivePairs, int& OutNarrowTests, int& OutCachedPairs, int& OutOverlapEvents) const;
+
 	/**
 	 * 디버그 정보를 콘솔에 출력합니다.
 	 */
@@ -139,13 +144,56 @@ public:
 	bool bDebugDrawBVH = true;
 
 private:
+	// ────────────────────────────────────────────────
+	// Broad Phase / Pair Cache 자료구조
+	// ────────────────────────────────────────────────
+
+	/** Sweep and Prune 정렬 단위 */
+	struct FSweepProxy
+	{
+		UShapeComponent* Component = nullptr;
+
+		/** 캐시된 월드 AABB */
+		FAABB Bounds;
+
+		/** 프레임 간 유지되는 고유 ID (Pair Key 생성용) */
+		uint32 Id = 0;
+
+		/** 다음 업데이트에서 Bounds 갱신 필요 여부 */
+		bool bDirty = true;
+
+		/** 이번 프레임에 Bounds가 갱신되었는지 여부 (Narrow Phase 캐시 무효화용) */
+		bool bMoved = true;
+	};
+
+	/** Pair Cache 항목 (A, B는 프록시 ID 오름차순) */
+	struct FOverlapPair
+	{
+		UShapeComponent* A = nullptr;
+		UShapeComponent* B = nullptr;
+
+		/** 마지막으로 Broad Phase를 통과한 프레임 */
+		uint32 LastVisitedFrame = 0;
+
+		/** 마지막 Narrow Phase 결과 */
+		bool bOverlapping = false;
+	};
+
+	/** 지연 발생되는 Overlap 이벤트 */
+	struct FPendingOverlapEvent
+	{
+		UShapeComponent* Self = nullptr;
+		UShapeComponent* Other = nullptr;
+		bool bBegin = false;
+	};
+
 	// ────────────────────────────────────────────────
 	// 내부 함수
 	// ────────────────────────────────────────────────
 
 	/**
 	 * 증분 BVH 업데이트를 수행합니다.
-	 * DirtyComponents만 업데이트합니다.
+	 * DirtyComponents만 업데이트하며, BVH는 이를 Refit으로 반영합니다.
 	 */
 	void UpdateBVHIncremental();
 
@@ -154,6 +202,52 @@ private:
 	 */
 	void ClearDirtyFlags();
 
+	/**
+	 * Sweep 프록시의 Bounds를 갱신하고 Min.X 기준 정렬을 유지합니다.
+	 * 새로 등록되었거나 이동한 프록시만 갱신하며, 프레임 간 순서 변화가 적으므로 삽입 정렬을 사용합니다.
+	 */
+	void UpdateSweepProxies();
+
+	/**
+	 * X축 Sweep and Prune으로 후보 쌍을 찾고 Pair Cache를 갱신합니다.
+	 * 발생한 Overlap 이벤트는 PendingOverlapEvents에 쌓입니다.
+	 */
+	void UpdateOverlapPairs();
+
+	/**
+	 * Broad Phase를 통과한 한 쌍을 처리합니다.
+	 * 두 컴포넌트가 모두 움직이지 않았다면 캐시된 Narrow Phase 결과를 재사용합니다.
+	 */
+	void ProcessCandidatePair(const FSweepProxy& ProxyA, const FSweepProxy& ProxyB);
+
+	/**
+	 * 쌓여있는 Overlap 이벤트를 순서대로 발생시킵니다.
+	 * 이벤트 핸들러가 컴포넌트를 등록/해제하더라도 안전하도록 내부 자료구조 순회가 끝난 뒤 호출합니다.
+	 */
+	void DispatchOverlapEvents();
+
+	/**
+	 * 컴포넌트를 실제로 해제합니다. 겹쳐있던 상대에게는 End Overlap 이벤트를 발생시킵니다.
+	 *
+	 * @param Component - 해제할 컴포넌트
+	 */
+	void RemoveComponentInternal(UShapeComponent* Component);
+
+	/**
+	 * 프록시의 쌍 목록에서 Pair Key 하나를 지웁니다. (목록이 짧으므로 선형 탐색 후 swap 제거)
+	 */
+	void RemovePairKeyFromProxy(uint32 ProxyId, uint64 Key);
+
+	/**
+	 * 두 프록시 ID로 순서와 무관한 Pair Key를 만듭니다.
+	 */
+	static uint64 MakePairKey(uint32 IdA, uint32 IdB)
+	{
+		return IdA < IdB
+			? (static_cast<uint64>(IdA) << 32) | IdB
+			: (static_cast<uint64>(IdB) << 32) | IdA;
+	}
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -168,14 +262,41 @@ private:
 	TArray<UShapeComponent*> RegisteredComponents;
 
 	/** 이동한 컴포넌트 (증분 업데이트용) */
-	TArray<UShapeComponent*> DirtyComponents;
+	TSet<UShapeComponent*> DirtyComponents;
+
+	/** 컴포넌트 -> 프록시 ID (등록 여부 O(1) 조회 겸용) */
+	TMap<UShapeComponent*, uint32> ComponentProxyIds;
+
+	/** Min.X 기준으로 정렬된 Sweep 프록시 배열 */
+	TArray<FSweepProxy> SweepProxies;
+
+	/** 영속 Pair Cache (Key: MakePairKey) */
+	TMap<uint64, FOverlapPair> PairCache;
 
-	/** 완전 재구축 필요 여부 */
-	bool bNeedsFullRebuild = false;
+	/** 프록시 ID -> 그 프록시가 속한 Pair Key 목록 (해제 시 전체 캐시 순회 방지) */
+	TMap<uint32, TArray<uint64>> ProxyPairKeys;
 
-	/** 이번 프레임에 처리된 충돌 쌍 수 (통계용) */
+	/** 이번 프레임에 발생시킬 Overlap 이벤트 */
+	TArray<FPendingOverlapEvent> PendingOverlapEvents;
+
+	/** UpdateCollisions 중 요청된 해제 (이벤트 발생 후 처리) */
+	TArray<UShapeComponent*> PendingUnregisters;
+
+	/** 다음에 발급할 프록시 ID */
+	uint32 NextProxyId = 1;
+
+	/** UpdateCollisions 호출 횟수 (Pair Cache 방문 표시용) */
+	uint32 CollisionFrame = 0;
+
+	/** UpdateCollisions 실행 중 여부 (재진입 보호) */
+	bool bIsUpdatingCollisions = false;
+
+	/** 이번 프레임에 Narrow Phase를 수행한 충돌 쌍 수 (통계용) */
 	int32 CollisionPairsChecked = 0;
 
+	/** 이번 프레임에 캐시된 결과를 재사용한 충돌 쌍 수 (통계용) */
+	int32 CachedPairsReused = 0;
+
 	/** 이번 프레임에 발생한 Overlap 이벤트 수 (통계용) */
 	int32 OverlapEventsTriggered = 0;
 };
@@ -148,6 +148,34 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    // 행 벡터 규약: clip = v * M 이므로 clip의 각 성분은 M의 열과의 내적
+    // Gribb-Hartmann: -w <= x <= w, -w <= y <= w, 0 <= z <= w
+    const FMatrix& M = ViewProjection;
+    auto ColumnPlane = [&M](float SignX, float SignY, float SignZ, float SignW)
+    {
+        const float A = SignX * M.M[0][0] + SignY * M.M[0][1] + SignZ * M.M[0][2] + SignW * M.M[0][3];
+        const float B = SignX * M.M[1][0] + SignY * M.M[1][1] + SignZ * M.M[1][2] + SignW * M.M[1][3];
+        const float C = SignX * M.M[2][0] + SignY * M.M[2][1] + SignZ * M.M[2][2] + SignW * M.M[2][3];
+        const float D = SignX * M.M[3][0] + SignY * M.M[3][1] + SignZ * M.M[3][2] + SignW * M.M[3][3];
+
+        // A*x + B*y + C*z + D >= 0 이 안쪽 → Normal = (A, B, C) / Len, Distance = -D / Len
+        const float Length = std::sqrt(A * A + B * B + C * C);
+        const float InvLength = Length > KINDA_SMALL_NUMBER ? 1.0f / Length : 0.0f;
+        return FPlane{ FVector4(A * InvLength, B * InvLength, C * InvLength, 0.0f), -D * InvLength };
+    };
+
+    FFrustum Result;
+    Result.LeftFace = ColumnPlane(1.0f, 0.0f, 0.0f, 1.0f);
+    Result.RightFace = ColumnPlane(-1.0f, 0.0f, 0.0f, 1.0f);
+    Result.BottomFace = ColumnPlane(0.0f, 1.0f, 0.0f, 1.0f);
+    Result.TopFace = ColumnPlane(0.0f, -1.0f, 0.0f, 1.0f);
+    Result.NearFace = ColumnPlane(0.0f, 0.0f, 1.0f, 0.0f);
+    Result.FarFace = ColumnPlane(0.0f, 0.0f, -1.0f, 1.0f);
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
@@ -252,6 +252,9 @@ AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraAct
 		// Skip hidden actors for picking
 		if (Actor->GetActorHiddenInEditor()) continue;
 
+		// 풀에 반납된 액터는 같은 프레임 동안 레벨 목록에 남아 있어도 제외
+		if (Actor->IsPooled()) continue;
+
 		float hitDistance;
 		if (CheckActorPicking(Actor, ray, hitDistance))
 		{
@@ -309,6 +312,9 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 		// Skip hidden actors for picking
 		if (Actor->GetActorHiddenInEditor()) continue;
 
+		// 풀에 반납된 액터는 같은 프레임 동안 레벨 목록에 남아 있어도 제외
+		if (Actor->IsPooled()) continue;
+
 		float hitDistance;
 		if (CheckActorPicking(Actor, ray, hitDistance))
 		{
@@ -683,7 +689,7 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 			if (BVH)
 			{
 				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
+				if (BVH->IntersectRay(LocalRay, THitLocal))
 				{
 					const FVector HitLocal = FVector(
 						LocalOrigin4.X + LocalDir4.X * THitLocal,
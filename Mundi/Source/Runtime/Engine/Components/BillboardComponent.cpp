@@ -54,6 +54,16 @@ void UBillboardComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface*
 	Material = InNewMaterial;
 }
 
+FAABB UBillboardComponent::GetWorldAABB() const
+{
+	// 쿼드는 로컬 -0.5~0.5 이고 어느 방향으로든 회전할 수 있으므로 대각선 반경으로 감싼다
+	const float Scale = GetRelativeScale().GetMaxValue();
+	const float HalfExtent = Scale * 0.70710678f;
+	const FVector Center = GetWorldLocation();
+	const FVector Extent(HalfExtent, HalfExtent, HalfExtent);
+	return FAABB(Center - Extent, Center + Extent);
+}
+
 void UBillboardComponent::OnSerialized()
 {
 	Super::OnSerialized();
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
 #include "Object.h"
+#include "AABB.h"
 
 class UQuad;
 class UTexture;
@@ -27,6 +28,9 @@ public:
     UMaterialInterface* GetMaterial(uint32 InSectionIndex) const override;
     void SetMaterial(uint32 InElementIndex, UMaterialInterface* InNewMaterial) override;
 
+    // 카메라 방향과 무관하게 쿼드를 감싸는 월드 AABB (컬링용)
+    FAABB GetWorldAABB() const;
+
     // Serialize
     void OnSerialized() override;
 
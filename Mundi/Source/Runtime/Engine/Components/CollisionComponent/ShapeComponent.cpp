@@ -109,17 +109,9 @@ void UShapeComponent::UpdateOverlaps(const TArray<UShapeComponent*>& OtherCompon
 			continue; // 자기 자신은 제외
 		}
 
-		// AGravityWall끼리는 충돌 무시 (For GameJam 나중에 충돌 필터링으로 대체해야함.)
-		AActor* MyOwner = GetOwner();
-		AActor* OtherOwner = OtherComp->GetOwner();
-		if (MyOwner && OtherOwner)
+		if (!CanOverlapWith(OtherComp))
 		{
-			AGravityWall* MyWall = Cast<AGravityWall>(MyOwner);
-			AGravityWall* OtherWall = Cast<AGravityWall>(OtherOwner);
-			if (MyWall && OtherWall)
-			{
-				continue; // 둘 다 GravityWall이면 충돌 무시
-			}
+			continue;
 		}
 
 		if (IsOverlappingComponent(OtherComp))
@@ -208,6 +200,89 @@ void UShapeComponent::UpdateOverlaps(const TArray<UShapeComponent*>& OtherCompon
 	bIsOverlapping = !OverlapInfos.empty();
 }
 
+/**
+ * 상대 컴포넌트와 Overlap 판정을 수행해도 되는 조합인지 확인합니다.
+ *
+ * @param Other - 확인할 상대방 Shape 컴포넌트
+ * @return 판정 대상이면 true
+ */
+bool UShapeComponent::CanOverlapWith(const UShapeComponent* Other) const
+{
+	if (!Other || Other == this || !bGenerateOverlapEvents || !Other->bGenerateOverlapEvents)
+	{
+		return false;
+	}
+
+	// AGravityWall끼리는 충돌 무시 (For GameJam 나중에 충돌 필터링으로 대체해야함.)
+	AActor* MyOwner = GetOwner();
+	AActor* OtherOwner = Other->GetOwner();
+	if (MyOwner && OtherOwner)
+	{
+		if (Cast<AGravityWall>(MyOwner) && Cast<AGravityWall>(OtherOwner))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * 새 Overlap을 기록하고 Begin Overlap 이벤트를 발생시킵니다.
+ *
+ * @param OtherComp - 겹치기 시작한 상대방 컴포넌트
+ */
+void UShapeComponent::NotifyBeginOverlap(UShapeComponent* OtherComp)
+{
+	if (!OtherComp || FindOverlapInfo(OtherComp))
+	{
+		return;
+	}
+
+	// 파괴 예정인 컴포넌트는 새 Overlap을 기록하지 않음
+	AActor* Owner = GetOwner();
+	if (!Owner || Owner->IsPendingKill())
+	{
+		return;
+	}
+
+	AActor* OtherActor = OtherComp->GetOwner();
+	FVector ContactPoint = (GetScaledBounds().Origin + OtherComp->GetScaledBounds().Origin) * 0.5f;
+	float PenetrationDepth = 0.0f; // 추후 정밀 계산 추가 가능
+
+	OverlapInfos.push_back(FOverlapInfo(OtherComp, OtherActor, ContactPoint, PenetrationDepth, false));
+	bIsOverlapping = true;
+
+	OnComponentBeginOverlap.Broadcast(this, OtherActor, OtherComp, ContactPoint, PenetrationDepth);
+}
+
+/**
+ * Overlap 기록을 제거하고 End Overlap 이벤트를 발생시킵니다.
+ *
+ * @param OtherComp - 더 이상 겹치지 않는 상대방 컴포넌트
+ */
+void UShapeComponent::NotifyEndOverlap(UShapeComponent* OtherComp)
+{
+	FOverlapInfo* ExistingInfo = FindOverlapInfo(OtherComp);
+	if (!ExistingInfo)
+	{
+		return;
+	}
+
+	// Broadcast 중 OverlapInfos가 변경될 수 있으므로 복사 후 제거
+	const FOverlapInfo Info = *ExistingInfo;
+	RemoveOverlapInfo(OtherComp);
+	bIsOverlapping = !OverlapInfos.empty();
+
+	AActor* Owner = GetOwner();
+	if (!Owner || Owner->IsPendingKill())
+	{
+		return;
+	}
+
+	OnComponentEndOverlap.Broadcast(this, Info.OtherActor, Info.OtherComponent, Info.ContactPoint, Info.PenetrationDepth);
+}
+
 /**
  * 특정 컴포넌트와의 Overlap 정보를 찾습니다.
  *
@@ -302,6 +377,36 @@ void UShapeComponent::EndPlay(EEndPlayReason Reason)
 	}
 }
 
+void UShapeComponent::OnActorPooled()
+{
+	bCollisionRegisteredBeforePool = false;
+	if (UWorld* World = GetWorld())
+	{
+		if (UCollisionManager* Manager = World->GetCollisionManager())
+		{
+			bCollisionRegisteredBeforePool = Manager->GetRegisteredComponents().Contains(this);
+			Manager->UnregisterComponent(this);
+		}
+	}
+}
+
+void UShapeComponent::OnActorUnpooled()
+{
+	if (!bCollisionRegisteredBeforePool)
+	{
+		return;
+	}
+	bCollisionRegisteredBeforePool = false;
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UCollisionManager* Manager = World->GetCollisionManager())
+		{
+			Manager->RegisterComponent(this);
+		}
+	}
+}
+
 /**
  * 컴포넌트가 파괴될 때 호출됩니다.
  * CollisionManager에서 자동 해제됩니다.
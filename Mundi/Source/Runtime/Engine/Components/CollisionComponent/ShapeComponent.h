@@ -145,8 +145,32 @@ public:
 	virtual bool IsOverlappingComponent(const UShapeComponent* Other) const;
 
 	/**
-	 * 현재 Overlap 상태를 업데이트하고 이벤트를 발생시킵니다.
-	 * 매 프레임 호출되어 Overlap 상태 변화를 감지합니다.
+	 * 상대 컴포넌트와 Overlap 판정을 수행해도 되는 조합인지 확인합니다 (충돌 필터링).
+	 *
+	 * @param Other - 확인할 상대방 Shape 컴포넌트
+	 * @return 판정 대상이면 true
+	 */
+	bool CanOverlapWith(const UShapeComponent* Other) const;
+
+	/**
+	 * 새 Overlap을 기록하고 Begin Overlap 이벤트를 발생시킵니다.
+	 * CollisionManager의 Pair Cache가 상태 변화를 감지했을 때 호출합니다.
+	 *
+	 * @param OtherComp - 겹치기 시작한 상대방 컴포넌트
+	 */
+	void NotifyBeginOverlap(UShapeComponent* OtherComp);
+
+	/**
+	 * Overlap 기록을 제거하고 End Overlap 이벤트를 발생시킵니다.
+	 * 기록이 없으면 아무것도 하지 않습니다.
+	 *
+	 * @param OtherComp - 더 이상 겹치지 않는 상대방 컴포넌트
+	 */
+	void NotifyEndOverlap(UShapeComponent* OtherComp);
+
+	/**
+	 * 주어진 후보들로 Overlap 상태를 업데이트하고 이벤트를 발생시킵니다.
+	 * CollisionManager는 Pair Cache를 사용하므로 이 함수를 호출하지 않습니다 (수동 갱신용).
 	 *
 	 * @param OtherComponents - 확인할 다른 Shape 컴포넌트들의 배열
 	 */
@@ -189,6 +213,16 @@ protected:
 
 	//virtual void EndPlay();
 
+	/**
+	 * 액터 풀 반납/재사용 시 CollisionManager 등록을 해제/복구합니다.
+	 * 반납 시점에 등록되어 있던 경우에만 복구합니다 (에디터 월드 등 BeginPlay 전 상태 유지).
+	 */
+	void OnActorPooled() override;
+	void OnActorUnpooled() override;
+
+	/** 풀 반납 시점에 CollisionManager에 등록되어 있었는지 여부 */
+	bool bCollisionRegisteredBeforePool = false;
+
 	/**
 	 * Transform이 변경될 때 호출됩니다.
 	 * CollisionManager에 Dirty 마킹합니다.
@@ -8,6 +8,8 @@
 #include "Renderer.h"
 #include "ResourceManager.h"
 #include "MeshBatchElement.h"
+#include "SceneView.h"
+#include "FrameLinearAllocator.h"
 #include "LightComponent.h"
 
 IMPLEMENT_CLASS(UParticleComponent)
@@ -156,11 +158,16 @@ void UParticleComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBa
 	}
 	BatchElement.InstanceColor = Color;
 
-	// CustomData에 스프라이트 애니메이션 정보 추가
-	BatchElement.CustomData.clear();
-	BatchElement.CustomData.push_back(static_cast<float>(SpriteRows));
-	BatchElement.CustomData.push_back(static_cast<float>(SpriteColumns));
-	BatchElement.CustomData.push_back(CurrentFrame);
+	// CustomData에 스프라이트 애니메이션 정보 추가 (프레임 아레나에 기록, 아레나가 없으면 애니메이션 없이 그림)
+	if (View && View->FrameAllocator)
+	{
+		float* SpriteData = View->FrameAllocator->AllocateArray<float>(3);
+		SpriteData[0] = static_cast<float>(SpriteRows);
+		SpriteData[1] = static_cast<float>(SpriteColumns);
+		SpriteData[2] = CurrentFrame;
+		BatchElement.CustomData = SpriteData;
+		BatchElement.CustomDataCount = 3;
+	}
 
 	OutMeshBatchElements.Add(BatchElement);
 }
@@ -110,6 +110,22 @@ void UPointLightComponent::OnUnregister()
 	}
 }
 
+void UPointLightComponent::OnActorPooled()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetLightManager()->DeRegisterLight(this);
+	}
+}
+
+void UPointLightComponent::OnActorUnpooled()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetLightManager()->RegisterLight(this);
+	}
+}
+
 void UPointLightComponent::RenderDebugVolume(URenderer* Renderer) const
 {
 	// PointLight의 구형 볼륨을 3개의 원으로 렌더링 (XY, XZ, YZ 평면)
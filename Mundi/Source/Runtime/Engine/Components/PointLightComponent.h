@@ -25,6 +25,8 @@ public:
 	void OnTransformUpdated() override;
 	void OnRegister(UWorld* InWorld) override;
 	void OnUnregister()	override;
+	void OnActorPooled() override;
+	void OnActorUnpooled() override;
 
 	// Debug Rendering
 	virtual void RenderDebugVolume(class URenderer* Renderer) const override;
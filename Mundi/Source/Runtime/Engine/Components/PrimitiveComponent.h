@@ -33,24 +33,10 @@ public:
     // 내부적으로 ResourceManager를 통해 UMaterial*를 찾아 SetMaterial을 호출합니다.
     void SetMaterialByName(uint32 InElementIndex, const FString& MaterialName);
 
-
-    void SetCulled(bool InCulled)
-    {
-        bIsCulled = InCulled;
-    }
-
-    bool GetCulled() const
-    {
-        return bIsCulled;
-    }
-
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
     DECLARE_DUPLICATE(UPrimitiveComponent)
 
     // ───── 직렬화 ────────────────────────────
     virtual void OnSerialized() override;
-
-protected:
-    bool bIsCulled = false;
 };
\ No newline at end of file
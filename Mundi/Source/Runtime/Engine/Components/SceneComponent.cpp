@@ -5,6 +5,9 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "TransformStats.h"
+#include "Actor.h"
+#include <random>
 
 IMPLEMENT_CLASS(USceneComponent)
 
@@ -41,7 +44,16 @@ USceneComponent::~USceneComponent()
         AttachParent->AttachChildren.Remove(this);
     }
     AttachParent = nullptr;
-    AttachChildren.clear();
+
+    // 자식의 저장소 엔트리가 곧 제거될 이 컴포넌트를 부모로 가리키지 않도록 OnUnregister와 같이 끊는다
+    DetachAllChildren();
+
+    // 기반 클래스 소멸자의 UnregisterComponent는 이 클래스의 OnUnregister를 부르지 못하므로 직접 제거
+    if (TransformStore)
+    {
+        TransformStore->Remove(TransformHandle);
+        TransformStore = nullptr;
+    }
 }
 
 // ──────────────────────────────
@@ -121,15 +133,184 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
+    if (TransformStore)
+    {
+        return TransformStore->GetWorldTransform(TransformHandle);
+    }
+
+    if (!bWorldTransformDirty)
+    {
+        FTransformStatManager::GetInstance().AddCacheHit();
+        return CachedWorldTransform;
+    }
+
     // Dangling pointer 방지를 위한 체크
-     if (AttachParent && !AttachParent->IsPendingDestroy())
+    if (AttachParent && !AttachParent->IsPendingDestroy())
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        CachedWorldTransform = AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        FTransformStatManager::GetInstance().AddComposition();
     }
+    else
+    {
+        CachedWorldTransform = RelativeTransform;
+    }
+    bWorldTransformDirty = false;
+
+    return CachedWorldTransform;
+}
 
+FTransform USceneComponent::ComputeWorldTransformUncached(uint32* OutCompositionCount) const
+{
+    if (AttachParent && !AttachParent->IsPendingDestroy())
+    {
+        if (OutCompositionCount)
+        {
+            ++*OutCompositionCount;
+        }
+        return AttachParent->ComputeWorldTransformUncached(OutCompositionCount).GetWorldTransform(RelativeTransform);
+    }
     return RelativeTransform;
 }
 
+int32 USceneComponent::VerifyWorldTransformCache(UWorld* World, int32 Rounds, int32& OutCheckCount, float& OutMaxError)
+{
+    OutCheckCount = 0;
+    OutMaxError = 0.0f;
+    if (!World || Rounds <= 0)
+    {
+        return 0;
+    }
+
+    TArray<USceneComponent*> Components;
+    for (AActor* Actor : World->GetActors())
+    {
+        if (Actor && !Actor->IsPendingDestroy() && !Actor->IsPooled())
+        {
+            for (USceneComponent* Component : Actor->GetSceneComponents())
+            {
+                if (Component && !Component->IsPendingDestroy())
+                {
+                    Components.Add(Component);
+                }
+            }
+        }
+    }
+    if (Components.IsEmpty())
+    {
+        return 0;
+    }
+
+    // 검증 후 되돌릴 원래 상태 (재부착은 형제 순서를 바꾸므로 자식 목록도 보관)
+    struct FSavedState
+    {
+        FVector Location;
+        FQuat Rotation;
+        FVector Scale;
+        FVector RotationEuler;
+        TArray<USceneComponent*> Children;
+    };
+    TArray<FSavedState> SavedStates;
+    SavedStates.reserve(Components.Num());
+    for (USceneComponent* Component : Components)
+    {
+        SavedStates.Add({ Component->RelativeLocation, Component->RelativeRotation, Component->RelativeScale,
+            Component->RelativeRotationEuler, Component->AttachChildren });
+    }
+
+    FTransformStatManager& TransformStats = FTransformStatManager::GetInstance();
+    const FTransformFrameStats SavedStats = TransformStats.GetCurrentStats();
+
+    // 행렬 원소별 오차 (값이 큰 이동 성분은 상대 오차)
+    auto MatrixError = [](const FMatrix& A, const FMatrix& B)
+    {
+        float MaxError = 0.0f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col)
+            {
+                const float Diff = std::fabs(A.M[Row][Col] - B.M[Row][Col]);
+                MaxError = std::max(MaxError, Diff / std::max(1.0f, std::fabs(B.M[Row][Col])));
+            }
+        }
+        return MaxError;
+    };
+    constexpr float Tolerance = 1e-3f;
+
+    std::mt19937 Rng(1234);
+    std::uniform_int_distribution<int32> PickDist(0, Components.Num() - 1);
+    std::uniform_real_distribution<float> OpDist(0.0f, 1.0f);
+    std::uniform_real_distribution<float> OffsetDist(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> AngleDist(-180.0f, 180.0f);
+    std::uniform_real_distribution<float> ScaleDist(0.5f, 2.0f);
+    const int32 OpsPerRound = std::min(Components.Num(), 64);
+
+    FTransformStore* Store = World->GetTransformStore();
+    int32 MismatchCount = 0;
+    for (int32 Round = 0; Round < Rounds; ++Round)
+    {
+        for (int32 Op = 0; Op < OpsPerRound; ++Op)
+        {
+            USceneComponent* Component = Components[PickDist(Rng)];
+            const float OpRoll = OpDist(Rng);
+            if (OpRoll < 0.3f)
+            {
+                Component->SetRelativeLocation(Component->RelativeLocation + FVector(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng)));
+            }
+            else if (OpRoll < 0.6f)
+            {
+                Component->SetRelativeRotation(FQuat::MakeFromEulerZYX(FVector(AngleDist(Rng), AngleDist(Rng), AngleDist(Rng))));
+            }
+            else if (OpRoll < 0.8f)
+            {
+                const float Scale = ScaleDist(Rng);
+                Component->SetRelativeScale(FVector(Scale, Scale, Scale));
+            }
+            else if (USceneComponent* Parent = Component->AttachParent)
+            {
+                // 저장소 부모 변경/재정렬 경로 (같은 부모로 다시 붙인다)
+                Component->DetachFromParent(true);
+                Component->SetupAttachment(Parent, EAttachmentRule::KeepWorld);
+            }
+        }
+
+        // 짝수 라운드는 프레임 일괄 갱신, 홀수 라운드는 조회 시 지연 계산 경로를 검사
+        if (Store && Round % 2 == 0)
+        {
+            Store->UpdateWorldTransforms();
+        }
+
+        for (USceneComponent* Component : Components)
+        {
+            const FMatrix Expected = Component->ComputeWorldTransformUncached().ToMatrix();
+            const float Error = std::max(MatrixError(Component->GetWorldTransform().ToMatrix(), Expected),
+                MatrixError(Component->GetWorldMatrix(), Expected));
+            OutMaxError = std::max(OutMaxError, Error);
+            MismatchCount += (Error > Tolerance) ? 1 : 0;
+            ++OutCheckCount;
+        }
+    }
+
+    // 원래 상태로 복원 (자식 목록을 먼저 되돌린 뒤 트랜스폼을 다시 써서 자손까지 무효화)
+    for (int32 i = 0; i < Components.Num(); ++i)
+    {
+        Components[i]->AttachChildren = SavedStates[i].Children;
+    }
+    for (int32 i = 0; i < Components.Num(); ++i)
+    {
+        USceneComponent* Component = Components[i];
+        const FSavedState& State = SavedStates[i];
+        Component->RelativeLocation = State.Location;
+        Component->RelativeRotation = State.Rotation;
+        Component->RelativeScale = State.Scale;
+        Component->RelativeRotationEuler = State.RotationEuler;
+        Component->UpdateRelativeTransform();
+        Component->OnTransformUpdated();
+    }
+
+    TransformStats.SetCurrentStats(SavedStats);
+    return MismatchCount;
+}
+
 void USceneComponent::SetWorldTransform(const FTransform& W)
 {
     // Dangling pointer 방지를 위한 체크
@@ -147,6 +328,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
+    OnRelativeTransformChanged();
     OnTransformUpdated();
 }
  
@@ -234,7 +416,17 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    return GetWorldTransform().ToMatrix();
+    if (TransformStore)
+    {
+        return TransformStore->GetWorldMatrix(TransformHandle);
+    }
+
+    if (bWorldMatrixDirty)
+    {
+        CachedWorldMatrix = GetWorldTransform().ToMatrix();
+        bWorldMatrixDirty = false;
+    }
+    return CachedWorldMatrix;
 }
 
 // ──────────────────────────────
@@ -276,6 +468,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    OnAttachParentChanged();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -296,6 +489,7 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    OnAttachParentChanged();
 }
 
 void USceneComponent::DuplicateSubObjects()
@@ -306,6 +500,12 @@ void USceneComponent::DuplicateSubObjects()
     SpriteComponent = nullptr;
 
     AttachChildren.clear(); // Actor에서 할당해줌
+
+    // 원본의 저장소 엔트리와 캐시를 물려받지 않는다 (등록 시 새로 할당)
+    TransformStore = nullptr;
+    TransformHandle = FTransformHandle();
+    bWorldTransformDirty = true;
+    bWorldMatrixDirty = true;
 }
 
 // ──────────────────────────────
@@ -314,6 +514,80 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    OnRelativeTransformChanged();
+}
+
+void USceneComponent::OnRelativeTransformChanged()
+{
+    if (TransformStore)
+    {
+        TransformStore->SetLocalTransform(TransformHandle, RelativeTransform);
+    }
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::OnAttachParentChanged()
+{
+    if (TransformStore)
+    {
+        TransformStore->SetParent(TransformHandle, AttachParent);
+        TransformStore->SetLocalTransform(TransformHandle, RelativeTransform);
+    }
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::DetachAllChildren()
+{
+    TArray<USceneComponent*> ChildrenCopy = AttachChildren;
+    for (USceneComponent* Child : ChildrenCopy)
+    {
+        if (!Child)
+        {
+            continue;
+        }
+
+        if (!Child->IsPendingDestroy())
+        {
+            Child->AttachParent = nullptr;
+            Child->OnAttachParentChanged();
+        }
+        else if (Child->TransformStore)
+        {
+            // 파괴 대기 중인 자식은 그대로 두되, 저장소 엔트리가 해제 후 재사용될 이 컴포넌트의 핸들을 부모로 가리키지 않게 한다
+            Child->TransformStore->SetParent(Child->TransformHandle, nullptr);
+        }
+    }
+    AttachChildren.clear();
+}
+
+void USceneComponent::MarkWorldTransformDirty()
+{
+    // 이미 더티면 자손도 모두 더티
+    if (TransformStore)
+    {
+        if (TransformStore->IsDirty(TransformHandle))
+        {
+            return;
+        }
+        TransformStore->MarkDirty(TransformHandle);
+    }
+    else
+    {
+        if (bWorldTransformDirty)
+        {
+            return;
+        }
+        bWorldTransformDirty = true;
+        bWorldMatrixDirty = true;
+    }
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
+    }
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -352,6 +626,29 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 void USceneComponent::OnRegister(UWorld* InWorld)
 {
+    // 월드 트랜스폼 저장소에 엔트리 할당. 먼저 등록된 자식은 저장소 밖 부모로 잡혀 있었으므로 핸들 참조로 바꾼다
+    if (FTransformStore* Store = InWorld ? InWorld->GetTransformStore() : nullptr; Store && !TransformStore)
+    {
+        TransformStore = Store;
+        TransformHandle = Store->Add(this, RelativeTransform, AttachParent);
+        for (USceneComponent* Child : AttachChildren)
+        {
+            if (Child && Child->TransformStore == Store)
+            {
+                Store->SetParent(Child->TransformHandle, this);
+            }
+        }
+
+        // 새 엔트리는 더티로 시작하므로 "더티 노드의 자손은 모두 더티" 불변식을 맞춘다
+        for (USceneComponent* Child : AttachChildren)
+        {
+            if (Child)
+            {
+                Child->MarkWorldTransformDirty();
+            }
+        }
+    }
+
     if (!std::strcmp(this->GetClass()->Name , USceneComponent::StaticClass()->Name) && !SpriteComponent && !InWorld->bPie)
     {
         CREATE_EDITOR_COMPONENT(SpriteComponent, UBillboardComponent);
@@ -366,15 +663,7 @@ void USceneComponent::OnUnregister()
     // 이 시점에서 정리하면 소멸자보다 먼저 실행되어 안전함
 
     // 자식들의 AttachParent 참조 끊기
-    TArray<USceneComponent*> ChildrenCopy = AttachChildren;
-    for (USceneComponent* Child : ChildrenCopy)
-    {
-        if (Child && !Child->IsPendingDestroy())
-        {
-            Child->AttachParent = nullptr;
-        }
-    }
-    AttachChildren.clear();
+    DetachAllChildren();
 
     // 부모에서 자신 제거
     if (AttachParent && !AttachParent->IsPendingDestroy())
@@ -383,6 +672,16 @@ void USceneComponent::OnUnregister()
     }
     AttachParent = nullptr;
 
+    // 저장소에서 빠지면 객체 내 캐시로 돌아가므로 다시 계산하도록 더티 처리
+    if (TransformStore)
+    {
+        TransformStore->Remove(TransformHandle);
+        TransformStore = nullptr;
+        TransformHandle = FTransformHandle();
+    }
+    bWorldTransformDirty = true;
+    bWorldMatrixDirty = true;
+
     Super::OnUnregister();
 }
 
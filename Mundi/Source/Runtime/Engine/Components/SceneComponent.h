@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Vector.h"
 #include "ActorComponent.h"
+#include "TransformStore.h"
 
 // 부착 시 로컬을 유지할지, 월드를 유지할지
 enum class EAttachmentRule
@@ -45,6 +46,8 @@ public:
 
     // ──────────────────────────────
     // World Transform API
+    // 월드 트랜스폼/행렬은 캐시되며, 로컬 트랜스폼이나 부착 관계가 바뀌면 자손까지 더티 처리 후 조회 시 다시 계산한다 (메인 스레드 전용)
+    // 월드에 등록된 동안은 캐시가 월드의 FTransformStore에 있고 핸들로 읽고 쓴다
     // ──────────────────────────────
     FTransform GetWorldTransform() const;
     void SetWorldTransform(const FTransform& W);
@@ -68,6 +71,18 @@ public:
 
     FMatrix GetWorldMatrix() const; // ToMatrixWithScale
 
+    // 캐시를 거치지 않고 매번 부착 체인 전체를 합성한 월드 트랜스폼 (캐시 도입 전 방식, 벤치마크/검증용)
+    // OutCompositionCount가 있으면 수행한 합성 횟수를 더한다
+    FTransform ComputeWorldTransformUncached(uint32* OutCompositionCount = nullptr) const;
+
+    // World의 씬 컴포넌트에 무작위 이동/회전/스케일/재부착을 Rounds번 가하며 캐시된 월드 트랜스폼과 행렬을
+    // ComputeWorldTransformUncached 결과와 비교한다 (콘솔 검증용). 끝나면 원래 트랜스폼과 부착 순서로 되돌린다
+    // @return 허용 오차를 넘은 비교 수
+    static int32 VerifyWorldTransformCache(UWorld* World, int32 Rounds, int32& OutCheckCount, float& OutMaxError);
+
+    FTransformStore* GetTransformStore() const { return TransformStore; }
+    FTransformHandle GetTransformHandle() const { return TransformHandle; }
+
     // ──────────────────────────────
     // Attach/Detach
     // ──────────────────────────────
@@ -90,6 +105,7 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        OnAttachParentChanged();
     }
 
     // Serialize
@@ -155,6 +171,26 @@ protected:
     FTransform RelativeTransform;
 
     void UpdateRelativeTransform();
+
+    // RelativeTransform을 바꾼 뒤 호출: 저장소에 로컬 트랜스폼을 쓰고 자손까지 무효화
+    void OnRelativeTransformChanged();
+    // AttachParent를 바꾼 뒤 호출: 저장소의 부모를 갱신하고 자손까지 무효화
+    void OnAttachParentChanged();
+    // 자신과 모든 자손의 월드 트랜스폼 캐시를 무효화
+    void MarkWorldTransformDirty();
+    // 모든 자식의 부착을 끊는다 (OnUnregister, 소멸자)
+    void DetachAllChildren();
+
+    // 월드에 등록된 동안의 트랜스폼 저장소 엔트리 (없으면 아래 객체 내 캐시 사용)
+    FTransformStore* TransformStore = nullptr;
+    FTransformHandle TransformHandle;
+
+    // 월드 트랜스폼 캐시 (저장소에 등록되지 않은 동안)
+    // 불변식: 더티 노드의 자손은 모두 더티 (자식 계산 시 부모를 먼저 갱신하므로) → 이미 더티면 하위 전파를 생략한다
+    mutable FTransform CachedWorldTransform;
+    mutable FMatrix CachedWorldMatrix;
+    mutable bool bWorldTransformDirty = true;
+    mutable bool bWorldMatrixDirty = true;
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
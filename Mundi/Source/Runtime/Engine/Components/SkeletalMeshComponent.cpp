@@ -4,6 +4,10 @@
 #include "WorldPartitionManager.h"
 #include "Widgets/BoneTransformCalculator.h"
 #include "Renderer.h"
+#include "AnimationManager.h"
+#include "AnimationStats.h"
+#include "FFBXManager.h"
+#include <chrono>
 
 
 IMPLEMENT_CLASS(USkeletalMeshComponent)
@@ -123,8 +127,16 @@ void USkeletalMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandl
 void USkeletalMeshComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
+
+    // 애니메이션 재생 중이면 시간만 진행하고, 포즈 샘플링과 스키닝은 월드 애니메이션 단계(FAnimationManager)에서 일괄 처리한다
+    // (그 단계를 거치지 않은 컴포넌트만 렌더 시점 EnsureSkinningReady에서 직접 스키닝)
+    if (IsPlayingAnimation())
+    {
+        AnimationTime += DeltaTime;
+        bSkinningDirty = true;
+    }
+
     // if문은 애니메이션이 없는 경우 유효
-    // 애니메이션은 실시간으로 변하니까 애니 존재 시 if문 제거
     if (bChangedSkeletalMesh)
     {
         UpdateBoneMatrices();
@@ -330,6 +342,8 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& FilePath)
     {
         SkeletalMesh = nullptr;
     }
+
+    BindAnimationToMesh();
 }
 
 void USkeletalMeshComponent::SetSkeletalMesh(USkeletalMesh* Mesh)
@@ -363,6 +377,81 @@ void USkeletalMeshComponent::SetSkeletalMesh(USkeletalMesh* Mesh)
     {
         SkeletalMesh = nullptr;
     }
+
+    BindAnimationToMesh();
+}
+
+void USkeletalMeshComponent::PlayAnimation(const FAnimSequence* InSequence, bool bInLoop)
+{
+    bLoopAnimation = bInLoop;
+    AnimationTime = 0.0f;
+    AnimSampler.Bind(InSequence, TArray<FBoneInfo>());
+    BindAnimationToMesh();
+}
+
+bool USkeletalMeshComponent::PlayAnimationFromFile(const FString& PathFileName, const FString& SequenceName, bool bInLoop)
+{
+    const TArray<FAnimSequence*>* Sequences = FFBXManager::LoadFBXAnimSequences(PathFileName);
+    if (!Sequences || Sequences->IsEmpty())
+    {
+        UE_LOG("[USkeletalMeshComponent/PlayAnimationFromFile] No animation sequence in %s", PathFileName.c_str());
+        return false;
+    }
+
+    const FAnimSequence* Sequence = nullptr;
+    for (const FAnimSequence* Candidate : *Sequences)
+    {
+        if (Candidate && (SequenceName.empty() || Candidate->Name == SequenceName))
+        {
+            Sequence = Candidate;
+            break;
+        }
+    }
+
+    if (!Sequence)
+    {
+        UE_LOG("[USkeletalMeshComponent/PlayAnimationFromFile] Sequence '%s' not found in %s", SequenceName.c_str(), PathFileName.c_str());
+        return false;
+    }
+
+    PlayAnimation(Sequence, bInLoop);
+    return true;
+}
+
+void USkeletalMeshComponent::StopAnimation()
+{
+    AnimSampler.Bind(nullptr, TArray<FBoneInfo>());
+    AnimationLocalPose.Empty();
+
+    // 편집 포즈/바인드 포즈로 되돌리기 위해 한 번 더 스키닝
+    bSkinningDirty = true;
+}
+
+void USkeletalMeshComponent::BindAnimationToMesh()
+{
+    const FAnimSequence* Sequence = AnimSampler.GetSequence();
+    FSkeletalMesh* MeshAsset = SkeletalMesh ? SkeletalMesh->GetSkeletalMeshAsset() : nullptr;
+    if (!Sequence || !MeshAsset)
+    {
+        AnimationLocalPose.Empty();
+        return;
+    }
+
+    AnimSampler.Bind(Sequence, MeshAsset->Bones);
+    if (AnimSampler.GetBoundTrackCount() == 0)
+    {
+        UE_LOG("USkeletalMeshComponent: animation '%s' has no track matching the skeleton", Sequence->Name.c_str());
+    }
+
+    // 트랙이 없는 본은 Evaluate가 건드리지 않으므로 바인드 포즈로 채워 둔다
+    const TArray<FBoneInfo>& BoneInfos = MeshAsset->Bones;
+    AnimationLocalPose.SetNum(BoneInfos.Num());
+    for (int32 i = 0; i < BoneInfos.Num(); ++i)
+    {
+        const FBone BindBone = FBone::FromBoneInfo(i, BoneInfos);
+        AnimationLocalPose[i] = FTransform(BindBone.LocalPosition, BindBone.LocalRotation, BindBone.LocalScale);
+    }
+    bSkinningDirty = true;
 }
 
 void USkeletalMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface* InNewMaterial)
@@ -467,17 +556,72 @@ UMaterialInstanceDynamic* USkeletalMeshComponent::CreateAndSetMaterialInstanceDy
     return nullptr;
 }
 
+void USkeletalMeshComponent::OnRegister(UWorld* InWorld)
+{
+    Super::OnRegister(InWorld);
+    InWorld->GetAnimationManager()->RegisterComponent(this);
+}
+
+void USkeletalMeshComponent::OnUnregister()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetAnimationManager()->DeRegisterComponent(this);
+    }
+    Super::OnUnregister();
+}
+
 void USkeletalMeshComponent::EnsureSkinningReady(D3D11RHI* InDevice)
 {
-    // 스키닝이 일어나지 않음.    
-    if (bSkinningDirty)
+    // 월드 애니메이션 단계를 거치지 않은 경우 (에디터 본 편집, 직전 프레임에 보이지 않아 갱신을 멈췄던 경우 등) 여기서 직접 스키닝
+    // 업데이트 빈도 제한으로 이번 프레임을 건너뛴 컴포넌트는 이전 결과를 그대로 그린다
+    if (bSkinningDirty && !bSkinningThrottled)
     {
-        UpdateBoneMatrices();
-        UpdateSkinningMatrices();
+        using Clock = std::chrono::high_resolution_clock;
+        const auto PoseStart = Clock::now();
+        EvaluateBoneTransforms();
+        const auto SkinningStart = Clock::now();
         PerformCPUSkinning(AnimatedVertices);
-        UpdateVertexBuffer(InDevice);
+        const auto SkinningEnd = Clock::now();
+
+        FAnimationStatManager& Stats = FAnimationStatManager::GetInstance();
+        Stats.RecordPose(1, ComponentSpaceTransforms.Num(), std::chrono::duration<double, std::milli>(SkinningStart - PoseStart).count());
+        Stats.RecordSkinning(AnimatedVertices.Num(), 0, std::chrono::duration<double, std::milli>(SkinningEnd - SkinningStart).count());
+
         bSkinningDirty = false;
+        bVertexBufferDirty = true;
     }
+
+    if (bVertexBufferDirty)
+    {
+        UpdateVertexBuffer(InDevice);
+        bVertexBufferDirty = false;
+    }
+}
+
+int32 USkeletalMeshComponent::GetSkinningVertexCount() const
+{
+    FSkeletalMesh* MeshAsset = SkeletalMesh ? SkeletalMesh->GetSkeletalMeshAsset() : nullptr;
+    return MeshAsset ? MeshAsset->SkinnedVertices.Num() : 0;
+}
+
+void USkeletalMeshComponent::MarkRendered(uint64 Frame, float ScreenSize)
+{
+    if (LastRenderedFrame != Frame)
+    {
+        LastRenderedFrame = Frame;
+        LastRenderedScreenSize = ScreenSize;
+    }
+    else
+    {
+        LastRenderedScreenSize = std::max(LastRenderedScreenSize, ScreenSize);
+    }
+}
+
+void USkeletalMeshComponent::EvaluateBoneTransforms()
+{
+    UpdateBoneMatrices();
+    UpdateSkinningMatrices();
 }
 
 void USkeletalMeshComponent::UpdateVertexBuffer(D3D11RHI* InDevice)
@@ -591,8 +735,22 @@ void USkeletalMeshComponent::UpdateBoneMatrices()
 
     ComponentSpaceTransforms.SetNum(BoneCount);
 
+    // 애니메이션 재생 중이면 샘플링한 로컬 포즈 사용 (편집 포즈보다 우선)
+    if (IsPlayingAnimation() && AnimationLocalPose.Num() == BoneCount)
+    {
+        AnimSampler.Evaluate(AnimationTime, bLoopAnimation, AnimationLocalPose.data(), BoneCount);
+
+        for (int i = 0; i < BoneCount; i++)
+        {
+            const FMatrix BoneLocal = AnimationLocalPose[i].ToMatrix();
+            const int32 ParentIndex = MeshAsset->Bones[i].ParentIndex;
+
+            // Root bone: Local = Component Space, Child bone: Local * Parent Component Space
+            ComponentSpaceTransforms[i] = ParentIndex == -1 ? BoneLocal : BoneLocal * ComponentSpaceTransforms[ParentIndex];
+        }
+    }
     // EditableBones가 있으면 편집된 본 transform 사용 (Skeletal Mesh Editor)
-    if (!EditableBones.empty() && EditableBones.size() == BoneCount)
+    else if (!EditableBones.empty() && EditableBones.size() == BoneCount)
     {
         // EditableBones의 Local Transform을 Component Space로 변환
         for (int i = 0; i < BoneCount; i++)
@@ -643,19 +801,20 @@ void USkeletalMeshComponent::UpdateSkinningMatrices()
     }
 
     SkinningMatrix.SetNum(BoneCount);
-    SkinningInvTransMatrix.SetNum(BoneCount);
     for (int i = 0; i < BoneCount; i++)
     {
         SkinningMatrix[i] = MeshAsset->Bones[i].InverseBindPoseMatrix * ComponentSpaceTransforms[i];
-        if (SkinningMatrix[i].IsOrtho())
-        {
-            SkinningInvTransMatrix[i] = SkinningMatrix[i];
-        }
-        else
-        {
-            SkinningInvTransMatrix[i] = SkinningMatrix[i].InverseAffine().Transpose();
-        }
     }
+
+    // 듀얼 쿼터니언: 모든 본이 강체면 역전치 행렬 없이 팔레트만 만든다
+    bUseDualQuatPalette = SkinningMode == ESkinningMode::DualQuaternion
+        && FSkinningKernel::BuildDualQuatPalette(SkinningMatrix, SkinningDualQuats);
+    if (bUseDualQuatPalette)
+    {
+        return;
+    }
+
+    FSkinningKernel::BuildNormalMatrices(SkinningMatrix, SkinningInvTransMatrix);
 }
 
 void USkeletalMeshComponent::ClearDynamicMaterials()
@@ -1,6 +1,7 @@
 #pragma once
 #include "SkinnedMeshComponent.h"
 #include "SkeletalMeshTypes.h"
+#include "AnimSequence.h"
 
 class URenderer;
 
@@ -33,14 +34,53 @@ public:
 
     UMaterialInstanceDynamic* CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex);
 
+    void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
+
     void EnsureSkinningReady(D3D11RHI* InDevice);
-    void MarkSkinningDirty() { bSkinningDirty = true; }
+    // 외부 편집(본 변환 등)은 업데이트 빈도 제한을 무시하고 이번 프레임에 바로 반영한다
+    void MarkSkinningDirty() { bSkinningDirty = true; bSkinningThrottled = false; }
+    // 재생이 멈춘 포즈도 새 방식으로 다시 스키닝
+    void SetSkinningMode(ESkinningMode InSkinningMode) override { Super::SetSkinningMode(InSkinningMode); MarkSkinningDirty(); }
     bool IsSkinningDirty() const { return bSkinningDirty; }
 
+    // ===== 월드 애니메이션 단계 (FAnimationManager) =====
+    // 포즈 샘플링 → 컴포넌트 공간 계층 → 스키닝 팔레트. 다른 컴포넌트와 병렬로 호출해도 안전하다
+    void EvaluateBoneTransforms();
+    // 스키닝 출력 버퍼를 준비하고 스키닝할 정점 수를 반환한다 (메인 스레드)
+    int32 PrepareBatchedSkinning() { return PrepareCPUSkinning(AnimatedVertices); }
+    // [Begin, End) 정점 스키닝. 같은 컴포넌트의 서로 다른 구간도 병렬로 호출해도 된다
+    void SkinBatchedRange(int32 Begin, int32 End) { SkinVertexRange(Begin, End, AnimatedVertices); }
+    // CPU 스키닝 완료 표시. 정점 버퍼 업로드는 렌더 시점(EnsureSkinningReady)에 한다
+    void FinishBatchedSkinning() { bSkinningDirty = false; bVertexBufferDirty = true; }
+    int32 GetSkinningBoneCount() const { return ComponentSpaceTransforms.Num(); }
+    int32 GetSkinningVertexCount() const;
+
+    // ===== 업데이트 빈도 최적화 (FAnimationManager) =====
+    // 렌더러가 이 컴포넌트를 그린 애니메이션 프레임과 그때의 화면 크기. 한 프레임에 여러 뷰가 그리면 가장 큰 값을 쓴다
+    void MarkRendered(uint64 Frame, float ScreenSize);
+    bool WasRenderedInFrame(uint64 Frame) const { return LastRenderedFrame == Frame; }
+    float GetLastRenderedScreenSize() const { return LastRenderedScreenSize; }
+    // 같은 빈도의 컴포넌트들이 같은 프레임에 몰리지 않도록 갱신 프레임을 엇갈리게 하는 값
+    uint32 GetUpdateRateOffset() const { return UpdateRateOffset; }
+    void SetUpdateRateOffset(uint32 InOffset) { UpdateRateOffset = InOffset; }
+    // true면 이번 프레임은 이전 스키닝 결과를 그대로 그린다 (EnsureSkinningReady에서 다시 스키닝하지 않음)
+    void SetSkinningThrottled(bool bThrottled) { bSkinningThrottled = bThrottled; }
+
     void UpdateVertexBuffer(D3D11RHI* InDevice);
 
     FAABB GetWorldAABB() const;
 
+    // ===== 애니메이션 재생 =====
+    // 시퀀스는 FFBXManager가 소유하므로 컴포넌트는 참조만 한다. nullptr이면 정지
+    void PlayAnimation(const FAnimSequence* InSequence, bool bInLoop = true);
+    // FBX 파일의 애님 스택을 로드(캐시 사용)해 재생. SequenceName이 비어 있으면 첫 번째 시퀀스. 찾지 못하면 false
+    bool PlayAnimationFromFile(const FString& PathFileName, const FString& SequenceName = "", bool bInLoop = true);
+    void StopAnimation();
+    bool IsPlayingAnimation() const { return AnimSampler.GetSequence() != nullptr; }
+    float GetAnimationTime() const { return AnimationTime; }
+    void SetAnimationTime(float InTime) { AnimationTime = InTime; }
+
     // ===== Editor UI 인터페이스 =====
     int32 GetBoneCount() const { return static_cast<int32>(EditableBones.size()); }
     FBone* GetBone(int32 Index);
@@ -66,6 +106,8 @@ protected:
     void UpdateSkinningMatrices() override;
     void ClearDynamicMaterials();
     void LoadBonesFromAsset();
+    // 현재 메시의 본에 샘플러를 다시 연결하고 포즈 버퍼를 바인드 포즈로 초기화
+    void BindAnimationToMesh();
 
     void RenderBonePyramids(
         TArray<FVector>& OutStartPoints,
@@ -90,7 +132,21 @@ protected:
     // 제거 예정 -> 제거하지 말고 원래대로 스키닝된 정점 저장하고 버퍼 업뎃할 때 사용합시다.
     TArray<FNormalVertex> AnimatedVertices = {};
 
+    // 재생 중인 시퀀스 샘플러와 본 로컬 포즈 버퍼 (본 수만큼 미리 할당, 매 틱 재사용)
+    FAnimSampler AnimSampler;
+    TArray<FTransform> AnimationLocalPose = {};
+    float AnimationTime = 0.0f;
+    bool bLoopAnimation = true;
+
     int32 SelectedBoneIndex = -1;
 
     bool bSkinningDirty = true;
+    // CPU 스키닝 결과(AnimatedVertices)가 아직 정점 버퍼에 올라가지 않음
+    bool bVertexBufferDirty = false;
+
+    // 업데이트 빈도 최적화 상태 (0 = 아직 그려진 적 없음)
+    uint64 LastRenderedFrame = 0;
+    float LastRenderedScreenSize = 0.0f;
+    uint32 UpdateRateOffset = 0;
+    bool bSkinningThrottled = false;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "SkinnedMeshComponent.h"
+#include "SkeletalMesh.h"
+#include "SkinningKernel.h"
 
 
 IMPLEMENT_CLASS(USkinnedMeshComponent)
@@ -7,6 +9,21 @@ IMPLEMENT_CLASS(USkinnedMeshComponent)
 // USkinnedMeshComponent는 Scene에 배치되지 않기 때문에 UI에 노출하지 않음
 BEGIN_PROPERTIES(USkinnedMeshComponent)
     //MARK_AS_COMPONENT("스킨 메시 컴포넌트", "스킨 메시")
+
+    // Skinning Mode Enum
+    {
+        static const char* SkinningModeNames[] = { "Linear", "DualQuaternion" };
+        FProperty EnumProp;
+        EnumProp.Name = "SkinningMode";
+        EnumProp.Type = EPropertyType::Enum;
+        EnumProp.Offset = offsetof(ThisClass_t, SkinningMode);
+        EnumProp.Category = "Skinning";
+        EnumProp.bIsEditAnywhere = true;
+        EnumProp.Tooltip = "스키닝 방식 (Linear: 선형 블렌드, DualQuaternion: 듀얼 쿼터니언 - 강체 리그 전용)을 선택합니다.";
+        EnumProp.EnumNames = SkinningModeNames;
+        EnumProp.EnumCount = 2;
+        Class->AddProperty(EnumProp);
+    }
 END_PROPERTIES(USkinnedMeshComponent)
 
 USkinnedMeshComponent::USkinnedMeshComponent()
@@ -31,6 +48,7 @@ void USkinnedMeshComponent::TickComponent(float DeltaTime)
     if (!SkeletalMesh)
     {
         SkinningMatrix.Empty();
+        bUseDualQuatPalette = false;
         return;
     }    
 }
@@ -65,75 +83,62 @@ void USkinnedMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterfac
 }
 
 void USkinnedMeshComponent::PerformCPUSkinning(TArray<FNormalVertex>& AnimatedVertices)
+{
+    if (PrepareCPUSkinning(AnimatedVertices) == 0)
+    {
+        return;
+    }
+
+    if (bUseDualQuatPalette)
+    {
+        FSkinningKernel::SkinDualQuat(SkeletalMesh->GetSkinningSource(), SkinningDualQuats, AnimatedVertices);
+    }
+    else
+    {
+        FSkinningKernel::Skin(SkeletalMesh->GetSkinningSource(), SkinningMatrix, SkinningInvTransMatrix, AnimatedVertices);
+    }
+}
+
+int32 USkinnedMeshComponent::PrepareCPUSkinning(TArray<FNormalVertex>& AnimatedVertices)
 {
     FSkeletalMesh* MeshAsset = SkeletalMesh ? SkeletalMesh->GetSkeletalMeshAsset() : nullptr;
     if (!MeshAsset)
     {
         //UE_LOG("[USkinnedMeshComponent/PerformCPUSkinning] FSkeletalMesh is null");
-        return;
+        return 0;
     }
 
     if (SkinningMatrix.IsEmpty())
     {
         UE_LOG("[USkinnedMeshComponent/PerformCPUSkinning] SkinningMatrix is zero");
-        return;
+        return 0;
     }
 
     const int32 VertexCount = MeshAsset->SkinnedVertices.Num();
     if (VertexCount == 0)
     {
         UE_LOG("[USkinnedMeshComponent/PerformCPUSkinning] VertexCount is zero");
-        return;
+        return 0;
     }
 
-    // 정점 개수만큼 순회
-    AnimatedVertices.Empty();
-    AnimatedVertices.SetNum(VertexCount);
-    concurrency::parallel_for(0, VertexCount, [&](uint32 i)
+    // 결과 버퍼는 재사용하고, 메시가 바뀌었거나 크기가 다를 때만 정적 성분(UV/색상/탄젠트 W)을 다시 채운다
+    const bool bSourceChanged = AnimatedVerticesSource != MeshAsset;
+    FSkinningKernel::PrepareOutput(MeshAsset->SkinnedVertices, AnimatedVertices, bSourceChanged);
+    AnimatedVerticesSource = MeshAsset;
+
+    return std::min(VertexCount, SkeletalMesh->GetSkinningSource().Num());
+}
+
+void USkinnedMeshComponent::SkinVertexRange(int32 Begin, int32 End, TArray<FNormalVertex>& AnimatedVertices) const
+{
+    const FSkinningSourceStreams& Source = SkeletalMesh->GetSkinningSource();
+    if (bUseDualQuatPalette)
     {
-        const FSkinnedVertex& SourceVertex = MeshAsset->SkinnedVertices[i];
-        FNormalVertex& AnimatedVertex = AnimatedVertices[i];
-        //FNormalVertex& AnimatedVertex = MeshAsset->Vertices[i];
-        AnimatedVertex.pos = {};
-        AnimatedVertex.normal = {};
-        AnimatedVertex.Tangent = {};
-
-        // Tangent의 W는 Bitangent의 방향 요소이므로 원본 보존
-        float TangentW = SourceVertex.BaseVertex.Tangent.W;
-        FVector Tangent3 = {};
-        
-        // 총 4개의 가중치
-        for (int j = 0; j < 4; j++)
-        {
-            int BoneIndex = SourceVertex.BoneIndices[j];
-            float BoneWeight = SourceVertex.BoneWeights[j];
-            // 가중치가 0이거나 유효하지 않은 뼈 인덱스는 스킵
-            if (BoneWeight <= KINDA_SMALL_NUMBER || BoneIndex >= SkinningMatrix.Num() || BoneIndex < 0)
-            {
-                continue;;
-            }
-
-            FVector Pos = SourceVertex.BaseVertex.pos * SkinningMatrix[BoneIndex];            
-            FVector4 Normal4 = TransformDirection(SourceVertex.BaseVertex.normal, SkinningInvTransMatrix[BoneIndex]);
-            // Normal4 = TransformDirection(Normal4, SkinningInvTransMatrix[BoneIndex]);
-            FVector Normal = FVector(Normal4.X, Normal4.Y, Normal4.Z);            
-            FVector4 Tangent = TransformDirection(SourceVertex.BaseVertex.Tangent, SkinningMatrix[BoneIndex]);
-            
-            AnimatedVertex.pos += BoneWeight * Pos;
-            AnimatedVertex.normal += BoneWeight * Normal;
-            Tangent3 += BoneWeight * FVector(Tangent.X, Tangent.Y, Tangent.Z);
-        }
-
-        AnimatedVertex.normal.Normalize();
-        Tangent3.Normalize();
-
-        // 그람 슈미트
-        float Scalar = FVector::Dot(AnimatedVertex.normal, Tangent3);
-        Tangent3 = (Tangent3 - (Scalar * AnimatedVertex.normal)).GetSafeNormal();
-        // 원본 w 복원
-        AnimatedVertex.Tangent = FVector4(Tangent3, TangentW);
-        AnimatedVertex.color = SourceVertex.BaseVertex.color;
-        AnimatedVertex.tex = SourceVertex.BaseVertex.tex;
+        FSkinningKernel::SkinRangeDualQuat(Source, SkinningDualQuats.data(), SkinningDualQuats.Num(), Begin, End, AnimatedVertices.data());
+    }
+    else
+    {
+        const int32 BoneCount = std::min(SkinningMatrix.Num(), SkinningInvTransMatrix.Num());
+        FSkinningKernel::SkinRange(Source, SkinningMatrix.data(), SkinningInvTransMatrix.data(), BoneCount, Begin, End, AnimatedVertices.data());
     }
-    );
 }
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "MeshComponent.h"
+#include "SkinningKernel.h"
 
 /*
  *  TODO
@@ -34,12 +35,23 @@ public:
 
     void SetMaterial(uint32 InElementIndex, UMaterialInterface* InNewMaterial) override;    
 
+    ESkinningMode GetSkinningMode() const { return SkinningMode; }
+    // 파생 클래스는 이미 스키닝된 결과를 새 방식으로 다시 만들도록 재정의한다
+    virtual void SetSkinningMode(ESkinningMode InSkinningMode) { SkinningMode = InSkinningMode; }
+
 protected:    
     virtual void UpdateSkinningMatrices() {};
 
     // 매개변수 받게 변경, 자식 클래스 매개변수 전달받아서 채워주기
+    // AnimatedVertices는 틱마다 재할당하지 않고 재사용한다 (FSkinningKernel)
     void PerformCPUSkinning(TArray<FNormalVertex>& AnimatedVertices);
 
+    // PerformCPUSkinning을 나눈 단계 (여러 인스턴스 일괄 스키닝용)
+    // 출력 버퍼를 준비하고 스키닝할 정점 수를 반환한다. 스키닝할 수 없으면 0
+    int32 PrepareCPUSkinning(TArray<FNormalVertex>& AnimatedVertices);
+    // [Begin, End) 정점만 현재 팔레트로 스키닝한다. 서로 다른 구간은 병렬로 호출해도 된다
+    void SkinVertexRange(int32 Begin, int32 End, TArray<FNormalVertex>& AnimatedVertices) const;
+
 protected:
     USkeletalMesh* SkeletalMesh = nullptr;
     TArray<UMaterialInterface*> MaterialSlots;
@@ -52,5 +64,14 @@ protected:
     
     TArray<FMatrix> SkinningInvTransMatrix = {};
 
+    // 스키닝 방식. DualQuaternion이어도 강체가 아닌 본이 있으면 그 갱신은 LBS로 처리한다.
+    ESkinningMode SkinningMode = ESkinningMode::Linear;
+    // 본당 float 8개 듀얼 쿼터니언 팔레트 (bUseDualQuatPalette일 때만 유효)
+    TArray<FDualQuatBone> SkinningDualQuats = {};
+    bool bUseDualQuatPalette = false;
+
+    // AnimatedVertices의 정적 성분을 채운 원본 에셋 (바뀌면 다시 채움)
+    const FSkeletalMesh* AnimatedVerticesSource = nullptr;
+
     bool bChangedSkeletalMesh = false;
 };
\ No newline at end of file
@@ -194,6 +194,22 @@ void USpotLightComponent::OnUnregister()
 	}
 }
 
+void USpotLightComponent::OnActorPooled()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetLightManager()->DeRegisterLight(this);
+	}
+}
+
+void USpotLightComponent::OnActorUnpooled()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetLightManager()->RegisterLight(this);
+	}
+}
+
 void USpotLightComponent::UpdateDirectionGizmo()
 {
 	if (!DirectionGizmo)
@@ -54,6 +54,8 @@ public:
 	void OnTransformUpdated() override;
 	void OnRegister(UWorld* InWorld) override;
 	void OnUnregister() override;
+	void OnActorPooled() override;
+	void OnActorUnpooled() override;
 
 	// Cone Angle Validation
 	void ValidateConeAngles();
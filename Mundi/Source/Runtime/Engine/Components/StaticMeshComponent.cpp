@@ -7,6 +7,7 @@
 #include "ObjManager.h"
 #include "World.h"
 #include "WorldPartitionManager.h"
+#include "ShadowManager.h"
 #include "JsonSerializer.h"
 #include "CameraActor.h"
 #include "CameraComponent.h"
@@ -151,9 +152,10 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 	// 1. 새 메시를 설정하기 전에, 기존에 생성된 모든 MID와 슬롯 정보를 정리합니다.
 	ClearDynamicMaterials();
 
-	// 2. 기존 메시가 있다면 연결을 해제합니다.
+	// 2. 기존 메시가 있다면 연결을 해제합니다. (기존 메시가 드리우던 정적 섀도우 캐시도 무효화)
 	if (StaticMesh != nullptr)
 	{
+		MarkShadowCasterDirty();
 		StaticMesh->EraseUsingComponets(this);
 	}
 
@@ -173,6 +175,7 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 			SetMaterialByName(i, GroupInfos[i].InitialMaterialName);
 		}
 		MarkWorldPartitionDirty();
+		MarkShadowCasterDirty();
 	}
 	else
 	{
@@ -343,6 +346,17 @@ void UStaticMeshComponent::MarkWorldPartitionDirty()
 	}
 }
 
+void UStaticMeshComponent::MarkShadowCasterDirty()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (FShadowManager* ShadowManager = World->GetShadowManager())
+		{
+			ShadowManager->MarkShadowCasterDirty(GetWorldAABB());
+		}
+	}
+}
+
 void UStaticMeshComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
@@ -48,6 +48,8 @@ public:
 protected:
 	void OnTransformUpdated() override;
 	void MarkWorldPartitionDirty();
+	// 현재 월드 AABB와 겹치는 라이트의 정적 섀도우 캐시 무효화
+	void MarkShadowCasterDirty();
 
 protected:
 	UStaticMesh* StaticMesh = nullptr;
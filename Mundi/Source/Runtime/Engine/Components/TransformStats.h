@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 한 프레임 동안의 월드 트랜스폼 조회 통계
+ */
+struct FTransformFrameStats
+{
+	uint32_t CompositionCount = 0;	// 부모 월드 × 로컬 합성 횟수 (캐시 미스)
+	uint32_t CacheHitCount = 0;		// 캐시된 월드 트랜스폼을 그대로 반환한 횟수
+	uint32_t BatchUpdateCount = 0;	// 월드 트랜스폼 저장소 일괄 갱신에서 다시 계산한 엔트리 수
+};
+
+/**
+ * @class FTransformStatManager
+ * @brief USceneComponent 월드 트랜스폼 캐시의 합성/적중 횟수를 수집하는 싱글톤 클래스입니다.
+ * 조회는 메인 스레드에서만 일어나므로 동기화하지 않습니다.
+ */
+class FTransformStatManager
+{
+public:
+	static FTransformStatManager& GetInstance()
+	{
+		static FTransformStatManager Instance;
+		return Instance;
+	}
+
+	/** @brief 매 프레임 렌더링 시작 시 호출하여 누적 값을 표시용으로 넘기고 초기화합니다. */
+	void ResetFrameStats()
+	{
+		LastFrameStats = CurrentStats;
+		CurrentStats = FTransformFrameStats();
+	}
+
+	/** @return 직전 프레임의 월드 트랜스폼 조회 통계 */
+	const FTransformFrameStats& GetStats() const { return LastFrameStats; }
+
+	/** @brief 진행 중인 프레임의 누적 값. 벤치마크가 측정 구간의 차이를 구한 뒤 되돌려 오버레이에 섞이지 않게 할 때 사용합니다. */
+	const FTransformFrameStats& GetCurrentStats() const { return CurrentStats; }
+	void SetCurrentStats(const FTransformFrameStats& InStats) { CurrentStats = InStats; }
+
+	void AddComposition() { ++CurrentStats.CompositionCount; }
+	void AddCacheHit() { ++CurrentStats.CacheHitCount; }
+
+	/** @brief 저장소 일괄 갱신 결과를 기록합니다. 합성 횟수에도 합산합니다. */
+	void RecordBatchUpdate(uint32_t InUpdatedCount, uint32_t InCompositionCount)
+	{
+		CurrentStats.BatchUpdateCount += InUpdatedCount;
+		CurrentStats.CompositionCount += InCompositionCount;
+	}
+
+private:
+	FTransformStatManager() = default;
+	~FTransformStatManager() = default;
+
+	FTransformStatManager(const FTransformStatManager&) = delete;
+	FTransformStatManager& operator=(const FTransformStatManager&) = delete;
+
+private:
+	FTransformFrameStats CurrentStats;
+	FTransformFrameStats LastFrameStats;
+};
@@ -0,0 +1,319 @@
+﻿#include "pch.h"
+#include "TransformStore.h"
+#include "SceneComponent.h"
+#include "TransformStats.h"
+#include "ParallelFor.h"
+
+FTransformHandle FTransformStore::Add(USceneComponent* Owner, const FTransform& LocalTransform, const USceneComponent* Parent)
+{
+	FTransformHandle Handle;
+	if (!FreeHandles.IsEmpty())
+	{
+		Handle.Index = FreeHandles.back();
+		FreeHandles.pop_back();
+	}
+	else
+	{
+		Handle.Index = HandleToDense.Num();
+		HandleToDense.Add(-1);
+	}
+
+	const int32 Dense = Owners.Num();
+	LocalTranslation.Add(LocalTransform.Translation);
+	LocalRotation.Add(LocalTransform.Rotation);
+	LocalScale.Add(LocalTransform.Scale3D);
+	WorldTranslation.Add(LocalTransform.Translation);
+	WorldRotation.Add(LocalTransform.Rotation);
+	WorldScale.Add(LocalTransform.Scale3D);
+	WorldMatrix.Add(LocalTransform.ToMatrix());
+	ParentHandle.Add(-1);
+	ExternalParent.Add(nullptr);
+	ParentDense.Add(-1);
+	Dirty.Add(1);
+	Owners.Add(Owner);
+	DenseToHandle.Add(Handle.Index);
+	HandleToDense[Handle.Index] = Dense;
+
+	SetParent(Handle, Parent);
+	return Handle;
+}
+
+void FTransformStore::Remove(FTransformHandle Handle)
+{
+	if (!Handle.IsValid() || Handle.Index >= HandleToDense.Num() || HandleToDense[Handle.Index] < 0)
+	{
+		return;
+	}
+
+	const int32 Dense = HandleToDense[Handle.Index];
+	const int32 Last = Owners.Num() - 1;
+	if (ExternalParent[Dense])
+	{
+		--ExternalParentCount;
+	}
+
+	// 마지막 엔트리를 빈자리로 옮기고 배열을 줄인다 (순서는 다음 갱신 때 다시 정렬)
+	if (Dense != Last)
+	{
+		HandleToDense[DenseToHandle[Last]] = Dense;
+	}
+	ForEachDenseArray([Dense, Last](auto& Array)
+	{
+		Array[Dense] = Array[Last];
+		Array.pop_back();
+	});
+
+	HandleToDense[Handle.Index] = -1;
+	FreeHandles.Add(Handle.Index);
+	bOrderDirty = true;
+}
+
+void FTransformStore::SetLocalTransform(FTransformHandle Handle, const FTransform& LocalTransform)
+{
+	const int32 Dense = HandleToDense[Handle.Index];
+	LocalTranslation[Dense] = LocalTransform.Translation;
+	LocalRotation[Dense] = LocalTransform.Rotation;
+	LocalScale[Dense] = LocalTransform.Scale3D;
+}
+
+void FTransformStore::SetParent(FTransformHandle Handle, const USceneComponent* Parent)
+{
+	const int32 Dense = HandleToDense[Handle.Index];
+	if (ExternalParent[Dense])
+	{
+		--ExternalParentCount;
+	}
+	ParentHandle[Dense] = -1;
+	ExternalParent[Dense] = nullptr;
+
+	if (Parent)
+	{
+		if (Parent->GetTransformStore() == this && Parent->GetTransformHandle().IsValid())
+		{
+			ParentHandle[Dense] = Parent->GetTransformHandle().Index;
+		}
+		else
+		{
+			ExternalParent[Dense] = Parent;
+			++ExternalParentCount;
+		}
+	}
+	bOrderDirty = true;
+}
+
+FTransform FTransformStore::GetWorldTransform(FTransformHandle Handle)
+{
+	const int32 Dense = HandleToDense[Handle.Index];
+	if (Dirty[Dense])
+	{
+		Resolve(Dense);
+	}
+	else
+	{
+		FTransformStatManager::GetInstance().AddCacheHit();
+	}
+	return FTransform(WorldTranslation[Dense], WorldRotation[Dense], WorldScale[Dense]);
+}
+
+const FMatrix& FTransformStore::GetWorldMatrix(FTransformHandle Handle)
+{
+	const int32 Dense = HandleToDense[Handle.Index];
+	if (Dirty[Dense])
+	{
+		Resolve(Dense);
+	}
+	else
+	{
+		FTransformStatManager::GetInstance().AddCacheHit();
+	}
+	return WorldMatrix[Dense];
+}
+
+void FTransformStore::UpdateWorldTransforms()
+{
+	if (Owners.IsEmpty())
+	{
+		return;
+	}
+
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	// Dirty: 0 = 최신, 1 = 더티, 2 = 이번 패스에서 갱신됨 (자식이 부모 갱신 여부를 알 수 있도록 패스가 끝날 때까지 유지)
+	auto UpdateRange = [this](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const int32 Parent = ParentDense[i];
+			if (Dirty[i] || (Parent >= 0 && Dirty[Parent]))
+			{
+				ComposeEntry(i, Parent);
+				Dirty[i] = 2;
+			}
+		}
+	};
+
+	// 같은 깊이의 엔트리는 서로 독립. 저장소 밖 부모는 컴포넌트 API(지연 캐시)를 거치므로 그때는 직렬로 처리
+	const int32 LevelCount = LevelOffsets.Num() - 1;
+	for (int32 Level = 0; Level < LevelCount; ++Level)
+	{
+		const int32 Begin = LevelOffsets[Level];
+		const int32 End = LevelOffsets[Level + 1];
+		if (ExternalParentCount == 0 && End - Begin >= ParallelLevelThreshold)
+		{
+			ParallelFor(End - Begin, ParallelBatchSize, [&UpdateRange, Begin](int32 RangeBegin, int32 RangeEnd)
+			{
+				UpdateRange(Begin + RangeBegin, Begin + RangeEnd);
+			});
+		}
+		else
+		{
+			UpdateRange(Begin, End);
+		}
+	}
+
+	uint32 UpdatedCount = 0;
+	uint32 CompositionCount = 0;
+	const int32 Count = Owners.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (Dirty[i])
+		{
+			++UpdatedCount;
+			if (ParentDense[i] >= 0 || ExternalParent[i])
+			{
+				++CompositionCount;
+			}
+			Dirty[i] = 0;
+		}
+	}
+	FTransformStatManager::GetInstance().RecordBatchUpdate(UpdatedCount, CompositionCount);
+}
+
+void FTransformStore::RebuildOrder()
+{
+	const int32 Count = Owners.Num();
+
+	// 1. 깊이 계산 (부모 체인을 따라가며 메모)
+	TArray<int32> Depth;
+	Depth.assign(Count, -1);
+	TArray<int32> Chain;
+	int32 MaxDepth = 0;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		int32 Current = i;
+		while (Current >= 0 && Depth[Current] < 0)
+		{
+			Chain.Add(Current);
+			Current = GetParentDense(Current);
+		}
+
+		int32 NextDepth = Current >= 0 ? Depth[Current] + 1 : 0;
+		for (int32 c = Chain.Num() - 1; c >= 0; --c)
+		{
+			Depth[Chain[c]] = NextDepth++;
+		}
+		MaxDepth = std::max(MaxDepth, NextDepth - 1);
+		Chain.Empty();
+	}
+
+	// 2. 깊이 기준 counting sort (같은 깊이 안에서는 기존 순서 유지)
+	LevelOffsets.assign(MaxDepth + 2, 0);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		++LevelOffsets[Depth[i] + 1];
+	}
+	for (int32 d = 0; d <= MaxDepth; ++d)
+	{
+		LevelOffsets[d + 1] += LevelOffsets[d];
+	}
+
+	TArray<int32> NewToOld;
+	NewToOld.SetNum(Count);
+	{
+		TArray<int32> Cursor(LevelOffsets.begin(), LevelOffsets.end() - 1);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			NewToOld[Cursor[Depth[i]]++] = i;
+		}
+	}
+
+	// 3. 모든 밀집 배열을 새 순서로 재배치하고 인덱스 재연결
+	ForEachDenseArray([&NewToOld](auto& Array)
+	{
+		Permute(Array, NewToOld);
+	});
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		HandleToDense[DenseToHandle[i]] = i;
+	}
+	for (int32 i = 0; i < Count; ++i)
+	{
+		ParentDense[i] = GetParentDense(i);
+	}
+
+	bOrderDirty = false;
+}
+
+void FTransformStore::Resolve(int32 Dense)
+{
+	const int32 Parent = GetParentDense(Dense);
+	if (Parent >= 0 && Dirty[Parent])
+	{
+		Resolve(Parent);
+	}
+
+	ComposeEntry(Dense, Parent);
+	Dirty[Dense] = 0;
+
+	if (Parent >= 0 || ExternalParent[Dense])
+	{
+		FTransformStatManager::GetInstance().AddComposition();
+	}
+}
+
+void FTransformStore::ComposeEntry(int32 Dense, int32 ParentIndex)
+{
+	const FTransform Local(LocalTranslation[Dense], LocalRotation[Dense], LocalScale[Dense]);
+
+	FTransform World;
+	if (ParentIndex >= 0)
+	{
+		const FTransform ParentWorld(WorldTranslation[ParentIndex], WorldRotation[ParentIndex], WorldScale[ParentIndex]);
+		World = ParentWorld.GetWorldTransform(Local);
+	}
+	else if (const USceneComponent* External = ExternalParent[Dense])
+	{
+		World = External->GetWorldTransform().GetWorldTransform(Local);
+	}
+	else
+	{
+		World = Local;
+	}
+
+	WorldTranslation[Dense] = World.Translation;
+	WorldRotation[Dense] = World.Rotation;
+	WorldScale[Dense] = World.Scale3D;
+	WorldMatrix[Dense] = World.ToMatrix();
+}
+
+int32 FTransformStore::GetParentDense(int32 Dense) const
+{
+	const int32 Parent = ParentHandle[Dense];
+	return Parent >= 0 ? HandleToDense[Parent] : -1;
+}
+
+template<typename T>
+void FTransformStore::Permute(TArray<T>& Array, const TArray<int32>& NewToOld)
+{
+	TArray<T> Sorted;
+	Sorted.reserve(Array.size());
+	for (int32 OldIndex : NewToOld)
+	{
+		Sorted.push_back(Array[OldIndex]);
+	}
+	Array.swap(Sorted);
+}
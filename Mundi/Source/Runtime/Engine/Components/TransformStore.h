@@ -0,0 +1,113 @@
+﻿#pragma once
+
+class USceneComponent;
+
+// FTransformStore 엔트리를 가리키는 핸들. 정렬로 밀집 인덱스가 바뀌어도 유지된다
+struct FTransformHandle
+{
+	int32 Index = -1;
+
+	bool IsValid() const { return Index >= 0; }
+};
+
+/**
+ * 월드 단위 씬 컴포넌트 트랜스폼 저장소 (SoA)
+ *
+ * 등록된 USceneComponent의 로컬 TRS, 월드 TRS/행렬, 부모, 깊이를 컴포넌트 객체가 아닌 연속 배열에 둔다.
+ * - 컴포넌트는 핸들로 로컬 트랜스폼을 쓰고 월드 트랜스폼을 읽는다 (리플렉션 프로퍼티인 Relative*는 컴포넌트에 남는다)
+ * - UpdateWorldTransforms: 깊이 순(부모가 항상 자식보다 앞)으로 정렬된 배열을 한 번 훑어 더티 엔트리를 모두 갱신한다.
+ *   같은 깊이끼리는 서로 독립이므로 큰 레벨은 ParallelFor로 나눈다
+ * - 프레임 중간의 조회는 더티 엔트리만 부모 체인을 따라 지연 계산한다 (핸들 → 밀집 인덱스 매핑만 사용하므로 정렬 불필요)
+ * 더티 전파(자손 무효화)는 USceneComponent::MarkWorldTransformDirty가 부착 트리를 따라 수행한다.
+ * 메인 스레드 전용 (UpdateWorldTransforms 내부 병렬 처리 제외).
+ */
+class FTransformStore
+{
+public:
+	FTransformStore() = default;
+	~FTransformStore() = default;
+
+	// 엔트리를 추가한다. 새 엔트리는 더티 상태로 시작한다
+	FTransformHandle Add(USceneComponent* Owner, const FTransform& LocalTransform, const USceneComponent* Parent);
+	void Remove(FTransformHandle Handle);
+
+	// 로컬 트랜스폼만 기록한다 (더티 표시는 호출자가 자손까지 전파)
+	void SetLocalTransform(FTransformHandle Handle, const FTransform& LocalTransform);
+	// 부모 변경. 같은 저장소에 등록된 부모는 핸들로, 그 외(미등록/다른 월드)는 컴포넌트 API로 조회한다
+	void SetParent(FTransformHandle Handle, const USceneComponent* Parent);
+
+	bool IsDirty(FTransformHandle Handle) const { return Dirty[HandleToDense[Handle.Index]] != 0; }
+	void MarkDirty(FTransformHandle Handle) { Dirty[HandleToDense[Handle.Index]] = 1; }
+
+	FTransform GetWorldTransform(FTransformHandle Handle);
+	const FMatrix& GetWorldMatrix(FTransformHandle Handle);
+
+	// 더티 엔트리 전체를 부모 → 자식 순서로 갱신 (World Tick에서 프레임당 1회)
+	void UpdateWorldTransforms();
+
+	int32 Num() const { return Owners.Num(); }
+
+private:
+	// 깊이 기준 counting sort로 밀집 배열을 재배치하고 ParentDense/LevelOffsets를 다시 만든다
+	void RebuildOrder();
+	// 더티 부모부터 재귀적으로 계산 (지연 조회 경로)
+	void Resolve(int32 Dense);
+	void ComposeEntry(int32 Dense, int32 ParentIndex);
+	int32 GetParentDense(int32 Dense) const;
+
+	template<typename T>
+	static void Permute(TArray<T>& Array, const TArray<int32>& NewToOld);
+
+	// 밀집 인덱스로 정렬되는 모든 배열에 같은 연산을 적용 (이동/재배치 누락 방지)
+	template<typename Func>
+	void ForEachDenseArray(Func&& Function)
+	{
+		Function(LocalTranslation);
+		Function(LocalRotation);
+		Function(LocalScale);
+		Function(WorldTranslation);
+		Function(WorldRotation);
+		Function(WorldScale);
+		Function(WorldMatrix);
+		Function(ParentHandle);
+		Function(ExternalParent);
+		Function(ParentDense);
+		Function(Dirty);
+		Function(Owners);
+		Function(DenseToHandle);
+	}
+
+private:
+	// ===== 밀집 배열 (SoA) =====
+	TArray<FVector> LocalTranslation;
+	TArray<FQuat> LocalRotation;
+	TArray<FVector> LocalScale;
+
+	TArray<FVector> WorldTranslation;
+	TArray<FQuat> WorldRotation;
+	TArray<FVector> WorldScale;
+	TArray<FMatrix> WorldMatrix;
+
+	// 같은 저장소 부모의 핸들 (없으면 -1)
+	TArray<int32> ParentHandle;
+	// 저장소 밖 부모 (미등록 컴포넌트 등). 있으면 매 계산마다 컴포넌트 API로 부모 월드 트랜스폼을 읽는다
+	TArray<const USceneComponent*> ExternalParent;
+	// RebuildOrder 이후 유효한 부모 밀집 인덱스
+	TArray<int32> ParentDense;
+	TArray<uint8> Dirty;
+	TArray<USceneComponent*> Owners;
+
+	// ===== 핸들 ↔ 밀집 인덱스 =====
+	TArray<int32> DenseToHandle;
+	TArray<int32> HandleToDense;
+	TArray<int32> FreeHandles;
+
+	// 깊이 d인 엔트리 구간 = [LevelOffsets[d], LevelOffsets[d + 1])
+	TArray<int32> LevelOffsets;
+	int32 ExternalParentCount = 0;
+	bool bOrderDirty = false;
+
+	// 이 크기 이상인 깊이 레벨만 병렬로 갱신
+	static constexpr int32 ParallelLevelThreshold = 4096;
+	static constexpr int32 ParallelBatchSize = 1024;
+};
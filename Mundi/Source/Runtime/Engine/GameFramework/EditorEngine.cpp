@@ -313,7 +313,10 @@ void UEditorEngine::MainLoop()
             if (GWorld && bPIEActive)
             {
                 WorldContexts.pop_back();
+                CMemoryManager::EndArena();
                 ObjectFactory::DeleteObject(GWorld);
+                // PIE 월드와 함께 생성된 오브젝트가 모두 해제되었으므로 아레나 페이지를 일괄 반환
+                CMemoryManager::ReleaseArena();
             }
 
             GWorld = WorldContexts[0].World;
@@ -476,6 +479,9 @@ void UEditorEngine::BuildScene()
 void UEditorEngine::StartPIE()
 {
     UWorld* EditorWorld = WorldContexts[0].World;
+
+    // MEMORY ARENA가 켜져 있으면 PIE 종료까지 UObject 할당을 아레나로 보낸다
+    CMemoryManager::BeginArena();
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
 
     GWorld = PIEWorld;
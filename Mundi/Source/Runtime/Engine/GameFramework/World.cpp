@@ -27,6 +27,8 @@
 #include "LightManager.h"
 #include "ShadowManager.h"
 #include "CollisionManager.h"
+#include "AnimationManager.h"
+#include "TransformStore.h"
 #include"Pawn.h"
 #include"PlayerController.h"
 #include "DeltaTimeManager.h"
@@ -44,12 +46,16 @@ UWorld::UWorld(EWorldType InWorldType)
 	ShadowManager = std::make_unique<FShadowManager>();
 	CollisionManager = std::make_unique<UCollisionManager>();
 	CollisionManager->SetWorld(this);
+	AnimationManager = std::make_unique<FAnimationManager>();
+	TransformStore = std::make_unique<FTransformStore>();
 
 	DeltaTimeManager = std::make_unique<UDeltaTimeManager>();
 }
 
 UWorld::~UWorld()
 {
+	FlushActorPool();
+
 	if (Level)
 	{
 		for (AActor* Actor : Level->GetActors())
@@ -162,8 +168,8 @@ void UWorld::Tick(float DeltaSeconds)
 		for (size_t i = 0; i < Actors.size(); ++i)
 		{
 			AActor* Actor = Actors[i];
-			// PendingKill 상태인 Actor는 Tick하지 않음
-			if (Actor && !Actor->IsPendingKill() && (Actor->CanTickInEditor() || bPie))
+			// PendingKill 상태이거나 풀에 반납된 Actor는 Tick하지 않음
+			if (Actor && !Actor->IsPendingKill() && !Actor->IsPooled() && (Actor->CanTickInEditor() || bPie))
 			{
 				Actor->Tick(ScaledDeltaTime);
 			}
@@ -182,9 +188,25 @@ void UWorld::Tick(float DeltaSeconds)
 		}
 	}
 
+	// 틱 중에 반납된 액터를 레벨 목록에서 제거 (틱 순회 중 목록이 당겨지지 않도록 여기서 처리)
+	RemovePooledActorsFromLevel();
+
 	// ⭐ 프레임 끝에 지연 삭제된 Actor들 처리: UpdateCollisions 이전에 호출되야 함!(Unregister를 이 함수 내에서 하므로)
 	ProcessPendingActorDestruction();
 
+	// 이번 프레임 액터 틱에서 바뀐 월드 트랜스폼을 부모 → 자식 순서로 일괄 갱신 (이후 충돌/렌더링 조회는 캐시 적중)
+	if (TransformStore)
+	{
+		TransformStore->UpdateWorldTransforms();
+	}
+
+	// 애니메이션 갱신: 액터 틱에서 더티가 된 스켈레탈 메시의 포즈 평가와 CPU 스키닝을 일괄 병렬 처리
+	// 삭제된 컴포넌트가 등록 해제된 뒤에 실행해야 함
+	if (AnimationManager)
+	{
+		AnimationManager->Update();
+	}
+
 	// 충돌 감지 업데이트
 	if (CollisionManager)
 	{
@@ -265,6 +287,16 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 재진입 가드
 	if (Actor->IsPendingKill()) return false;
 
+	// 풀에 반납된 액터는 레벨로 되돌린 뒤 일반 파괴 경로를 탄다
+	if (Actor->IsPooled())
+	{
+		if (TArray<AActor*>* Pool = ActorPool.Find(Actor->GetClass()))
+		{
+			Pool->Remove(Actor);
+		}
+		UnpoolActor(Actor);
+	}
+
 	// 지연 삭제 큐에 추가
 	MarkActorForDestruction(Actor);
 	return true;
@@ -394,6 +426,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     if (SelectionMgr) SelectionMgr->ClearSelection();
 
     // Cleanup current
+    FlushActorPool();
     if (Level)
     {
         for (AActor* Actor : Level->GetActors())
@@ -478,3 +511,127 @@ AActor* UWorld::SpawnActor(UClass* Class)
 	// 기본 Transform(원점)으로 스폰하는 메인 함수를 호출합니다.
 	return SpawnActor(Class, FTransform());
 }
+
+AActor* UWorld::AcquireActor(UClass* Class, const FTransform& Transform)
+{
+	if (TArray<AActor*>* Pool = ActorPool.Find(Class); Pool && !Pool->IsEmpty())
+	{
+		AActor* Actor = Pool->back();
+		Pool->pop_back();
+
+		UnpoolActor(Actor);
+		Actor->SetActorTransform(Transform);
+		return Actor;
+	}
+
+	AActor* NewActor = SpawnActor(Class, Transform);
+	if (NewActor && bPie)
+	{
+		NewActor->BeginPlay();
+	}
+	return NewActor;
+}
+
+bool UWorld::ReleaseActor(AActor* Actor)
+{
+	if (!Actor || Actor->IsPooled() || Actor->IsPendingKill() || Actor->GetWorld() != this)
+	{
+		return false;
+	}
+
+	if (SelectionMgr)
+	{
+		SelectionMgr->DeselectActor(Actor);
+	}
+
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		if (Component)
+		{
+			Component->OnActorPooled();
+		}
+	}
+	Partition->Unregister(Actor);
+
+	Actor->SetPooled(true);
+	ActorPool[Actor->GetClass()].Add(Actor);
+	PendingPoolActors.Add(Actor);
+	return true;
+}
+
+void UWorld::PrewarmActorPool(UClass* Class, int32 Count)
+{
+	if (!Class || !Class->IsChildOf(AActor::StaticClass()))
+	{
+		return;
+	}
+
+	for (int32 i = GetPooledActorCount(Class); i < Count; ++i)
+	{
+		AActor* NewActor = SpawnActor(Class);
+		if (!NewActor)
+		{
+			return;
+		}
+		if (bPie)
+		{
+			NewActor->BeginPlay();
+		}
+		ReleaseActor(NewActor);
+	}
+}
+
+int32 UWorld::GetPooledActorCount(UClass* Class) const
+{
+	const TArray<AActor*>* Pool = ActorPool.Find(Class);
+	return Pool ? Pool->Num() : 0;
+}
+
+void UWorld::UnpoolActor(AActor* Actor)
+{
+	Actor->SetPooled(false);
+
+	// 같은 프레임에 반납/재사용되면 아직 레벨 목록에 남아 있다
+	if (!PendingPoolActors.Remove(Actor) && Level)
+	{
+		Level->AddActor(Actor);
+	}
+
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		if (Component)
+		{
+			Component->OnActorUnpooled();
+		}
+	}
+	Partition->Register(Actor);
+}
+
+void UWorld::FlushActorPool()
+{
+	for (auto& Pair : ActorPool)
+	{
+		for (AActor* Actor : Pair.second)
+		{
+			UnpoolActor(Actor);
+		}
+	}
+	ActorPool.clear();
+}
+
+void UWorld::RemovePooledActorsFromLevel()
+{
+	if (PendingPoolActors.IsEmpty())
+	{
+		return;
+	}
+
+	if (Level)
+	{
+		for (AActor* Actor : PendingPoolActors)
+		{
+			Level->RemoveActor(Actor);
+		}
+	}
+	PendingPoolActors.Empty();
+}
@@ -33,6 +33,8 @@ struct Frustum;
 struct FCandidateDrawable;
 class FShadowManager;
 class UCollisionManager;
+class FAnimationManager;
+class FTransformStore;
 class AGameModeBase;
 class AGameStateBase;
 class UDeltaTimeManager;
@@ -71,6 +73,19 @@ public:
     AActor* SpawnActor(UClass* Class);
 
     bool DestroyActor(AActor* Actor);
+
+    /**
+     * 액터 풀
+     * 반납된 액터는 레벨 목록(틱/렌더링), 파티션, 충돌, 라이트 등록에서 빠지고 컴포넌트/리소스는 그대로 보관된다.
+     * 재사용 시 생성자/BeginPlay를 다시 거치지 않고 등록만 복구한다. 반납된 액터는 이동하지 말 것.
+     */
+    // 같은 클래스의 반납된 액터가 있으면 재사용, 없으면 새로 스폰 (PIE면 BeginPlay까지 호출)
+    AActor* AcquireActor(UClass* Class, const FTransform& Transform);
+    // 액터를 풀에 반납. 레벨 목록 제거는 틱 순회가 끝난 뒤 처리된다
+    bool ReleaseActor(AActor* Actor);
+    // 반납된 액터가 Count개가 되도록 미리 스폰해 둔다
+    void PrewarmActorPool(UClass* Class, int32 Count);
+    int32 GetPooledActorCount(UClass* Class) const;
     
     // 지연 삭제 시스템
     void MarkActorForDestruction(AActor* Actor);
@@ -90,6 +105,8 @@ public:
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FShadowManager* GetShadowManager() const { return ShadowManager.get(); }
     UCollisionManager* GetCollisionManager() const { return CollisionManager.get(); }
+    FAnimationManager* GetAnimationManager() const { return AnimationManager.get(); }
+    FTransformStore* GetTransformStore() const { return TransformStore.get(); }
 
     ACameraActor* GetCameraActor() { return MainCameraActor; }
     void SetCameraActor(ACameraActor* InCamera)
@@ -206,6 +223,12 @@ private:
     /** === 충돌 매니저 ===*/
     std::unique_ptr<UCollisionManager> CollisionManager;
 
+    /** === 애니메이션 매니저 ===*/
+    std::unique_ptr<FAnimationManager> AnimationManager;
+
+    /** === 씬 컴포넌트 트랜스폼 저장소 ===*/
+    std::unique_ptr<FTransformStore> TransformStore;
+
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
 
@@ -227,6 +250,16 @@ private:
     // 지연 삭제 큐
     TArray<AActor*> PendingDestroyActors;
 
+    // 액터 풀: 클래스별 반납된 액터, 레벨 목록에서 아직 빠지지 않은 반납 액터
+    TMap<UClass*, TArray<AActor*>> ActorPool;
+    TArray<AActor*> PendingPoolActors;
+
+    // 반납 상태를 풀고 레벨/파티션/컴포넌트 등록을 복구 (풀 목록에서의 제거는 호출자 몫)
+    void UnpoolActor(AActor* Actor);
+    // 풀의 모든 액터를 레벨로 되돌린다 (레벨 교체/월드 파괴 전에 호출해 일반 파괴 경로를 타게 함)
+    void FlushActorPool();
+    void RemovePooledActorsFromLevel();
+
 	float CurrentRealDeltaTime = 0.016f; // 기본값 60FPS
 };
 
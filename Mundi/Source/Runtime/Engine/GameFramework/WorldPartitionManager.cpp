@@ -198,14 +198,23 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
 	}
 }
 
-void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
+void UWorldPartitionManager::FrustumQuery(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const
 {
 	if (BVH)
 	{
-		BVH->QueryFrustum(InFrustum);
+		BVH->QueryFrustum(InFrustum, OutComponents);
 	}
 }
 
+bool UWorldPartitionManager::IsTrackedAndClean(UStaticMeshComponent* Smc) const
+{
+	if (!BVH || !Smc)
+		return false;
+
+	// 더티 큐에 남아있는 컴포넌트는 BVH의 바운드가 아직 이전 위치이므로 신뢰할 수 없음
+	return BVH->Contains(Smc) && !ComponentDirtySet.Contains(Smc);
+}
+
 void UWorldPartitionManager::ClearSceneOctree()
 {
 	if (SceneOctree)
@@ -1,9 +1,11 @@
 ﻿#include "pch.h"
 #include <algorithm>
 #include <cfloat>
+#include <chrono>
 #include <cmath>
 #include <functional>
 #include <queue>
+#include <random>
 #include "BVHierarchy.h"
 #include "Actor.h"
 #include "Collision.h"
@@ -11,6 +13,7 @@
 #include "OBB.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
+#include "BVHStats.h"
 
 #include "StaticMeshComponent.h"
 
@@ -65,9 +68,13 @@ void FBVHierarchy::Clear()
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
     StaticMeshComponentBounds = TMap<UStaticMeshComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UStaticMeshComponent*>();
+    SortedBounds = TArray<FAABB>();
+    ComponentIndices = TMap<UStaticMeshComponent*, int32>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
+    BuildSAHCost = 0.0f;
     bPendingRebuild = false;
+    bPendingRefit = false;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UStaticMeshComponent*>& Components)
@@ -84,6 +91,7 @@ void FBVHierarchy::BulkUpdate(const TArray<UStaticMeshComponent*>& Components)
     // 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
     BuildLBVH();
     bPendingRebuild = false;
+    bPendingRefit = false;
 }
 
 void FBVHierarchy::Update(UStaticMeshComponent* InComponent)
@@ -93,8 +101,19 @@ void FBVHierarchy::Update(UStaticMeshComponent* InComponent)
         return;
     }
 
-    StaticMeshComponentBounds.Add(InComponent, InComponent->GetWorldAABB());
-    bPendingRebuild = true;
+    const FAABB NewBound = InComponent->GetWorldAABB();
+    StaticMeshComponentBounds.Add(InComponent, NewBound);
+
+    // 이미 트리에 있는 컴포넌트는 리프 AABB만 갱신하고 Refit
+    if (const int32* Index = ComponentIndices.Find(InComponent))
+    {
+        SortedBounds[*Index] = NewBound;
+        bPendingRefit = true;
+    }
+    else
+    {
+        bPendingRebuild = true;
+    }
 }
 
 void FBVHierarchy::Remove(UStaticMeshComponent* InComponent)
@@ -107,62 +126,55 @@ void FBVHierarchy::Remove(UStaticMeshComponent* InComponent)
     if (StaticMeshComponentBounds.Find(InComponent))
     {
         StaticMeshComponentBounds.Remove(InComponent);
+        ComponentIndices.Remove(InComponent);
         bPendingRebuild = true;
     }
 }
 
-void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const
 {
     if (Nodes.empty()) return;
-    //프러스텀 외부에 바운드 존재
-    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
-    //프러스텀 내부에 바운드 존재 (교차 X)
-    if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
+
+    // pair.second: 부모 노드가 프러스텀 완전 내부인지 여부 (완전 내부면 하위 평면 테스트 생략)
+    TArray<std::pair<int32, bool>> IdxStack;
+    IdxStack.push_back({ 0, false });
+
+    while (!IdxStack.empty())
     {
-        for (UStaticMeshComponent* Component : StaticMeshComponentArray)
+        const std::pair<int32, bool> Entry = IdxStack.back();
+        IdxStack.pop_back();
+
+        const FLBVHNode& Node = Nodes[Entry.first];
+        bool bFullyInside = Entry.second;
+        if (!bFullyInside)
         {
-            if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+            //프러스텀 외부에 바운드 존재
+            if (!IsAABBVisible(InFrustum, Node.Bounds))
                 continue;
-            if (AActor* Owner = Component->GetOwner())
-            {
-                Owner->SetCulled(false);
-            }
+            //프러스텀 내부에 바운드 존재 (교차 X)
+            bFullyInside = !IsAABBIntersects(InFrustum, Node.Bounds);
         }
-        return;
-    }
-    //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
 
-    while (!IdxStack.empty())
-    {
-        int32 Idx = IdxStack.back();
-        IdxStack.pop_back();
-        const FLBVHNode& node = Nodes[Idx];
-        if (node.IsLeaf())
+        if (!Node.IsLeaf())
+        {
+            if (Node.Left >= 0) IdxStack.push_back({ Node.Left, bFullyInside });
+            if (Node.Right >= 0) IdxStack.push_back({ Node.Right, bFullyInside });
+            continue;
+        }
+
+        for (int32 i = 0; i < Node.Count; ++i)
         {
-            for (int32 i = 0; i < node.Count; ++i)
+            UStaticMeshComponent* Component = StaticMeshComponentArray[Node.First + i];
+            if (!Component)
+                continue;
+            const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+            if (!Cached)
+                continue; // Remove 이후 리빌드 전인 컴포넌트
+            if (bFullyInside || IsAABBVisible(InFrustum, *Cached))
             {
-                UStaticMeshComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                    continue;
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
-                {
-                    if (AActor* Owner = Component->GetOwner())
-                    {
-                        Owner->SetCulled(false);
-                    }
-                }
+                OutComponents.Add(Component);
             }
-            continue;
         }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
     }
 }
 
@@ -262,9 +274,14 @@ namespace {
 
 void FBVHierarchy::BuildLBVH()
 {
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    SortedBounds = TArray<FAABB>();
+    ComponentIndices = TMap<UStaticMeshComponent*, int32>();
+    BuildSAHCost = 0.0f;
 
     if (N == 0)
     {
@@ -337,14 +354,170 @@ void FBVHierarchy::BuildLBVH()
             return LHS.second < RHS.second;
         });
 
+    SortedBounds.resize(N);
+    ComponentIndices.reserve(N);
     for (int i = 0; i < N; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        UStaticMeshComponent* Component = ComponentCodePairs[i].first;
+        StaticMeshComponentArray[i] = Component;
+        SortedBounds[i] = StaticMeshComponentBounds[Component];
+        ComponentIndices.Add(Component, i);
     }
 
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
     BuildRange(0, N);
+
+    BuildSAHCost = ComputeSAHCost();
+
+    const std::chrono::duration<double, std::milli> Elapsed = std::chrono::high_resolution_clock::now() - StartTime;
+    FBVHStatManager::GetInstance().RecordRebuild(EBVHStatTarget::Partition, Elapsed.count());
+}
+
+void FBVHierarchy::RefitLBVH()
+{
+    if (Nodes.empty()) return;
+
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+
+    for (int32 i = Nodes.Num() - 1; i >= 0; --i)
+    {
+        FLBVHNode& Node = Nodes[i];
+        if (Node.IsLeaf())
+        {
+            FAABB Accumulated = SortedBounds[Node.First];
+            for (int32 k = 1; k < Node.Count; ++k)
+            {
+                Accumulated = FAABB::Union(Accumulated, SortedBounds[Node.First + k]);
+            }
+            Node.Bounds = Accumulated;
+        }
+        else if (Node.Left >= 0 && Node.Right >= 0)
+        {
+            Node.Bounds = FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds);
+        }
+    }
+    Bounds = Nodes[0].Bounds;
+
+    const float CostRatio = (BuildSAHCost > 0.0f) ? ComputeSAHCost() / BuildSAHCost : 1.0f;
+
+    const std::chrono::duration<double, std::milli> Elapsed = std::chrono::high_resolution_clock::now() - StartTime;
+    FBVHStatManager::GetInstance().RecordRefit(EBVHStatTarget::Partition, Elapsed.count(), CostRatio);
+
+    // 이동으로 노드 간 겹침이 커져 쿼리 품질이 떨어지면 재구축
+    if (CostRatio > RebuildCostThreshold)
+    {
+        BuildLBVH();
+    }
+}
+
+void FBVHierarchy::BenchmarkRefit(int32 ShapeCount, int32 Frames, double& OutRefitMS, double& OutRebuildMS, int32& OutThresholdRebuilds)
+{
+    OutRefitMS = 0.0;
+    OutRebuildMS = 0.0;
+    OutThresholdRebuilds = 0;
+    if (ShapeCount <= 0 || Frames <= 0)
+    {
+        return;
+    }
+
+    // 벤치마크 트리의 Refit/재구축 기록이 STAT BVH의 씬 통계에 섞이지 않도록 끝나면 되돌린다
+    FBVHStatManager& BVHStats = FBVHStatManager::GetInstance();
+    const FBVHTreeStats SavedStats = BVHStats.GetCurrentStats(EBVHStatTarget::Partition);
+
+    // 키는 식별용으로만 쓰이므로(바운드가 항상 맵에 있어 역참조하지 않음) 컴포넌트 없이 가짜 포인터 사용
+    auto MakeKey = [](int32 Index) { return reinterpret_cast<UStaticMeshComponent*>(static_cast<uintptr_t>(Index + 1) * 16); };
+
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> PositionDist(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> VelocityDist(-2.0f, 2.0f);
+    TArray<FVector> StartCenters;
+    TArray<FVector> Velocities;
+    StartCenters.resize(ShapeCount);
+    Velocities.resize(ShapeCount);
+    for (int32 i = 0; i < ShapeCount; ++i)
+    {
+        StartCenters[i] = FVector(PositionDist(Rng), PositionDist(Rng), PositionDist(Rng));
+        Velocities[i] = FVector(VelocityDist(Rng), VelocityDist(Rng), VelocityDist(Rng));
+    }
+
+    const FVector HalfExtent(1.0f, 1.0f, 1.0f);
+    auto ShapeBounds = [&](int32 Index, int32 Frame)
+    {
+        const FVector Center = StartCenters[Index] + Velocities[Index] * static_cast<float>(Frame);
+        return FAABB(Center - HalfExtent, Center + HalfExtent);
+    };
+
+    auto InitTree = [&](FBVHierarchy& Tree)
+    {
+        for (int32 i = 0; i < ShapeCount; ++i)
+        {
+            Tree.StaticMeshComponentBounds.Add(MakeKey(i), ShapeBounds(i, 0));
+        }
+        Tree.BuildLBVH();
+    };
+
+    using Clock = std::chrono::high_resolution_clock;
+    const FAABB WorldBounds(FVector(-1000.0f, -1000.0f, -1000.0f), FVector(1000.0f, 1000.0f, 1000.0f));
+
+    // 현재 방식: 이동한 리프만 갱신하고 Refit (SAH 비용이 나빠지면 FlushRebuild가 재구축)
+    {
+        FBVHierarchy Tree(WorldBounds);
+        InitTree(Tree);
+        const auto Start = Clock::now();
+        for (int32 Frame = 1; Frame <= Frames; ++Frame)
+        {
+            for (int32 i = 0; i < ShapeCount; ++i)
+            {
+                UStaticMeshComponent* Key = MakeKey(i);
+                const FAABB NewBound = ShapeBounds(i, Frame);
+                Tree.StaticMeshComponentBounds[Key] = NewBound;
+                Tree.SortedBounds[*Tree.ComponentIndices.Find(Key)] = NewBound;
+            }
+            Tree.bPendingRefit = true;
+
+            // 재구축은 BuildSAHCost를 새로 계산하므로 값이 바뀌면 재구축된 프레임
+            const float PrevBuildCost = Tree.BuildSAHCost;
+            Tree.FlushRebuild();
+            OutThresholdRebuilds += (Tree.BuildSAHCost != PrevBuildCost) ? 1 : 0;
+        }
+        OutRefitMS = std::chrono::duration<double, std::milli>(Clock::now() - Start).count() / Frames;
+    }
+
+    // 기존 방식: 이동이 있으면 매 프레임 Morton 정렬부터 전체 재구축
+    {
+        FBVHierarchy Tree(WorldBounds);
+        InitTree(Tree);
+        const auto Start = Clock::now();
+        for (int32 Frame = 1; Frame <= Frames; ++Frame)
+        {
+            for (int32 i = 0; i < ShapeCount; ++i)
+            {
+                Tree.StaticMeshComponentBounds[MakeKey(i)] = ShapeBounds(i, Frame);
+            }
+            Tree.bPendingRebuild = true;
+            Tree.FlushRebuild();
+        }
+        OutRebuildMS = std::chrono::duration<double, std::milli>(Clock::now() - Start).count() / Frames;
+    }
+
+    BVHStats.SetCurrentStats(EBVHStatTarget::Partition, SavedStats);
+}
+
+float FBVHierarchy::ComputeSAHCost() const
+{
+    if (Nodes.empty()) return 0.0f;
+
+    const float RootArea = Nodes[0].Bounds.GetSurfaceArea();
+    if (RootArea <= 0.0f) return 0.0f;
+
+    float Cost = 0.0f;
+    for (const FLBVHNode& Node : Nodes)
+    {
+        const float Area = Node.Bounds.GetSurfaceArea();
+        Cost += Node.IsLeaf() ? Area * static_cast<float>(Node.Count) : Area;
+    }
+    return Cost / RootArea;
 }
 
 int FBVHierarchy::BuildRange(int s, int e)
@@ -362,14 +535,12 @@ int FBVHierarchy::BuildRange(int s, int e)
         FAABB Accumulated;
         for (int i = s; i < e; ++i)
         {
-            UStaticMeshComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
+            if (!StaticMeshComponentArray[i])
             {
                 continue;
             }
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
+            const FAABB& LocalBound = SortedBounds[i];
             if (!bInitialized)
             {
                 Accumulated = LocalBound;
@@ -489,8 +660,13 @@ void FBVHierarchy::FlushRebuild()
     if (bPendingRebuild)
     {
         BuildLBVH();
-        bPendingRebuild = false;
     }
+    else if (bPendingRefit)
+    {
+        RefitLBVH();
+    }
+    bPendingRebuild = false;
+    bPendingRefit = false;
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -9,6 +9,8 @@ struct FBoundingSphere;
 
 /**
  * @brief Broad phase BVH based on UStaticMeshComponent
+ * 기존 컴포넌트의 이동은 트리 구조를 유지한 채 Refit으로 처리하고,
+ * SAH 비용이 재구축 직후 대비 RebuildCostThreshold배를 넘을 때만 재구축합니다.
  */
 class FBVHierarchy
 {
@@ -32,8 +34,17 @@ public:
     
     void FlushRebuild();
 
+    // Refit 후 SAH 비용이 재구축 직후 대비 이 배율을 넘으면 재구축
+    static constexpr float RebuildCostThreshold = 1.5f;
+
+    // 움직이는 합성 AABB ShapeCount개를 Frames 프레임 동안 갱신하며 Refit 방식과 매 프레임 전체 재구축을 비교 (콘솔 벤치마크용)
+    // 시간은 프레임당 평균(ms), OutThresholdRebuilds는 Refit 중 SAH 기준으로 재구축된 횟수
+    static void BenchmarkRefit(int32 ShapeCount, int32 Frames, double& OutRefitMS, double& OutRebuildMS, int32& OutThresholdRebuilds);
+
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
-    void QueryFrustum(const FFrustum& InFrustum);
+    // 프러스텀과 겹치는 컴포넌트를 수집 (완전 내부 노드는 하위 테스트 생략)
+    void QueryFrustum(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const;
+    bool Contains(UStaticMeshComponent* InComponent) const { return StaticMeshComponentBounds.Contains(InComponent); }
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
@@ -70,6 +81,10 @@ private:
         , ComponentIntersectFunc ComponentIntersects) const;
 
     int BuildRange(int s, int e);
+    // 트리 구조 유지, 리프 -> 루트 방향으로 Bounds 재계산 (노드 배열 역순 = 자식 먼저)
+    void RefitLBVH();
+    // 루트 표면적으로 정규화한 SAH 비용
+    float ComputeSAHCost() const;
 
     int Depth;
     int MaxDepth;
@@ -78,9 +93,15 @@ private:
 
     TMap<UStaticMeshComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UStaticMeshComponent*> StaticMeshComponentArray;
+    // StaticMeshComponentArray와 같은 순서의 AABB (Refit 시 제자리 갱신)
+    TArray<FAABB> SortedBounds;
+    // 컴포넌트 -> StaticMeshComponentArray 인덱스 (마지막 재구축 기준)
+    TMap<UStaticMeshComponent*, int32> ComponentIndices;
+    float BuildSAHCost = 0.0f;
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+    bool bPendingRefit = false;
 };
@@ -1,333 +1,672 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "Archive.h"
+#include "MemoryMappedReader.h"
+#include <cfloat>
+#include <chrono>
+#include <random>
+#include <emmintrin.h>
+
+namespace
+{
+	// 빈 AABB 누적용 (Min = +inf, Max = -inf)
+	struct FBinBounds
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		uint32 Count = 0;
+
+		void Grow(const FAABB& Box)
+		{
+			Min = Min.ComponentMin(Box.Min);
+			Max = Max.ComponentMax(Box.Max);
+		}
+
+		void Grow(const FBinBounds& Other)
+		{
+			Min = Min.ComponentMin(Other.Min);
+			Max = Max.ComponentMax(Other.Max);
+			Count += Other.Count;
+		}
+
+		float SurfaceArea() const
+		{
+			if (Count == 0)
+			{
+				return 0.0f;
+			}
+			const FVector Size = Max - Min;
+			return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+		}
+	};
+
+	// 0에 가까운 방향 성분은 부호를 유지한 작은 값으로 치환해 슬랩 테스트의 0 * inf(NaN)를 피한다.
+	inline float SafeInverse(float Value)
+	{
+		const float Eps = 1e-8f;
+		if (std::abs(Value) < Eps)
+		{
+			Value = (Value < 0.0f) ? -Eps : Eps;
+		}
+		return 1.0f / Value;
+	}
+}
+
+FMeshBVH::FMeshBVH() = default;
+FMeshBVH::~FMeshBVH() = default;
+
+void FMeshBVH::BindOwnedArrays()
+{
+	MappedCache.reset();
+	NodeData = Nodes.data();
+	PacketData = TriPackets.data();
+	NodeCount = Nodes.Num();
+	PacketCount = TriPackets.Num();
+}
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	TriIndices.Empty();
 	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
+	TriPackets.Empty();
+	BindOwnedArrays();
+	RootBounds = FAABB();
+
+	const uint32 TriCount = Indices.Num() / 3;
+	SourceVertexCount = static_cast<uint32>(Vertices.Num());
+	SourceTriangleCount = TriCount;
 	if (TriCount == 0) return;
 
-	TriIndices.Reserve(TriCount);
+	// 1. 삼각형별 AABB / 중심을 미리 계산 (분할 비교 때마다 정점을 다시 읽지 않도록)
+	TArray<FBuildTri> Tris;
+	Tris.SetNum(static_cast<int32>(TriCount));
+	TArray<uint32> TriOrder;
+	TriOrder.SetNum(static_cast<int32>(TriCount));
+
 	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	{
+		const FVector& A = Vertices[Indices[3 * t + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * t + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * t + 2]].pos;
+
+		FVector MinCorner = A;
+		FVector MaxCorner = A;
+		MinCorner = MinCorner.ComponentMin(B).ComponentMin(C);
+		MaxCorner = MaxCorner.ComponentMax(B).ComponentMax(C);
+
+		Tris[t].Bounds = FAABB(MinCorner, MaxCorner);
+		Tris[t].Center = (MinCorner + MaxCorner) * 0.5f;
+		TriOrder[t] = t;
+	}
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	// 2. Binned SAH 이진 트리 구축
+	TArray<FBuildNode> BuildNodes;
+	BuildNodes.Reserve(2 * (TriCount / LeafSize) + 1);
+	BuildRecursive(0, TriCount, 0, Tris, TriOrder, BuildNodes);
+	RootBounds = BuildNodes[0].Bounds;
+
+	// 3. 4-wide 노드로 압축하면서 Triangle Soup 패킷 생성
+	Nodes.Reserve(BuildNodes.Num() / 2 + 1);
+	TriPackets.Reserve(TriCount / 2 + 1);
+	CollapseNode(0, BuildNodes, TriOrder, Vertices, Indices);
+	BindOwnedArrays();
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+// Binned SAH 분할로 이진 트리를 재귀 구축한다.
+// 각 축을 BinCount개 구간으로 나누고 "왼쪽 표면적 * 왼쪽 삼각형 수 + 오른쪽 표면적 * 오른쪽 삼각형 수"가 최소인 경계에서 자른다.
+int32 FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, uint32 Depth, const TArray<FBuildTri>& Tris, TArray<uint32>& TriOrder, TArray<FBuildNode>& OutNodes)
 {
-	if (Nodes.Num() == 0)
+	FBuildNode Node;
+	Node.Start = Start;
+	Node.Count = Count;
+
+	// 노드 AABB와 중심점들의 AABB 계산
+	FBinBounds NodeBounds;
+	FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (uint32 i = Start; i < Start + Count; ++i)
 	{
-		return false;
+		const FBuildTri& Tri = Tris[TriOrder[i]];
+		NodeBounds.Grow(Tri.Bounds);
+		CentroidMin = CentroidMin.ComponentMin(Tri.Center);
+		CentroidMax = CentroidMax.ComponentMax(Tri.Center);
 	}
+	Node.Bounds = FAABB(NodeBounds.Min, NodeBounds.Max);
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	const int32 NodeIndex = OutNodes.Num();
+	OutNodes.Add(Node);
+
+	// 리프 조건: 삼각형 개수가 LeafSize(패킷 폭) 이하
+	if (Count <= LeafSize)
 	{
-		return false;
+		return NodeIndex;
 	}
 
-	struct FHeapItem
-	{
-		int NodeIndex;
-		float EntryDistance;
+	int32 BestAxis = -1;
+	uint32 BestSplit = 0;
+	float BestCost = FLT_MAX;
 
-		bool operator>(const FHeapItem& Other) const
+	if (Depth < MaxSAHDepth)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
-		}
-	};
-
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+			const float AxisMin = CentroidMin[Axis];
+			const float AxisExtent = CentroidMax[Axis] - AxisMin;
+			if (AxisExtent <= 1e-8f)
+			{
+				continue;
+			}
 
-	while (!Heap.empty())
-	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+			// 삼각형을 중심 좌표 기준으로 bin에 분배
+			FBinBounds Bins[BinCount];
+			const float BinScale = static_cast<float>(BinCount) / AxisExtent;
+			for (uint32 i = Start; i < Start + Count; ++i)
+			{
+				const FBuildTri& Tri = Tris[TriOrder[i]];
+				const uint32 BinIndex = std::min(BinCount - 1, static_cast<uint32>((Tri.Center[Axis] - AxisMin) * BinScale));
+				Bins[BinIndex].Grow(Tri.Bounds);
+				++Bins[BinIndex].Count;
+			}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
-		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			// 왼쪽 누적 / 오른쪽 누적 스윕
+			float LeftArea[BinCount - 1];
+			uint32 LeftCount[BinCount - 1];
+			FBinBounds LeftAccum;
+			for (uint32 b = 0; b < BinCount - 1; ++b)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+				LeftAccum.Grow(Bins[b]);
+				LeftArea[b] = LeftAccum.SurfaceArea();
+				LeftCount[b] = LeftAccum.Count;
+			}
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+			FBinBounds RightAccum;
+			for (uint32 b = BinCount - 1; b > 0; --b)
+			{
+				RightAccum.Grow(Bins[b]);
+				const uint32 Split = b - 1; // [0, Split] | [Split + 1, BinCount)
+				if (LeftCount[Split] == 0 || RightAccum.Count == 0)
+				{
+					continue;
+				}
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+				const float Cost = LeftArea[Split] * LeftCount[Split] + RightAccum.SurfaceArea() * RightAccum.Count;
+				if (Cost < BestCost)
 				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					BestCost = Cost;
+					BestAxis = Axis;
+					BestSplit = Split;
 				}
 			}
 		}
-		else
+	}
+
+	uint32 Mid = Start + Count / 2;
+	if (BestAxis >= 0)
+	{
+		// 선택된 bin 경계로 분할
+		const float AxisMin = CentroidMin[BestAxis];
+		const float BinScale = static_cast<float>(BinCount) / (CentroidMax[BestAxis] - AxisMin);
+		auto SplitIt = std::partition(
+			TriOrder.begin() + Start,
+			TriOrder.begin() + Start + Count,
+			[&](uint32 TriangleID)
+			{
+				const uint32 BinIndex = std::min(BinCount - 1, static_cast<uint32>((Tris[TriangleID].Center[BestAxis] - AxisMin) * BinScale));
+				return BinIndex <= BestSplit;
+			});
+		Mid = static_cast<uint32>(SplitIt - TriOrder.begin());
+	}
+
+	if (BestAxis < 0 || Mid == Start || Mid == Start + Count)
+	{
+		// 중심점이 모두 겹치거나 깊이 제한에 걸린 경우: 가장 긴 축 기준 중앙값 분할
+		const FVector CentroidExtent = CentroidMax - CentroidMin;
+		int32 Axis = 0;
+		if (CentroidExtent.Y > CentroidExtent.X && CentroidExtent.Y >= CentroidExtent.Z)
+			Axis = 1;
+		else if (CentroidExtent.Z > CentroidExtent.X && CentroidExtent.Z >= CentroidExtent.Y)
+			Axis = 2;
+
+		Mid = Start + Count / 2;
+		std::nth_element(
+			TriOrder.begin() + Start,
+			TriOrder.begin() + Mid,
+			TriOrder.begin() + Start + Count,
+			[&](uint32 A, uint32 B)
+			{
+				return Tris[A].Center[Axis] < Tris[B].Center[Axis];
+			});
+	}
+
+	// 내부 노드로 전환 & 자식 생성 (재귀 중 OutNodes가 재할당될 수 있으므로 인덱스로 접근)
+	OutNodes[NodeIndex].Count = 0;
+	const int32 Left = BuildRecursive(Start, Mid - Start, Depth + 1, Tris, TriOrder, OutNodes);
+	const int32 Right = BuildRecursive(Mid, Start + Count - Mid, Depth + 1, Tris, TriOrder, OutNodes);
+	OutNodes[NodeIndex].Left = Left;
+	OutNodes[NodeIndex].Right = Right;
+
+	return NodeIndex;
+}
+
+int32 FMeshBVH::CollapseNode(int32 BuildIndex, const TArray<FBuildNode>& BuildNodes, const TArray<uint32>& TriOrder,
+	const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	// 자식 후보: 표면적이 가장 큰 내부 노드를 펼쳐가며 최대 4개까지 모은다
+	int32 Candidates[4];
+	int32 CandidateCount = 0;
+
+	const FBuildNode& Root = BuildNodes[BuildIndex];
+	if (Root.IsLeaf())
+	{
+		// 메시 전체가 리프 하나인 경우
+		Candidates[CandidateCount++] = BuildIndex;
+	}
+	else
+	{
+		Candidates[CandidateCount++] = Root.Left;
+		Candidates[CandidateCount++] = Root.Right;
+
+		while (CandidateCount < 4)
 		{
-			if (Node.Left >= 0)
+			int32 ExpandSlot = -1;
+			float LargestArea = -1.0f;
+			for (int32 i = 0; i < CandidateCount; ++i)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				const FBuildNode& Candidate = BuildNodes[Candidates[i]];
+				if (Candidate.IsLeaf())
 				{
-					Heap.push({ Node.Left, ChildEntry });
+					continue;
 				}
-			}
-			if (Node.Right >= 0)
-			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				const float Area = Candidate.Bounds.GetSurfaceArea();
+				if (Area > LargestArea)
 				{
-					Heap.push({ Node.Right, ChildEntry });
+					LargestArea = Area;
+					ExpandSlot = i;
 				}
 			}
+
+			if (ExpandSlot < 0)
+			{
+				break;
+			}
+
+			const FBuildNode& Expand = BuildNodes[Candidates[ExpandSlot]];
+			Candidates[ExpandSlot] = Expand.Left;
+			Candidates[CandidateCount++] = Expand.Right;
 		}
 	}
 
-	return false;
+	const int32 NodeIndex = Nodes.Num();
+	FMeshBVHNode4 EmptyNode;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		EmptyNode.MinX[i] = EmptyNode.MinY[i] = EmptyNode.MinZ[i] = FLT_MAX;
+		EmptyNode.MaxX[i] = EmptyNode.MaxY[i] = EmptyNode.MaxZ[i] = -FLT_MAX;
+		EmptyNode.Child[i] = EmptyChild;
+	}
+	Nodes.Add(EmptyNode);
+
+	for (int32 i = 0; i < CandidateCount; ++i)
+	{
+		const FBuildNode& Candidate = BuildNodes[Candidates[i]];
+		const int32 ChildRef = Candidate.IsLeaf()
+			? ~EmitLeafPacket(Candidate, TriOrder, Vertices, Indices)
+			: CollapseNode(Candidates[i], BuildNodes, TriOrder, Vertices, Indices);
+
+		// 재귀 중 Nodes가 재할당될 수 있으므로 매번 다시 참조
+		FMeshBVHNode4& Node = Nodes[NodeIndex];
+		Node.MinX[i] = Candidate.Bounds.Min.X;
+		Node.MinY[i] = Candidate.Bounds.Min.Y;
+		Node.MinZ[i] = Candidate.Bounds.Min.Z;
+		Node.MaxX[i] = Candidate.Bounds.Max.X;
+		Node.MaxY[i] = Candidate.Bounds.Max.Y;
+		Node.MaxZ[i] = Candidate.Bounds.Max.Z;
+		Node.Child[i] = ChildRef;
+	}
+
+	return NodeIndex;
+}
+
+int32 FMeshBVH::EmitLeafPacket(const FBuildNode& Leaf, const TArray<uint32>& TriOrder,
+	const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	FMeshBVHTriPacket Packet = {};
+
+	for (uint32 Lane = 0; Lane < Leaf.Count; ++Lane)
+	{
+		const uint32 TriangleID = TriOrder[Leaf.Start + Lane];
+		const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+
+		Packet.V0X[Lane] = A.X;       Packet.V0Y[Lane] = A.Y;       Packet.V0Z[Lane] = A.Z;
+		Packet.E1X[Lane] = B.X - A.X; Packet.E1Y[Lane] = B.Y - A.Y; Packet.E1Z[Lane] = B.Z - A.Z;
+		Packet.E2X[Lane] = C.X - A.X; Packet.E2Y[Lane] = C.Y - A.Y; Packet.E2Z[Lane] = C.Z - A.Z;
+	}
+
+	return TriPackets.Add(Packet);
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+
+namespace
 {
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
+	// 'MBVH'
+	constexpr uint32 MeshBVHCacheMagic = 0x4856424D;
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+void FMeshBVH::SerializeHeader(FArchive& Ar)
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
+	uint32 Magic = MeshBVHCacheMagic;
+	uint32 Version = CacheVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Ar.IsLoading() && (Magic != MeshBVHCacheMagic || Version != CacheVersion))
+	{
+		throw std::runtime_error("Cache incompatible: MeshBVH magic/version mismatch.");
+	}
 
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	Ar << SourceVertexCount;
+	Ar << SourceTriangleCount;
+	Ar << RootBounds;
+}
 
-	// 중심점(무게중심) 계산
+void FMeshBVH::ValidateChildren() const
+{
+	// 루트 노드가 없거나 자식 참조가 범위를 벗어나면 손상된 캐시
+	if (SourceTriangleCount > 0 && NodeCount == 0)
+	{
+		throw std::runtime_error("Cache corrupt: MeshBVH has no nodes.");
+	}
+	for (int32 n = 0; n < NodeCount; ++n)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const int32 Child = NodeData[n].Child[i];
+			if (Child == EmptyChild)
+				continue;
+			if ((Child >= 0 && Child >= NodeCount) || (Child < 0 && ~Child >= PacketCount))
+			{
+				throw std::runtime_error("Cache corrupt: MeshBVH child index out of range.");
+			}
+		}
+	}
+}
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH)
+{
+	BVH.SerializeHeader(Ar);
 
-	return TriangleCenter;
+	if (Ar.IsSaving())
+	{
+		if (BVH.IsMapped())
+		{
+			// 매핑 로드된 BVH는 소유 배열이 비어 있으므로 매핑 영역에서 복사해 쓴다
+			Serialization::WriteAlignedArray(Ar, TArray<FMeshBVHNode4>(BVH.NodeData, BVH.NodeData + BVH.NodeCount));
+			Serialization::WriteAlignedArray(Ar, TArray<FMeshBVHTriPacket>(BVH.PacketData, BVH.PacketData + BVH.PacketCount));
+		}
+		else
+		{
+			Serialization::WriteAlignedArray(Ar, BVH.Nodes);
+			Serialization::WriteAlignedArray(Ar, BVH.TriPackets);
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		Serialization::ReadAlignedArray(Ar, BVH.Nodes);
+		Serialization::ReadAlignedArray(Ar, BVH.TriPackets);
+		BVH.BindOwnedArrays();
+		BVH.ValidateChildren();
+	}
+	return Ar;
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+void FMeshBVH::LoadMapped(const FString& CachePath)
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
+	Nodes.Empty();
+	TriPackets.Empty();
+	BindOwnedArrays();
+
+	auto Reader = std::make_unique<FMemoryMappedReader>(CachePath);
+	if (!Reader->IsOpen())
+	{
+		throw std::runtime_error("Failed to map bvh bin file.");
+	}
+
+	SerializeHeader(*Reader);
+
+	uint32 MappedNodeCount = 0;
+	uint32 MappedPacketCount = 0;
+	if (!Serialization::ViewAlignedArray(*Reader, NodeData, MappedNodeCount) ||
+		!Serialization::ViewAlignedArray(*Reader, PacketData, MappedPacketCount))
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		throw std::runtime_error("Failed to view mapped bvh arrays.");
 	}
-	return Bounds;
+	NodeCount = static_cast<int32>(MappedNodeCount);
+	PacketCount = static_cast<int32>(MappedPacketCount);
+	MappedCache = std::move(Reader);
+
+	ValidateChildren();
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+// 4-wide 노드를 가까운 순서로 순회하며 가장 가까운 교차를 찾는다.
+// 노드: 자식 AABB 4개 슬랩 테스트 / 리프: 삼각형 4개 Möller–Trumbore를 SSE로 동시에 수행
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
 {
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
+	if (NodeCount == 0)
+	{
+		return false;
+	}
 
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
+	const float Epsilon = KINDA_SMALL_NUMBER;
+
+	// 레이 상수 브로드캐스트
+	const __m128 OriginX = _mm_set1_ps(InLocalRay.Origin.X);
+	const __m128 OriginY = _mm_set1_ps(InLocalRay.Origin.Y);
+	const __m128 OriginZ = _mm_set1_ps(InLocalRay.Origin.Z);
+	const __m128 DirX = _mm_set1_ps(InLocalRay.Direction.X);
+	const __m128 DirY = _mm_set1_ps(InLocalRay.Direction.Y);
+	const __m128 DirZ = _mm_set1_ps(InLocalRay.Direction.Z);
+	const __m128 InvDirX = _mm_set1_ps(SafeInverse(InLocalRay.Direction.X));
+	const __m128 InvDirY = _mm_set1_ps(SafeInverse(InLocalRay.Direction.Y));
+	const __m128 InvDirZ = _mm_set1_ps(SafeInverse(InLocalRay.Direction.Z));
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Eps = _mm_set1_ps(Epsilon);
+	const __m128 NegEps = _mm_set1_ps(-Epsilon);
+	const __m128 OnePlusEps = _mm_set1_ps(1.0f + Epsilon);
+	const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+	struct FTraversalEntry
+	{
+		int32 Ref;
+		float EntryDistance;
+	};
+	FTraversalEntry Stack[MaxTraversalStack];
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, 0.0f };
 
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
+	float ClosestHit = FLT_MAX;
+	bool bHasHit = false;
 
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
+	while (StackSize > 0)
 	{
-		return NodeIndex;
-	}
+		const FTraversalEntry Entry = Stack[--StackSize];
 
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
+		// 이미 더 가까운 교차가 있으면 스킵
+		if (Entry.EntryDistance > ClosestHit)
+		{
+			continue;
+		}
+
+		if (Entry.Ref < 0)
+		{
+			// ─── 리프: 삼각형 4개 동시 교차 ───
+			const FMeshBVHTriPacket& Packet = PacketData[~Entry.Ref];
+			const __m128 E1X = _mm_load_ps(Packet.E1X);
+			const __m128 E1Y = _mm_load_ps(Packet.E1Y);
+			const __m128 E1Z = _mm_load_ps(Packet.E1Z);
+			const __m128 E2X = _mm_load_ps(Packet.E2X);
+			const __m128 E2Y = _mm_load_ps(Packet.E2Y);
+			const __m128 E2Z = _mm_load_ps(Packet.E2Z);
+
+			// P = Dir x Edge2
+			const __m128 PX = _mm_sub_ps(_mm_mul_ps(DirY, E2Z), _mm_mul_ps(DirZ, E2Y));
+			const __m128 PY = _mm_sub_ps(_mm_mul_ps(DirZ, E2X), _mm_mul_ps(DirX, E2Z));
+			const __m128 PZ = _mm_sub_ps(_mm_mul_ps(DirX, E2Y), _mm_mul_ps(DirY, E2X));
+
+			const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+			const __m128 InvDet = _mm_div_ps(One, Det);
+
+			// T = Origin - V0
+			const __m128 TX = _mm_sub_ps(OriginX, _mm_load_ps(Packet.V0X));
+			const __m128 TY = _mm_sub_ps(OriginY, _mm_load_ps(Packet.V0Y));
+			const __m128 TZ = _mm_sub_ps(OriginZ, _mm_load_ps(Packet.V0Z));
+
+			const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(TX, PX), _mm_mul_ps(TY, PY)), _mm_mul_ps(TZ, PZ)), InvDet);
+
+			// Q = T x Edge1
+			const __m128 QX = _mm_sub_ps(_mm_mul_ps(TY, E1Z), _mm_mul_ps(TZ, E1Y));
+			const __m128 QY = _mm_sub_ps(_mm_mul_ps(TZ, E1X), _mm_mul_ps(TX, E1Z));
+			const __m128 QZ = _mm_sub_ps(_mm_mul_ps(TX, E1Y), _mm_mul_ps(TY, E1X));
+
+			const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DirX, QX), _mm_mul_ps(DirY, QY)), _mm_mul_ps(DirZ, QZ)), InvDet);
+			const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDet);
+
+			// IntersectRayTriangleMT와 동일한 허용 오차
+			__m128 HitMask = _mm_cmpge_ps(_mm_and_ps(Det, AbsMask), Eps);
+			HitMask = _mm_and_ps(HitMask, _mm_cmpge_ps(U, NegEps));
+			HitMask = _mm_and_ps(HitMask, _mm_cmple_ps(U, OnePlusEps));
+			HitMask = _mm_and_ps(HitMask, _mm_cmpge_ps(V, NegEps));
+			HitMask = _mm_and_ps(HitMask, _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEps));
+			HitMask = _mm_and_ps(HitMask, _mm_cmpgt_ps(T, Eps));
+			HitMask = _mm_and_ps(HitMask, _mm_cmplt_ps(T, _mm_set1_ps(ClosestHit)));
+
+			const int32 Mask = _mm_movemask_ps(HitMask);
+			if (Mask != 0)
+			{
+				alignas(16) float HitT[4];
+				_mm_store_ps(HitT, T);
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					if ((Mask & (1 << Lane)) && HitT[Lane] < ClosestHit)
+					{
+						ClosestHit = HitT[Lane];
+						bHasHit = true;
+					}
+				}
+			}
+			continue;
+		}
 
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
+		// ─── 내부 노드: 자식 AABB 4개 동시 슬랩 테스트 ───
+		const FMeshBVHNode4& Node = NodeData[Entry.Ref];
 
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
+		const __m128 TX0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinX), OriginX), InvDirX);
+		const __m128 TX1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxX), OriginX), InvDirX);
+		const __m128 TY0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinY), OriginY), InvDirY);
+		const __m128 TY1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxY), OriginY), InvDirY);
+		const __m128 TZ0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinZ), OriginZ), InvDirZ);
+		const __m128 TZ1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxZ), OriginZ), InvDirZ);
+
+		__m128 TEnter = _mm_max_ps(_mm_min_ps(TX0, TX1), _mm_min_ps(TY0, TY1));
+		TEnter = _mm_max_ps(TEnter, _mm_max_ps(_mm_min_ps(TZ0, TZ1), Zero));
+		__m128 TExit = _mm_min_ps(_mm_max_ps(TX0, TX1), _mm_max_ps(TY0, TY1));
+		TExit = _mm_min_ps(TExit, _mm_min_ps(_mm_max_ps(TZ0, TZ1), _mm_set1_ps(ClosestHit)));
 
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
+		const int32 Mask = _mm_movemask_ps(_mm_cmple_ps(TEnter, TExit));
+		if (Mask == 0)
 		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
+			continue;
+		}
 
-			switch (Axis)
+		alignas(16) float EnterT[4];
+		_mm_store_ps(EnterT, TEnter);
+
+		// 맞은 자식을 진입 거리 내림차순으로 정렬해 push (가까운 자식이 먼저 pop 되도록)
+		FTraversalEntry Hits[4];
+		int32 HitCount = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (!(Mask & (1 << i)) || Node.Child[i] == EmptyChild)
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				continue;
 			}
-		});
 
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+			FTraversalEntry NewEntry = { Node.Child[i], EnterT[i] };
+			int32 Insert = HitCount++;
+			while (Insert > 0 && Hits[Insert - 1].EntryDistance < NewEntry.EntryDistance)
+			{
+				Hits[Insert] = Hits[Insert - 1];
+				--Insert;
+			}
+			Hits[Insert] = NewEntry;
+		}
 
-	return NodeIndex;
+		for (int32 i = 0; i < HitCount && StackSize < MaxTraversalStack; ++i)
+		{
+			Stack[StackSize++] = Hits[i];
+		}
+	}
+
+	if (bHasHit)
+	{
+		OutHitDistance = ClosestHit;
+		return true;
+	}
+	return false;
+}
+
+void FMeshBVH::Benchmark(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 RayCount,
+	double& OutBuildMS, double& OutRaysPerSecond, uint32& OutHitCount)
+{
+	OutBuildMS = 0.0;
+	OutRaysPerSecond = 0.0;
+	OutHitCount = 0;
+
+	FMeshBVH BVH;
+	const auto BuildStart = std::chrono::high_resolution_clock::now();
+	BVH.Build(Vertices, Indices);
+	const auto BuildEnd = std::chrono::high_resolution_clock::now();
+	OutBuildMS = std::chrono::duration<double, std::milli>(BuildEnd - BuildStart).count();
+
+	if (BVH.IsEmpty() || RayCount == 0)
+	{
+		return;
+	}
+
+	// 측정 구간 밖에서 레이를 미리 생성 (고정 시드로 반복 측정 간 동일한 입력 보장)
+	const FAABB& Bounds = BVH.GetBounds();
+	const FVector Center = Bounds.GetCenter();
+	const FVector HalfExtent = Bounds.GetHalfExtent();
+	const float Radius = std::max(HalfExtent.Size() * 2.0f, 1.0f);
+
+	std::mt19937 Rng(12345u);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	TArray<FRay> Rays;
+	Rays.Reserve(RayCount);
+	for (uint32 i = 0; i < RayCount; ++i)
+	{
+		FVector OnSphere(Unit(Rng), Unit(Rng), Unit(Rng));
+		if (OnSphere.SizeSquared() < 1e-4f)
+		{
+			OnSphere = FVector(1.0f, 0.0f, 0.0f);
+		}
+		const FVector Origin = Center + OnSphere.GetNormalized() * Radius;
+		const FVector Target = Center + FVector(Unit(Rng) * HalfExtent.X, Unit(Rng) * HalfExtent.Y, Unit(Rng) * HalfExtent.Z);
+		Rays.Add(FRay{ Origin, (Target - Origin).GetNormalized() });
+	}
+
+	const auto RayStart = std::chrono::high_resolution_clock::now();
+	for (const FRay& Ray : Rays)
+	{
+		float HitDistance;
+		if (BVH.IntersectRay(Ray, HitDistance))
+		{
+			++OutHitCount;
+		}
+	}
+	const auto RayEnd = std::chrono::high_resolution_clock::now();
+
+	const double Seconds = std::chrono::duration<double>(RayEnd - RayStart).count();
+	OutRaysPerSecond = (Seconds > 0.0) ? static_cast<double>(RayCount) / Seconds : 0.0;
 }
@@ -1,47 +1,143 @@
 ﻿#pragma once
 #include "AABB.h"
+#include <memory>
 
-struct FMeshBVHNode
-{
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+class FArchive;
+class FMemoryMappedReader;
 
-	bool IsLeaf() const { return Count > 0; }
+/**
+ * 4-wide BVH 노드 (SoA 배치)
+ * 자식 4개의 AABB를 한 번의 SSE 슬랩 테스트로 검사한다.
+ * Child >= 0 : 내부 노드 인덱스 / Child < 0 : 리프 (~Child = 삼각형 패킷 인덱스) / EmptyChild : 빈 슬롯
+ */
+struct alignas(16) FMeshBVHNode4
+{
+	float MinX[4];
+	float MinY[4];
+	float MinZ[4];
+	float MaxX[4];
+	float MaxY[4];
+	float MaxZ[4];
+	int32 Child[4];
 };
 
-struct FStackItem
+/**
+ * 리프 삼각형 최대 4개를 SoA로 묶은 Triangle Soup 패킷
+ * 정점/인덱스 버퍼 간접 참조 없이 Möller–Trumbore를 4개 동시에 수행하기 위해 V0, Edge1, Edge2를 미리 계산해 둔다.
+ * 비어있는 레인은 Edge가 0이라 Determinant가 0이 되어 항상 miss 처리된다.
+ */
+struct alignas(16) FMeshBVHTriPacket
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float V0X[4];
+	float V0Y[4];
+	float V0Z[4];
+	float E1X[4];
+	float E1Y[4];
+	float E1Z[4];
+	float E2X[4];
+	float E2Y[4];
+	float E2Z[4];
 };
+
 class FMeshBVH
 {
 public:
+	static constexpr int32 EmptyChild = INT32_MIN;
+
+	// 디스크 캐시(.bvh.bin) 포맷 버전. 노드/패킷 레이아웃이나 빌드 알고리즘이 바뀌면 올린다.
+	// 2 : 노드/패킷 배열을 16바이트 정렬 블록으로 저장 (매핑 영역을 그대로 사용)
+	static constexpr uint32 CacheVersion = 2;
 
+	FMeshBVH();
+	~FMeshBVH();
+
+	// Binned SAH로 이진 트리를 구축한 뒤 4-wide 노드로 압축하고 Triangle Soup 패킷을 생성한다.
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 로컬 공간 레이와 가장 가까운 교차 거리를 구한다.
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
+
+	bool IsEmpty() const { return NodeCount == 0; }
+	int32 GetNodeCount() const { return NodeCount; }
+	int32 GetPacketCount() const { return PacketCount; }
+	// 노드/패킷이 캐시 파일 매핑 영역을 직접 가리키는지 (복사 없이 로드됨)
+	bool IsMapped() const { return MappedCache != nullptr; }
+	const FAABB& GetBounds() const { return RootBounds; }
+
+	// 빌드에 사용된 소스 메시 크기 (캐시가 현재 메시와 일치하는지 검증용)
+	uint32 GetSourceVertexCount() const { return SourceVertexCount; }
+	uint32 GetSourceTriangleCount() const { return SourceTriangleCount; }
 
+	// 헤더(매직/버전) + 노드/패킷 배열을 통째로 직렬화. 버전이 다르면 로드 시 예외를 던진다.
+	friend FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH);
+
+	// 캐시 파일을 메모리 매핑해 노드/패킷 배열을 복사 없이 사용한다. 매핑은 BVH 수명 동안 유지된다.
+	// 손상되었거나 버전이 다르면 예외를 던진다.
+	void LoadMapped(const FString& CachePath);
+
+	/**
+	 * 빌드 시간과 초당 레이 처리량을 측정한다 (STAT이 아닌 콘솔 벤치마크용).
+	 * 메시 Bounds를 감싸는 구 표면에서 Bounds 내부 임의 지점을 향하는 레이를 쏜다.
+	 */
+	static void Benchmark(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 RayCount,
+		double& OutBuildMS, double& OutRaysPerSecond, uint32& OutHitCount);
 
 private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 빌드 전용 이진 노드
+	struct FBuildNode
+	{
+		FAABB Bounds;
+		int32 Left = -1;
+		int32 Right = -1;
+		uint32 Start = 0;  // TriOrder 배열에서 시작 위치
+		uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수
+
+		bool IsLeaf() const { return Count > 0; }
+	};
+
+	// 빌드 전용 삼각형 정보 (분할 중 반복 계산 방지)
+	struct FBuildTri
+	{
+		FAABB Bounds;
+		FVector Center;
+	};
 
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	int32 BuildRecursive(uint32 Start, uint32 Count, uint32 Depth, const TArray<FBuildTri>& Tris, TArray<uint32>& TriOrder, TArray<FBuildNode>& OutNodes);
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 이진 노드의 자식/손자 중 최대 4개를 하나의 4-wide 노드로 합친다.
+	int32 CollapseNode(int32 BuildIndex, const TArray<FBuildNode>& BuildNodes, const TArray<uint32>& TriOrder,
+		const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	int32 EmitLeafPacket(const FBuildNode& Leaf, const TArray<uint32>& TriOrder,
+		const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+
+	void SerializeHeader(FArchive& Ar);
+	// 순회용 포인터를 소유 배열(Nodes/TriPackets)에 연결
+	void BindOwnedArrays();
+	// 자식 참조가 배열 범위 안에 있는지 검사 (손상 캐시 검출)
+	void ValidateChildren() const;
 
 private:
+	// 빌드했거나 복사 로드한 경우의 소유 배열
+	TArray<FMeshBVHNode4> Nodes;
+	TArray<FMeshBVHTriPacket> TriPackets;
 
-	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
-	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
-	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
+	// 순회가 실제로 읽는 배열 (소유 배열 또는 MappedCache 영역)
+	const FMeshBVHNode4* NodeData = nullptr;
+	const FMeshBVHTriPacket* PacketData = nullptr;
+	int32 NodeCount = 0;
+	int32 PacketCount = 0;
+	std::unique_ptr<FMemoryMappedReader> MappedCache;
+	FAABB RootBounds;
+	uint32 SourceVertexCount = 0;
+	uint32 SourceTriangleCount = 0;
 
+	// 리프 삼각형 수 = 패킷 폭
+	static constexpr uint32 LeafSize = 4;
+	// 축당 SAH bin 개수
+	static constexpr uint32 BinCount = 16;
+	// 이 깊이를 넘으면 SAH 대신 중앙값 분할로 전환 (순회 스택 크기 보장)
+	static constexpr uint32 MaxSAHDepth = 64;
+	// 순회 스택 크기 (4-wide 깊이 * 3 + 1 보다 커야 함)
+	static constexpr int32 MaxTraversalStack = 512;
+};
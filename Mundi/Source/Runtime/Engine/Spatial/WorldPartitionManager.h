@@ -39,7 +39,10 @@ public:
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
-	void FrustumQuery(FFrustum InFrustum);
+	void FrustumQuery(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const;
+
+	/** BVH에 등록되어 있고 갱신 대기 중이 아닌(바운드가 최신인) 컴포넌트인지 여부 */
+	bool IsTrackedAndClean(UStaticMeshComponent* Smc) const;
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
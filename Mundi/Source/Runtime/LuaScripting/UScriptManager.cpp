@@ -20,6 +20,9 @@
 #include "EditorEngine.h"
 #include "StaticMeshActor.h"
 #include "StaticMeshComponent.h"
+#include "SkeletalMeshActor.h"
+#include "SkeletalMeshComponent.h"
+#include "FFBXManager.h"
 #include "GravityWall.h"
 #include "CoinActor.h"
 #include "ProjectileActor.h"
@@ -320,6 +323,20 @@ void UScriptManager::Shutdown()
     lua_close(Lua);
 }
 
+/* 액터를 실제 타입의 usertype으로 Lua에 넘긴다 (AActor로 넘기면 파생 타입 함수를 호출할 수 없음) */
+static sol::object MakeTypedActorObject(sol::state_view InLua, AActor* Actor)
+{
+    if (!Actor) return sol::nil;
+    if (ACoinActor* Coin = Cast<ACoinActor>(Actor)) return sol::make_object(InLua, Coin);
+    if (AGravityWall* Wall = Cast<AGravityWall>(Actor)) return sol::make_object(InLua, Wall);
+    if (AProjectileActor* Projectile = Cast<AProjectileActor>(Actor)) return sol::make_object(InLua, Projectile);
+    if (ADecalActor* Decal = Cast<ADecalActor>(Actor)) return sol::make_object(InLua, Decal);
+    if (AHeightFogActor* Fog = Cast<AHeightFogActor>(Actor)) return sol::make_object(InLua, Fog);
+    if (ASpriteActor* Sprite = Cast<ASpriteActor>(Actor)) return sol::make_object(InLua, Sprite);
+    if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor)) return sol::make_object(InLua, StaticMeshActor);
+    return sol::make_object(InLua, Actor);
+}
+
 /* 전역으로 lua에 타입을 등록 */
 void UScriptManager::RegisterUserTypeToLua()
 {
@@ -780,6 +797,26 @@ void UScriptManager::RegisterUserTypeToLua()
         "SetStaticMeshComponent", &AStaticMeshActor::SetStaticMeshComponent
     );
 
+    // USkeletalMeshComponent 클래스 등록
+    Lua.new_usertype<USkeletalMeshComponent>("USkeletalMeshComponent",
+        sol::base_classes, sol::bases<USceneComponent, UActorComponent>(),
+        // PlayAnimation(FBX 경로, [시퀀스 이름], [루프 여부]) -> 성공 여부
+        "PlayAnimation", [](USkeletalMeshComponent* self, const FString& path, sol::optional<FString> sequenceName, sol::optional<bool> bLoop) -> bool {
+            if (!self) return false;
+            return self->PlayAnimationFromFile(path, sequenceName.value_or(""), bLoop.value_or(true));
+        },
+        "StopAnimation", &USkeletalMeshComponent::StopAnimation,
+        "IsPlayingAnimation", &USkeletalMeshComponent::IsPlayingAnimation,
+        "GetAnimationTime", &USkeletalMeshComponent::GetAnimationTime,
+        "SetAnimationTime", &USkeletalMeshComponent::SetAnimationTime
+    );
+
+    // ASkeletalMeshActor 클래스 등록
+    Lua.new_usertype<ASkeletalMeshActor>("ASkeletalMeshActor",
+        sol::base_classes, sol::bases<AActor>(),
+        "GetSkeletalMeshComponent", &ASkeletalMeshActor::GetSkeletalMeshComponent
+    );
+
     // UProjectileMovementComponent 클래스 등록
     Lua.new_usertype<UProjectileMovementComponent>("UProjectileMovementComponent",
         sol::no_constructor,
@@ -968,6 +1005,36 @@ void UScriptManager::RegisterUserTypeToLua()
         },
 
         "DestroyActor", &UWorld::DestroyActor,
+
+        // 액터 풀: 클래스 이름 문자열로 조회 (예: World:AcquireActor("ACoinActor", Transform))
+        "AcquireActor", [](UWorld* World, const FString& ClassName, const FTransform& Transform, sol::this_state s) -> sol::object {
+            UClass* Class = UClass::FindClass(FName(ClassName));
+            if (!Class)
+            {
+                UE_LOG("[Lua] AcquireActor: unknown class %s", ClassName.c_str());
+                return sol::nil;
+            }
+            return MakeTypedActorObject(s, World->AcquireActor(Class, Transform));
+        },
+        "ReleaseActor", &UWorld::ReleaseActor,
+        "PrewarmActorPool", [](UWorld* World, const FString& ClassName, int32 Count) {
+            UClass* Class = UClass::FindClass(FName(ClassName));
+            if (!Class)
+            {
+                UE_LOG("[Lua] PrewarmActorPool: unknown class %s", ClassName.c_str());
+                return;
+            }
+            World->PrewarmActorPool(Class, Count);
+        },
+        "GetPooledActorCount", [](UWorld* World, const FString& ClassName) -> int32 {
+            UClass* Class = UClass::FindClass(FName(ClassName));
+            if (!Class)
+            {
+                UE_LOG("[Lua] GetPooledActorCount: unknown class %s", ClassName.c_str());
+                return 0;
+            }
+            return World->GetPooledActorCount(Class);
+        },
         "GetActors", &UWorld::GetActors,
         "GetCameraActor", &UWorld::GetCameraActor,
         "GetDeltaTimeManager", & UWorld::GetDeltaTimeManager
@@ -1243,6 +1310,27 @@ void UScriptManager::RegisterGlobalFuncToLua()
         return Cast<AStaticMeshActor>(Actor);
         };
 
+    Lua["CastToSkeletalMeshActor"] = [](AActor* Actor) -> ASkeletalMeshActor* {
+        if (!Actor) return nullptr;
+        return Cast<ASkeletalMeshActor>(Actor);
+        };
+
+    // FBX 애님 스택을 미리 로드(캐시)하고 시퀀스 이름 목록을 반환 (실패 시 빈 테이블)
+    Lua["LoadAnimSequences"] = [](const FString& PathFileName) {
+        std::vector<FString> SequenceNames;
+        if (const TArray<FAnimSequence*>* Sequences = FFBXManager::LoadFBXAnimSequences(PathFileName))
+        {
+            for (const FAnimSequence* Sequence : *Sequences)
+            {
+                if (Sequence)
+                {
+                    SequenceNames.push_back(Sequence->Name);
+                }
+            }
+        }
+        return sol::as_table(SequenceNames);
+        };
+
     CoroutineScheduler.RegisterCoroutineTo(Lua);
 }
 
@@ -1267,6 +1355,11 @@ void UScriptManager::RegisterLocalValueToLua(sol::environment& InEnv, FLuaLocalV
     {
         InEnv["MyActor"] = Pawn;
     }
+    // SkeletalMeshActor (MyActor:GetSkeletalMeshComponent():PlayAnimation(...) 용)
+    else if (ASkeletalMeshActor* SkeletalMeshActor = Cast<ASkeletalMeshActor>(Actor))
+    {
+        InEnv["MyActor"] = SkeletalMeshActor;
+    }
     // 그냥 Actor
     else
     {
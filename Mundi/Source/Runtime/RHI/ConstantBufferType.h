@@ -180,6 +180,11 @@ struct FTileCullingBufferType
     uint32 TileCountX;        // 가로 타일 개수
     uint32 TileCountY;        // 세로 타일 개수
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
+
+    uint32 ClusterSliceCount; // 클러스터 깊이 슬라이스 수 (0 = 2D 타일)
+    float ClusterLogScale;    // slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterLogBias;
+    uint32 TileCullingPadding;
 };
 
 // b12: 섀도우 필터링 상수 버퍼
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 통계를 수집하는 BVH 종류
+ */
+enum class EBVHStatTarget : uint8_t
+{
+	Partition = 0,	// FBVHierarchy (월드 파티션, StaticMeshComponent)
+	Collision,		// FCollisionBVH (ShapeComponent)
+	Count
+};
+
+/**
+ * @brief BVH 하나의 프레임 단위 갱신 통계
+ */
+struct FBVHTreeStats
+{
+	uint32_t RebuildCount = 0;
+	uint32_t RefitCount = 0;
+	double RebuildTimeMS = 0.0;
+	double RefitTimeMS = 0.0;
+
+	// 마지막 재구축 대비 현재 트리의 SAH 비용 비율 (1.0 = 재구축 직후 품질)
+	float SAHCostRatio = 1.0f;
+};
+
+/**
+ * @class FBVHStatManager
+ * @brief BVH Refit / Rebuild 횟수와 소요 시간을 수집하는 싱글톤 클래스입니다.
+ * BVH 갱신은 World Tick에서 일어나므로, 프레임 시작 시 직전 프레임 값을 보관해 두고 그 값을 표시합니다.
+ */
+class FBVHStatManager
+{
+public:
+	static FBVHStatManager& GetInstance()
+	{
+		static FBVHStatManager Instance;
+		return Instance;
+	}
+
+	/** @brief 매 프레임 렌더링 시작 시 호출하여 누적 값을 표시용으로 넘기고 초기화합니다. */
+	void ResetFrameStats()
+	{
+		for (int i = 0; i < static_cast<int>(EBVHStatTarget::Count); ++i)
+		{
+			LastFrameStats[i] = CurrentStats[i];
+
+			const float KeepRatio = CurrentStats[i].SAHCostRatio;
+			CurrentStats[i] = FBVHTreeStats();
+			CurrentStats[i].SAHCostRatio = KeepRatio;
+		}
+	}
+
+	/** @return 직전 프레임의 BVH 갱신 통계 */
+	const FBVHTreeStats& GetStats(EBVHStatTarget Target) const { return LastFrameStats[static_cast<int>(Target)]; }
+
+	/** @brief 진행 중인 프레임의 누적 값. 벤치마크가 측정 전에 보관했다가 되돌려 씬 통계에 섞이지 않게 할 때 사용합니다. */
+	const FBVHTreeStats& GetCurrentStats(EBVHStatTarget Target) const { return CurrentStats[static_cast<int>(Target)]; }
+	void SetCurrentStats(EBVHStatTarget Target, const FBVHTreeStats& InStats) { CurrentStats[static_cast<int>(Target)] = InStats; }
+
+	/** @brief 전체 재구축 1회를 기록합니다. */
+	void RecordRebuild(EBVHStatTarget Target, double TimeMS)
+	{
+		FBVHTreeStats& Stats = CurrentStats[static_cast<int>(Target)];
+		++Stats.RebuildCount;
+		Stats.RebuildTimeMS += TimeMS;
+		Stats.SAHCostRatio = 1.0f;
+	}
+
+	/** @brief Refit 1회와 Refit 후 SAH 비용 비율을 기록합니다. */
+	void RecordRefit(EBVHStatTarget Target, double TimeMS, float InSAHCostRatio)
+	{
+		FBVHTreeStats& Stats = CurrentStats[static_cast<int>(Target)];
+		++Stats.RefitCount;
+		Stats.RefitTimeMS += TimeMS;
+		Stats.SAHCostRatio = InSAHCostRatio;
+	}
+
+private:
+	FBVHStatManager() = default;
+	~FBVHStatManager() = default;
+
+	FBVHStatManager(const FBVHStatManager&) = delete;
+	FBVHStatManager& operator=(const FBVHStatManager&) = delete;
+
+private:
+	FBVHTreeStats CurrentStats[static_cast<int>(EBVHStatTarget::Count)];
+	FBVHTreeStats LastFrameStats[static_cast<int>(EBVHStatTarget::Count)];
+};
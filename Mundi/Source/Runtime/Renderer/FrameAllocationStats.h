@@ -0,0 +1,160 @@
+﻿#pragma once
+
+#include <cstdint>
+#include "MemoryManager.h"
+
+/**
+ * @brief 한 프레임 동안 씬 렌더링(모든 뷰)에서 일어난 힙 할당 통계
+ * RenderHeapAllocations는 전역 operator new 카운터 전후 차이이므로 같은 구간에 다른 스레드가 한 할당도 포함되고,
+ * BatchHeapAllocations는 배치 구간을 실행한 (렌더) 스레드의 할당만 센다.
+ * 힙 할당 횟수는 CMemoryManager의 힙 할당 집계가 켜져 있을 때만 늘어난다 (MEMORY HEAPCOUNT).
+ */
+struct FFrameAllocationStats
+{
+	uint32_t RenderHeapAllocations = 0;		// FSceneRenderer 생성 ~ 소멸 전체
+	uint32_t RenderObjectAllocations = 0;	// 같은 구간의 UObject 할당 (CMemoryManager)
+	uint32_t BatchHeapAllocations = 0;		// 메시 배치 수집/정렬/그리기 구간만
+	uint32_t ArenaChunkAllocations = 0;		// 프레임 아레나 청크 할당 (정상 상태 0)
+	uint64_t ArenaUsedBytes = 0;			// 뷰 하나가 쓴 아레나 최대 바이트
+	uint64_t ArenaCapacityBytes = 0;
+};
+
+/**
+ * @class FFrameAllocationStatManager
+ * @brief 렌더링 중 힙 할당 횟수와 프레임 아레나 사용량을 수집하는 싱글톤 클래스입니다.
+ */
+class FFrameAllocationStatManager
+{
+public:
+	static FFrameAllocationStatManager& GetInstance()
+	{
+		static FFrameAllocationStatManager Instance;
+		return Instance;
+	}
+
+	/** @brief 매 프레임 렌더링 시작 시 호출하여 누적 값을 표시용으로 넘기고 초기화합니다. */
+	void ResetFrameStats()
+	{
+		LastFrameStats = CurrentStats;
+		CurrentStats = FFrameAllocationStats();
+
+		if (CheckFramesRemaining > 0)
+		{
+			AccumulateAllocationCheck();
+		}
+	}
+
+	/**
+	 * @brief 다음 InFrames 프레임 동안 배치 수집/정렬/그리기 구간의 힙 할당과 프레임 아레나 청크 할당이 0인지 검사합니다 (BENCH BATCHALLOC).
+	 * 검사 중에는 힙 할당 집계를 켜고, 끝나면 결과를 로그로 남긴 뒤 집계 스위치를 원래대로 되돌립니다.
+	 * 검사를 시작한 프레임은 일부 구간만 집계되므로 제외합니다.
+	 */
+	void BeginAllocationCheck(uint32_t InFrames)
+	{
+		if (CheckFramesRemaining == 0)
+		{
+			bHeapCountingBeforeCheck = CMemoryManager::IsGlobalHeapCountingEnabled();
+		}
+		CMemoryManager::SetGlobalHeapCountingEnabled(true);
+
+		CheckFrames = InFrames;
+		CheckFramesRemaining = InFrames;
+		bSkipNextCheckFrame = true;
+		CheckBatchAllocations = 0;
+		CheckArenaChunkAllocations = 0;
+		CheckFailedFrames = 0;
+	}
+
+	bool IsAllocationCheckRunning() const { return CheckFramesRemaining > 0; }
+
+	/** @return 직전 프레임의 할당 통계 */
+	const FFrameAllocationStats& GetStats() const { return LastFrameStats; }
+
+	void AddRenderAllocations(uint64_t InHeapCount, uint64_t InObjectCount)
+	{
+		CurrentStats.RenderHeapAllocations += static_cast<uint32_t>(InHeapCount);
+		CurrentStats.RenderObjectAllocations += static_cast<uint32_t>(InObjectCount);
+	}
+
+	void AddBatchAllocations(uint64_t InHeapCount) { CurrentStats.BatchHeapAllocations += static_cast<uint32_t>(InHeapCount); }
+
+	void RecordArena(uint32_t InChunkAllocations, uint64_t InUsedBytes, uint64_t InCapacityBytes)
+	{
+		CurrentStats.ArenaChunkAllocations += InChunkAllocations;
+		CurrentStats.ArenaUsedBytes = CurrentStats.ArenaUsedBytes > InUsedBytes ? CurrentStats.ArenaUsedBytes : InUsedBytes;
+		CurrentStats.ArenaCapacityBytes = InCapacityBytes;
+	}
+
+private:
+	FFrameAllocationStatManager() = default;
+	~FFrameAllocationStatManager() = default;
+
+	FFrameAllocationStatManager(const FFrameAllocationStatManager&) = delete;
+	FFrameAllocationStatManager& operator=(const FFrameAllocationStatManager&) = delete;
+
+	void AccumulateAllocationCheck()
+	{
+		if (bSkipNextCheckFrame)
+		{
+			bSkipNextCheckFrame = false;
+			return;
+		}
+
+		CheckBatchAllocations += LastFrameStats.BatchHeapAllocations;
+		CheckArenaChunkAllocations += LastFrameStats.ArenaChunkAllocations;
+		if (LastFrameStats.BatchHeapAllocations > 0 || LastFrameStats.ArenaChunkAllocations > 0)
+		{
+			++CheckFailedFrames;
+		}
+
+		if (--CheckFramesRemaining > 0)
+		{
+			return;
+		}
+
+		CMemoryManager::SetGlobalHeapCountingEnabled(bHeapCountingBeforeCheck);
+		if (CheckFailedFrames > 0)
+		{
+			UE_LOG("[error] BENCH BATCHALLOC: %u / %u frames allocated (batch heap allocs %llu, arena chunk allocs %llu)",
+				CheckFailedFrames, CheckFrames, CheckBatchAllocations, CheckArenaChunkAllocations);
+		}
+		else
+		{
+			UE_LOG("BENCH BATCHALLOC: %u frames without batch/sort/custom-data allocations (arena peak %.1f KB)",
+				CheckFrames, static_cast<double>(LastFrameStats.ArenaUsedBytes) / 1024.0);
+		}
+	}
+
+private:
+	FFrameAllocationStats CurrentStats;
+	FFrameAllocationStats LastFrameStats;
+
+	// BENCH BATCHALLOC 검사 상태
+	uint32_t CheckFrames = 0;
+	uint32_t CheckFramesRemaining = 0;
+	uint32_t CheckFailedFrames = 0;
+	unsigned long long CheckBatchAllocations = 0;
+	unsigned long long CheckArenaChunkAllocations = 0;
+	bool bSkipNextCheckFrame = false;
+	bool bHeapCountingBeforeCheck = false;
+};
+
+/** @brief 스코프(또는 Stop 호출)까지 현재 스레드의 힙 할당 횟수를 메시 배치 통계에 더합니다. */
+class FScopedBatchAllocationCounter
+{
+public:
+	FScopedBatchAllocationCounter() : StartCount(CMemoryManager::GetThreadHeapAllocationCount()) {}
+	~FScopedBatchAllocationCounter() { Stop(); }
+
+	void Stop()
+	{
+		if (bStopped)
+			return;
+		bStopped = true;
+		FFrameAllocationStatManager::GetInstance().AddBatchAllocations(CMemoryManager::GetThreadHeapAllocationCount() - StartCount);
+	}
+
+private:
+	uint64_t StartCount;
+	bool bStopped = false;
+};
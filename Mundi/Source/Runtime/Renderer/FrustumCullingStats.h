@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class FFrustumCullingStatManager
+ * @brief 컴포넌트 단위 절두체 컬링 통계를 수집하고 제공하는 싱글톤 클래스입니다.
+ * 뷰포트가 여러 개인 경우 한 프레임 동안 모든 뷰의 결과가 누적됩니다.
+ */
+class FFrustumCullingStatManager
+{
+public:
+	static FFrustumCullingStatManager& GetInstance()
+	{
+		static FFrustumCullingStatManager Instance;
+		return Instance;
+	}
+
+	/** @brief 매 프레임 렌더링 시작 시 호출하여 프레임 단위 통계 데이터를 초기화합니다. */
+	void ResetFrameStats()
+	{
+		TestedComponentCount = 0;
+		CulledComponentCount = 0;
+		BVHVisibleCount = 0;
+		BVHQueryTimeMS = 0.0;
+	}
+
+	// --- Getters ---
+
+	/** @return 컬링 테스트를 거친 컴포넌트 수 */
+	uint32_t GetTestedComponentCount() const { return TestedComponentCount; }
+
+	/** @return 절두체 밖으로 판정되어 제외된 컴포넌트 수 */
+	uint32_t GetCulledComponentCount() const { return CulledComponentCount; }
+
+	/** @return 컬링을 통과한 컴포넌트 수 */
+	uint32_t GetVisibleComponentCount() const { return TestedComponentCount - CulledComponentCount; }
+
+	/** @return 파티션 BVH 쿼리로 가시 판정된 스태틱 메시 수 */
+	uint32_t GetBVHVisibleCount() const { return BVHVisibleCount; }
+
+	/** @return 파티션 BVH 절두체 쿼리에 소요된 시간 (ms) */
+	double GetBVHQueryTimeMS() const { return BVHQueryTimeMS; }
+
+	// --- Incrementers ---
+
+	void AddTestedComponentCount(uint32_t InCount) { TestedComponentCount += InCount; }
+	void AddCulledComponentCount(uint32_t InCount) { CulledComponentCount += InCount; }
+	void AddBVHVisibleCount(uint32_t InCount) { BVHVisibleCount += InCount; }
+	double& GetBVHQueryTimeSlot() { return BVHQueryTimeMS; }
+
+private:
+	FFrustumCullingStatManager() = default;
+	~FFrustumCullingStatManager() = default;
+
+	FFrustumCullingStatManager(const FFrustumCullingStatManager&) = delete;
+	FFrustumCullingStatManager& operator=(const FFrustumCullingStatManager&) = delete;
+
+private:
+	uint32_t TestedComponentCount = 0;
+	uint32_t CulledComponentCount = 0;
+	uint32_t BVHVisibleCount = 0;
+	double BVHQueryTimeMS = 0.0;
+};
@@ -62,8 +62,10 @@ struct FMeshBatchElement
 	// (기본값으로 흰색(1,1,1,1)을 설정하는 것이 일반적입니다.)
 	FLinearColor InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
-	// 커스텀 데이터 배열 (스프라이트 애니메이션 등 셰이더 파라미터 전달용)
-	TArray<float> CustomData;
+	// 커스텀 데이터 (스프라이트 애니메이션 등 셰이더 파라미터 전달용)
+	// FSceneView::FrameAllocator에 할당하므로 해당 뷰를 렌더링하는 동안만 유효합니다.
+	const float* CustomData = nullptr;
+	uint32 CustomDataCount = 0;
 
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
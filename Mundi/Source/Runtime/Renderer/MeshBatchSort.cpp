@@ -0,0 +1,308 @@
+﻿#include "pch.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchElement.h"
+#include <chrono>
+#include <random>
+
+namespace
+{
+	uint64 MixStateWord(uint64 Value)
+	{
+		// splitmix64 finalizer
+		Value ^= Value >> 30;
+		Value *= 0xbf58476d1ce4e5b9ull;
+		Value ^= Value >> 27;
+		Value *= 0x94d049bb133111ebull;
+		Value ^= Value >> 31;
+		return Value;
+	}
+
+	uint32 HashState(uint64 A, uint64 B, uint64 C)
+	{
+		return static_cast<uint32>(MixStateWord(A ^ MixStateWord(B ^ MixStateWord(C))));
+	}
+
+	uint64 ToWord(const void* Ptr)
+	{
+		return static_cast<uint64>(reinterpret_cast<uintptr_t>(Ptr));
+	}
+
+	// DrawMeshBatches의 캐시 비교 기준과 같은 상태 변경 횟수 (셰이더 + 픽셀 리소스 + IA)
+	uint32 CountStateChanges(const TArray<FMeshBatchElement>& Batches, const TArray<uint32>* Order)
+	{
+		uint32 Changes = 0;
+		const FMeshBatchElement* Prev = nullptr;
+		for (int32 i = 0; i < Batches.Num(); ++i)
+		{
+			const FMeshBatchElement& Batch = Order ? Batches[(*Order)[i]] : Batches[i];
+			if (!Prev || Batch.VertexShader != Prev->VertexShader || Batch.PixelShader != Prev->PixelShader)
+				++Changes;
+			if (!Prev || Batch.Material != Prev->Material || Batch.InstanceShaderResourceView != Prev->InstanceShaderResourceView)
+				++Changes;
+			if (!Prev || Batch.VertexBuffer != Prev->VertexBuffer || Batch.IndexBuffer != Prev->IndexBuffer ||
+				Batch.VertexStride != Prev->VertexStride || Batch.PrimitiveTopology != Prev->PrimitiveTopology)
+				++Changes;
+			Prev = &Batch;
+		}
+		return Changes;
+	}
+}
+
+void FMeshBatchSorter::FStateIdTable::Reset()
+{
+	// 고유 상태 수는 배치 수보다 훨씬 적으므로 작게 시작해 필요할 때만 키운다 (용량은 다음 호출에도 유지)
+	if (Slots.IsEmpty())
+	{
+		Slots.SetNum(64);
+	}
+	for (FSlot& Slot : Slots)
+	{
+		Slot.bUsed = false;
+	}
+	NextId = 0;
+}
+
+void FMeshBatchSorter::FStateIdTable::Grow()
+{
+	TArray<FSlot> OldSlots;
+	OldSlots.swap(Slots);
+	Slots.SetNum(OldSlots.Num() * 2);
+	for (FSlot& Slot : Slots)
+	{
+		Slot.bUsed = false;
+	}
+
+	const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+	for (const FSlot& Old : OldSlots)
+	{
+		if (!Old.bUsed)
+			continue;
+
+		uint32 SlotIndex = HashState(Old.Words[0], Old.Words[1], Old.Words[2]) & Mask;
+		while (Slots[SlotIndex].bUsed)
+		{
+			SlotIndex = (SlotIndex + 1) & Mask;
+		}
+		Slots[SlotIndex] = Old;
+	}
+}
+
+uint32 FMeshBatchSorter::FStateIdTable::FindOrAdd(uint64 A, uint64 B, uint64 C, uint32 MaxId)
+{
+	// 부하율 0.5 이하 유지
+	if ((NextId + 1) * 2 > static_cast<uint32>(Slots.Num()))
+	{
+		Grow();
+	}
+
+	const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+	uint32 SlotIndex = HashState(A, B, C) & Mask;
+	while (true)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		if (!Slot.bUsed)
+		{
+			Slot.Words[0] = A;
+			Slot.Words[1] = B;
+			Slot.Words[2] = C;
+			Slot.Id = FMath::Min(NextId, MaxId);
+			Slot.bUsed = true;
+			++NextId;
+			return Slot.Id;
+		}
+		if (Slot.Words[0] == A && Slot.Words[1] == B && Slot.Words[2] == C)
+		{
+			return Slot.Id;
+		}
+		SlotIndex = (SlotIndex + 1) & Mask;
+	}
+}
+
+void FMeshBatchSorter::Sort(const TArray<FMeshBatchElement>& Batches, EMeshBatchSortMode Mode, const FMatrix& ViewMatrix, TArray<uint32>& OutOrder)
+{
+	const int32 Count = Batches.Num();
+	OutOrder.SetNum(Count);
+	if (Count == 0)
+		return;
+
+	ShaderIds.Reset();
+	MaterialIds.Reset();
+	MeshIds.Reset();
+
+	const bool bTranslucent = Mode == EMeshBatchSortMode::Translucent;
+	const uint32 MeshIdBits = bTranslucent ? TranslucentMeshIdBits : OpaqueMeshIdBits;
+	const uint32 DepthBits = bTranslucent ? TranslucentDepthBits : OpaqueDepthBits;
+	const uint32 MaxDepthValue = (1u << DepthBits) - 1;
+
+	// 1. 키 생성 (배치 원본은 한 번만 읽는다)
+	Keys.SetNum(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FMeshBatchElement& Batch = Batches[i];
+		const uint64 ShaderId = ShaderIds.FindOrAdd(ToWord(Batch.VertexShader), ToWord(Batch.PixelShader), 0,
+			(1u << ShaderIdBits) - 1);
+		const uint64 MaterialId = MaterialIds.FindOrAdd(ToWord(Batch.Material), ToWord(Batch.InstanceShaderResourceView), 0,
+			(1u << MaterialIdBits) - 1);
+		const uint64 MeshId = MeshIds.FindOrAdd(ToWord(Batch.VertexBuffer), ToWord(Batch.IndexBuffer),
+			(static_cast<uint64>(Batch.VertexStride) << 32) | static_cast<uint32>(Batch.PrimitiveTopology), (1u << MeshIdBits) - 1);
+
+		// 뷰 깊이 = 월드 행렬 이동 성분의 뷰 공간 z. 양수 float의 비트 패턴은 값 순서와 같으므로
+		// 상위 DepthBits만 잘라 범위 계산 없이 상대 정밀도를 유지하는 깊이 키로 쓴다 (카메라 뒤는 0)
+		const FMatrix& World = Batch.WorldMatrix;
+		const float ViewZ = FMath::Max(World.M[3][0] * ViewMatrix.M[0][2] + World.M[3][1] * ViewMatrix.M[1][2] +
+			World.M[3][2] * ViewMatrix.M[2][2] + ViewMatrix.M[3][2], 0.0f);
+		uint32 DepthBitsValue;
+		std::memcpy(&DepthBitsValue, &ViewZ, sizeof(float));
+		uint64 Depth = DepthBitsValue >> (31 - DepthBits);	// 부호 비트는 항상 0
+
+		if (bTranslucent)
+		{
+			// 먼 것부터: 깊이를 뒤집어 최상위에 둔다
+			Depth = MaxDepthValue - Depth;
+			Keys[i] = (Depth << (ShaderIdBits + MaterialIdBits + MeshIdBits)) |
+				(ShaderId << (MaterialIdBits + MeshIdBits)) | (MaterialId << MeshIdBits) | MeshId;
+		}
+		else
+		{
+			Keys[i] = (ShaderId << (MaterialIdBits + MeshIdBits + DepthBits)) |
+				(MaterialId << (MeshIdBits + DepthBits)) | (MeshId << DepthBits) | Depth;
+		}
+		OutOrder[i] = static_cast<uint32>(i);
+	}
+
+	// 2. 정렬
+	RadixSort(Keys, OutOrder, TempKeys, TempIndices);
+}
+
+void FMeshBatchSorter::RadixSort(TArray<uint64>& InOutKeys, TArray<uint32>& InOutIndices, TArray<uint64>& TempKeys, TArray<uint32>& TempIndices)
+{
+	const int32 Count = InOutKeys.Num();
+	if (Count < 2)
+		return;
+
+	TempKeys.SetNum(Count);
+	TempIndices.SetNum(Count);
+
+	// 8자리 히스토그램을 한 번에 계산
+	constexpr int32 DigitCount = 8;
+	uint32 Histograms[DigitCount][256] = {};
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const uint64 Key = InOutKeys[i];
+		for (int32 Digit = 0; Digit < DigitCount; ++Digit)
+		{
+			++Histograms[Digit][(Key >> (Digit * 8)) & 0xFF];
+		}
+	}
+
+	uint64* SrcKeys = InOutKeys.data();
+	uint32* SrcIndices = InOutIndices.data();
+	uint64* DstKeys = TempKeys.data();
+	uint32* DstIndices = TempIndices.data();
+
+	for (int32 Digit = 0; Digit < DigitCount; ++Digit)
+	{
+		uint32* Histogram = Histograms[Digit];
+		const uint32 Shift = Digit * 8;
+
+		// 모든 키가 같은 값을 가지는 자리는 순서를 바꾸지 않으므로 건너뜀 (상위 ID 비트는 대부분 0)
+		if (Histogram[(SrcKeys[0] >> Shift) & 0xFF] == static_cast<uint32>(Count))
+			continue;
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			const uint32 BucketCount = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += BucketCount;
+		}
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const uint32 Dst = Histogram[(SrcKeys[i] >> Shift) & 0xFF]++;
+			DstKeys[Dst] = SrcKeys[i];
+			DstIndices[Dst] = SrcIndices[i];
+		}
+
+		std::swap(SrcKeys, DstKeys);
+		std::swap(SrcIndices, DstIndices);
+	}
+
+	// 홀수 번 흩뿌렸다면 결과가 임시 버퍼에 있다
+	if (SrcKeys != InOutKeys.data())
+	{
+		InOutKeys.swap(TempKeys);
+		InOutIndices.swap(TempIndices);
+	}
+}
+
+void FMeshBatchSorter::Benchmark(uint32 BatchCount, int32 Iterations, double& OutKeySortMS, double& OutStdSortMS,
+	uint32& OutKeySortStateChanges, uint32& OutStdSortStateChanges)
+{
+	// 합성 씬: 셰이더 조합 32개, 머티리얼 512개, 메시 2048개. 포인터 값은 상태 구분용이며 역참조하지 않는다
+	auto FakePtr = [](uint32 Kind, uint32 Id) { return reinterpret_cast<void*>(static_cast<uintptr_t>((Kind << 24) + (Id + 1) * 64)); };
+
+	std::mt19937 Rng(1234);
+	std::uniform_int_distribution<uint32> ShaderDist(0, 31);
+	std::uniform_int_distribution<uint32> MaterialDist(0, 511);
+	std::uniform_int_distribution<uint32> MeshDist(0, 2047);
+	std::uniform_real_distribution<float> PositionDist(-500.0f, 500.0f);
+
+	TArray<FMeshBatchElement> Batches;
+	Batches.SetNum(static_cast<int32>(BatchCount));
+	for (uint32 i = 0; i < BatchCount; ++i)
+	{
+		FMeshBatchElement& Batch = Batches[i];
+		const uint32 ShaderId = ShaderDist(Rng);
+		const uint32 MeshId = MeshDist(Rng);
+		Batch.VertexShader = static_cast<ID3D11VertexShader*>(FakePtr(1, ShaderId));
+		Batch.PixelShader = static_cast<ID3D11PixelShader*>(FakePtr(2, ShaderId));
+		Batch.InputLayout = static_cast<ID3D11InputLayout*>(FakePtr(3, ShaderId));
+		Batch.Material = static_cast<UMaterialInterface*>(FakePtr(4, MaterialDist(Rng)));
+		Batch.VertexBuffer = static_cast<ID3D11Buffer*>(FakePtr(5, MeshId));
+		Batch.IndexBuffer = static_cast<ID3D11Buffer*>(FakePtr(6, MeshId));
+		Batch.VertexStride = 64;
+		Batch.WorldMatrix = FMatrix::MakeTranslation(FVector(PositionDist(Rng), PositionDist(Rng), PositionDist(Rng)));
+		Batch.ObjectID = i;
+		if (i % 8 == 0)
+		{
+			static const float SpriteData[3] = { 4.0f, 4.0f, 0.0f };	// 스프라이트 배치
+			Batch.CustomData = SpriteData;
+			Batch.CustomDataCount = 3;
+		}
+	}
+
+	const FMatrix ViewMatrix = FMatrix::Identity();
+	auto ElapsedMS = [](std::chrono::high_resolution_clock::time_point Start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+	};
+
+	// 키 + 기수 정렬 (키 생성 포함, 배치 원본은 그대로)
+	FMeshBatchSorter Sorter;
+	TArray<uint32> Order;
+	Sorter.Sort(Batches, EMeshBatchSortMode::Opaque, ViewMatrix, Order);	// 워밍업 (버퍼 확보)
+	double KeySortMS = 0.0;
+	for (int32 Iter = 0; Iter < Iterations; ++Iter)
+	{
+		const auto Start = std::chrono::high_resolution_clock::now();
+		Sorter.Sort(Batches, EMeshBatchSortMode::Opaque, ViewMatrix, Order);
+		KeySortMS += ElapsedMS(Start);
+	}
+	OutKeySortStateChanges = CountStateChanges(Batches, &Order);
+
+	// 기존 방식: 배치 구조체 자체를 operator<로 정렬 (매 반복 복사본 준비는 측정에서 제외)
+	TArray<FMeshBatchElement> Work;
+	double StdSortMS = 0.0;
+	for (int32 Iter = 0; Iter < Iterations; ++Iter)
+	{
+		Work = Batches;
+		const auto Start = std::chrono::high_resolution_clock::now();
+		Work.Sort();
+		StdSortMS += ElapsedMS(Start);
+	}
+	OutStdSortStateChanges = CountStateChanges(Work, nullptr);
+
+	OutKeySortMS = KeySortMS / FMath::Max(Iterations, 1);
+	OutStdSortMS = StdSortMS / FMath::Max(Iterations, 1);
+}
@@ -0,0 +1,70 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+struct FMatrix;
+
+// 정렬 키 구성 방식
+enum class EMeshBatchSortMode : uint8
+{
+	Opaque,       // 셰이더 → 머티리얼 → 메시 → 깊이(앞에서 뒤로)
+	Translucent,  // 깊이(뒤에서 앞으로) → 셰이더 → 머티리얼 → 메시
+};
+
+/**
+ * FMeshBatchElement 목록을 64비트 정렬 키로 정렬한다.
+ * 배치마다 셰이더(VS/PS) · 머티리얼(+인스턴스 SRV) · 메시(VB/IB/스트라이드/토폴로지) 상태에
+ * 프레임 내 첫 등장 순서로 작은 ID를 붙여 키 하나로 양자화하고, (키, 인덱스) 쌍만 LSD 기수 정렬한다.
+ * 배치 원본(행렬, CustomData 등)은 옮기지 않으며, 결과는 그리기 순서 인덱스 배열로 돌려준다.
+ * ID가 필드 비트 폭을 넘으면 마지막 ID로 합쳐진다 (상태 그룹만 느슨해지고 그리기 결과는 같다).
+ */
+class FMeshBatchSorter
+{
+public:
+	// Batches의 그리기 순서를 OutOrder에 채운다. 키가 같은 배치는 수집 순서를 유지한다 (안정 정렬)
+	void Sort(const TArray<FMeshBatchElement>& Batches, EMeshBatchSortMode Mode, const FMatrix& ViewMatrix, TArray<uint32>& OutOrder);
+
+	// 키와 인덱스를 키 기준으로 함께 정렬한다 (8비트 자리 8회, 모든 키가 같은 자리는 건너뜀)
+	static void RadixSort(TArray<uint64>& InOutKeys, TArray<uint32>& InOutIndices, TArray<uint64>& TempKeys, TArray<uint32>& TempIndices);
+
+	/**
+	 * 합성 배치 BatchCount개로 키 + 기수 정렬과 기존 TArray::Sort(operator<)를 비교한다 (콘솔 벤치마크용)
+	 * 시간은 Iterations회 평균(ms)이며, 상태 변경 횟수는 DrawMeshBatches와 같은 기준(셰이더/픽셀 리소스/IA)으로 센다.
+	 */
+	static void Benchmark(uint32 BatchCount, int32 Iterations, double& OutKeySortMS, double& OutStdSortMS,
+		uint32& OutKeySortStateChanges, uint32& OutStdSortStateChanges);
+
+	static constexpr uint32 ShaderIdBits = 12;
+	static constexpr uint32 MaterialIdBits = 14;
+	static constexpr uint32 OpaqueMeshIdBits = 16;
+	static constexpr uint32 OpaqueDepthBits = 64 - ShaderIdBits - MaterialIdBits - OpaqueMeshIdBits;
+	static constexpr uint32 TranslucentMeshIdBits = 14;
+	static constexpr uint32 TranslucentDepthBits = 64 - ShaderIdBits - MaterialIdBits - TranslucentMeshIdBits;
+
+private:
+	// 상태(포인터 최대 3워드) → 프레임 내 ID. 열린 주소법 해시 테이블, 슬롯 배열은 호출 간 재사용한다
+	struct FStateIdTable
+	{
+		struct FSlot
+		{
+			uint64 Words[3];
+			uint32 Id;
+			bool bUsed;
+		};
+
+		TArray<FSlot> Slots;
+		uint32 NextId = 0;
+
+		void Reset();
+		void Grow();
+		// 새 상태면 NextId를 붙인다. MaxId를 넘는 ID는 MaxId로 포화
+		uint32 FindOrAdd(uint64 A, uint64 B, uint64 C, uint32 MaxId);
+	};
+
+	FStateIdTable ShaderIds;
+	FStateIdTable MaterialIds;
+	FStateIdTable MeshIds;
+
+	TArray<uint64> Keys;
+	TArray<uint64> TempKeys;
+	TArray<uint32> TempIndices;
+};
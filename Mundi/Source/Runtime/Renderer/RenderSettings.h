@@ -35,6 +35,9 @@ public:
     // Tile-based light culling
     void SetTileSize(uint32 Value) { TileSize = Value; }
     uint32 GetTileSize() const { return TileSize; }
+    // 클러스터 깊이 슬라이스 수 (0 = 2D 타일, 최대 32)
+    void SetClusterDepthSlices(uint32 Value) { ClusterDepthSlices = Value; }
+    uint32 GetClusterDepthSlices() const { return ClusterDepthSlices; }
 
     // Gamma correction parameters
     void SetGamma(float Value) { Gamma = Value; UpdateInvGamma(); }
@@ -60,6 +63,7 @@ private:
 
     // Tile-based light culling
     uint32 TileSize = 16;                   // 타일 크기 (픽셀, 기본값: 16)
+    uint32 ClusterDepthSlices = 0;          // 깊이 슬라이스 수 (0이면 2D 타일 컬링)
 
     // Gamma correction parameters
     float Gamma = 1.0f;                     // 감마 값 (sRGB 표준: 2.2)
@@ -29,12 +29,18 @@
 #include "EditorEngine.h"
 #include "DecalComponent.h"
 #include "DecalStatManager.h"
+#include "FrustumCullingStats.h"
+#include "BVHStats.h"
+#include "AnimationStats.h"
+#include "TransformStats.h"
+#include "FrameAllocationStats.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
 
 #include <Windows.h>
 
 URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
+	, SceneRenderFrameResources(std::make_unique<FSceneRenderFrameResources>())
 {
 	InitializeLineBatch();
 }
@@ -59,6 +65,11 @@ void URenderer::BeginFrame()
 
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FFrustumCullingStatManager::GetInstance().ResetFrameStats();
+	FBVHStatManager::GetInstance().ResetFrameStats();
+	FAnimationStatManager::GetInstance().ResetFrameStats();
+	FTransformStatManager::GetInstance().ResetFrameStats();
+	FFrameAllocationStatManager::GetInstance().ResetFrameStats();
 
 	RHIDevice->ClearAllBuffer();
 }
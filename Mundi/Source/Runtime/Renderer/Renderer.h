@@ -11,6 +11,7 @@ class UStaticMesh;
 class UBillboardComponent;
 class UPrimitiveComponent;
 struct FMaterialSlot;
+struct FSceneRenderFrameResources;
 
 class URenderer
 {
@@ -40,12 +41,17 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// FSceneRenderer(뷰마다 생성)가 빌려 쓰는 배치 목록 / 프레임 아레나. 뷰는 순차 렌더링되므로 하나를 공유한다
+	FSceneRenderFrameResources& GetSceneRenderFrameResources() { return *SceneRenderFrameResources; }
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
 private:
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
 
+	std::unique_ptr<FSceneRenderFrameResources> SceneRenderFrameResources;
+
 	// Current viewport size (per FViewport draw); 0 if unset
 
 	uint32 CurrentViewportWidth = 0;
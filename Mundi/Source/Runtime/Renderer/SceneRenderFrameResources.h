@@ -0,0 +1,45 @@
+﻿#pragma once
+#include "AABB.h"
+#include "MeshBatchElement.h"
+#include "MeshBatchSort.h"
+#include "FrameLinearAllocator.h"
+
+class USkeletalMeshComponent;
+
+// 섀도우 캐스터 캐시 항목: ShadowCasterBatches 내 배치 구간 + 월드 AABB
+struct FShadowCasterEntry
+{
+	FAABB Bounds;
+	USkeletalMeshComponent* SkeletalComponent = nullptr;	// 섀도우 뷰에 들어가면 그리기 전에 스키닝을 맞춘다
+	int32 FirstBatch = 0;
+	int32 NumBatches = 0;
+	bool bHasBounds = false;	// 바운드를 알 수 없는 타입은 컬링하지 않음
+	bool bStatic = false;		// 정적 섀도우 캐시에 들어가는 캐스터 (스태틱 메시)
+};
+
+/**
+ * @struct FSceneRenderFrameResources
+ * @brief FSceneRenderer가 매 프레임 다시 채우는 메시 배치 목록과 프레임 아레나입니다.
+ * FSceneRenderer는 뷰마다 생성/소멸되므로 URenderer가 이 묶음을 소유하고 빌려줍니다.
+ * 배열은 Empty()로 비워 용량을 유지하고 아레나는 뷰 렌더가 끝날 때 Reset하므로,
+ * 배치 수가 이전 최대치를 넘지 않는 한 배치 생성에서 힙 할당이 일어나지 않습니다.
+ */
+struct FSceneRenderFrameResources
+{
+	// 배치 CustomData 등 뷰 하나의 수명 동안만 유효한 데이터
+	FFrameLinearAllocator FrameAllocator;
+
+	// 불투명 패스
+	TArray<FMeshBatchElement> MeshBatchElements;
+	TArray<FMeshBatchElement> SkeletalMeshElements;
+	FMeshBatchSorter MeshBatchSorter;
+	TArray<uint32> MeshBatchDrawOrder;
+	TArray<uint32> SkeletalMeshDrawOrder;
+
+	// 섀도우 패스: 프레임당 한 번 생성한 캐스터 배치 캐시와 섀도우 뷰 하나 분량의 작업 목록
+	TArray<FShadowCasterEntry> ShadowCasterCache;
+	TArray<FMeshBatchElement> ShadowCasterBatches;
+	TArray<int32> ShadowCasterIndices;
+	TArray<FMeshBatchElement> ShadowViewBatches;
+	TArray<FMeshBatchElement> DynamicShadowViewBatches;
+};
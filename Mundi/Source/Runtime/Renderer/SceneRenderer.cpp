@@ -1,4 +1,4 @@
-#include "pch.h"
+﻿#include "pch.h"
 #include "SceneRenderer.h"
 
 // FSceneRenderer가 사용하는 모든 헤더 포함
@@ -21,10 +21,12 @@
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
 #include "DecalStatManager.h"
+#include "FrustumCullingStats.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
 #include "BoundingSphere.h"
+#include "Collision.h"
 #include "HeightFogComponent.h"
 #include "Gizmo/GizmoArrowComponent.h"
 #include "Gizmo/GizmoRotateComponent.h"
@@ -35,6 +37,7 @@
 #include "SpotLightComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "FrameAllocationStats.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
@@ -49,6 +52,7 @@
 #include "PlayerController.h"
 #include "PlayerCameraManager.h"
 #include "SkeletalMeshComponent.h"
+#include "AnimationManager.h"
 
 // RenderLetterBoxPass 관련
 #include "PlayerController.h"
@@ -62,13 +66,27 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 	, View(InView) // 전달받은 FSceneView 저장
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
+	, FrameResources(InOwnerRenderer->GetSceneRenderFrameResources())
+	, ShadowCasterCache(FrameResources.ShadowCasterCache)
+	, ShadowCasterBatches(FrameResources.ShadowCasterBatches)
+	, MeshBatchElements(FrameResources.MeshBatchElements)
+	, SkeletalMeshElements(FrameResources.SkeletalMeshElements)
+	, MeshBatchSorter(FrameResources.MeshBatchSorter)
+	, MeshBatchDrawOrder(FrameResources.MeshBatchDrawOrder)
+	, SkeletalMeshDrawOrder(FrameResources.SkeletalMeshDrawOrder)
+	, StartHeapAllocationCount(CMemoryManager::GetGlobalHeapAllocationCount())
+	, StartObjectAllocationCount(CMemoryManager::GetAllocationEventCount())
+	, StartArenaChunkAllocationCount(FrameResources.FrameAllocator.GetChunkAllocationCount())
 {
+	// 컴포넌트가 배치 페이로드를 프레임 아레나에 쓸 수 있도록 뷰에 연결
+	View->FrameAllocator = &FrameResources.FrameAllocator;
+
 	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
 
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
-	TileLightCuller->Initialize(RHIDevice, TileSize);
+	TileLightCuller->Initialize(RHIDevice, TileSize, World->GetRenderSettings().GetClusterDepthSlices());
 
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
@@ -76,6 +94,23 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 
 FSceneRenderer::~FSceneRenderer()
 {
+	// 아레나를 가리키는 배치(CustomData)가 남지 않도록 목록을 비운 뒤 아레나 리셋 (용량은 유지)
+	MeshBatchElements.Empty();
+	SkeletalMeshElements.Empty();
+	ShadowCasterCache.Empty();
+	ShadowCasterBatches.Empty();
+	FrameResources.ShadowViewBatches.Empty();
+	FrameResources.DynamicShadowViewBatches.Empty();
+
+	FFrameLinearAllocator& FrameAllocator = FrameResources.FrameAllocator;
+	FFrameAllocationStatManager& AllocStats = FFrameAllocationStatManager::GetInstance();
+	AllocStats.RecordArena(FrameAllocator.GetChunkAllocationCount() - StartArenaChunkAllocationCount,
+		FrameAllocator.GetUsedBytes(), FrameAllocator.GetCapacityBytes());
+	FrameAllocator.Reset();
+
+	// TileLightCuller 등 멤버 해제는 이 뒤에 일어나므로 해제만 하는 구간은 집계되지 않는다
+	AllocStats.AddRenderAllocations(CMemoryManager::GetGlobalHeapAllocationCount() - StartHeapAllocationCount,
+		CMemoryManager::GetAllocationEventCount() - StartObjectAllocationCount);
 }
 
 //====================================================================================
@@ -294,9 +329,8 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	// 절두체 컬링 수행 -> 파티션 BVH 쿼리 결과가 BVHVisibleMeshes에 저장됨
+	PerformFrustumCulling();
 
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
@@ -314,7 +348,8 @@ void FSceneRenderer::GatherVisibleProxies()
 	// Helper lambda to collect components from an actor
 	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
 		{
-			if (!Actor || !Actor->IsActorVisible())
+			// 풀에 반납된 액터는 반납한 프레임 동안 레벨 목록에 남아 있으므로 여기서 제외 (파티션에서는 이미 빠져 있다)
+			if (!Actor || !Actor->IsActorVisible() || Actor->IsPooled())
 			{
 				return;
 			}
@@ -375,6 +410,19 @@ void FSceneRenderer::GatherVisibleProxies()
 							bShouldAdd = false;
 						}
 
+						if (!bShouldAdd && !bShouldSkeletalAdd)
+						{
+							continue;
+						}
+
+						// 섀도우 캐스터는 카메라 컬링 이전에 수집
+						ShadowCasterMeshes.Add(MeshComponent);
+
+						if (!IsComponentInViewFrustum(MeshComponent))
+						{
+							continue;
+						}
+
 						if (bShouldAdd)
 						{
 							Proxies.Meshes.Add(MeshComponent);
@@ -382,15 +430,30 @@ void FSceneRenderer::GatherVisibleProxies()
 						else if (bShouldSkeletalAdd)
 						{
 							SkeletalProxies.Add(MeshComponent);
+
+							// 가시성/화면 크기를 애니메이션 매니저에 알려 다음 프레임 갱신 빈도를 정한다
+							if (FAnimationManager* AnimationManager = World->GetAnimationManager())
+							{
+								USkeletalMeshComponent* SkeletalMeshComponent = static_cast<USkeletalMeshComponent*>(MeshComponent);
+								const FAABB Bounds = SkeletalMeshComponent->GetWorldAABB();
+								const float ScreenSize = View->GetScreenSize(Bounds.GetCenter(), Bounds.GetHalfExtent().Size());
+								AnimationManager->NotifyRendered(SkeletalMeshComponent, ScreenSize);
+							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
 					{
-						Proxies.Billboards.Add(BillboardComponent);
+						if (IsComponentInViewFrustum(BillboardComponent))
+						{
+							Proxies.Billboards.Add(BillboardComponent);
+						}
 					}
 					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
 					{
-						Proxies.Decals.Add(DecalComponent);
+						if (IsComponentInViewFrustum(DecalComponent))
+						{
+							Proxies.Decals.Add(DecalComponent);
+						}
 					}
 				}
 				else
@@ -505,6 +568,13 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 
+	// 클러스터 깊이 슬라이스 (CullLights에서 직교 투영이면 0으로 내려감)
+	ID3D11ShaderResourceView* SliceMaskSRV = bTileCullingEnabled ? TileLightCuller->GetSliceMaskBufferSRV() : nullptr;
+	TileCullingBuffer.ClusterSliceCount = SliceMaskSRV ? TileLightCuller->GetDepthSliceCount() : 0;
+	TileCullingBuffer.ClusterLogScale = TileLightCuller->GetSliceLogScale();
+	TileCullingBuffer.ClusterLogBias = TileLightCuller->GetSliceLogBias();
+	TileCullingBuffer.TileCullingPadding = 0;
+
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
 	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만)
@@ -516,6 +586,9 @@ void FSceneRenderer::PerformTileLightCulling()
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &TileLightIndexSRV);
 		}
 	}
+
+	// 슬라이스 마스크는 t22 (2D 타일 모드면 언바인딩)
+	RHIDevice->GetDeviceContext()->PSSetShaderResources(22, 1, &SliceMaskSRV);
 }
 
 void FSceneRenderer::RenderShadowPass()
@@ -546,14 +619,22 @@ void FSceneRenderer::RenderShadowPass()
 	// Step 3: 섀도우 필터 타입 가져오기
 	EShadowFilterType FilterType = World->GetShadowManager()->GetShadowConfiguration().FilterType;
 
+	// Step 3-1: 캐스터 메시 배치를 프레임당 한 번 생성 (이후 라이트/면/캐스케이드별로 필터링)
+	{
+		FScopedBatchAllocationCounter BatchAllocationCounter;
+		BuildShadowCasterCache(ShadowShaderVariant, FilterType);
+	}
+
 	// Step 4: 렌더 상태 저장 (RAII 패턴)
 	FSavedRenderState SavedState;
 	SavedState.Save(RHIDevice);
 
 	// Step 5: 라이트 타입별 섀도우 렌더링
-	RenderDirectionalLightShadows(ShadowShaderVariant);
-	RenderSpotLightShadows(ShadowShaderVariant);
-	RenderPointLightShadows(ShadowShaderVariant);
+	RenderDirectionalLightShadows();
+	RenderSpotLightShadows();
+	RenderPointLightShadows();
+
+	FShadowStatManager::GetInstance().UpdateCasterCullingStats(ShadowCasterStats);
 
 	// Step 6: 렌더 상태 복구
 	SavedState.Restore(RHIDevice);
@@ -566,18 +647,229 @@ void FSceneRenderer::RenderShadowPass()
 // Shadow Pass Helper Functions
 //====================================================================================
 
-void FSceneRenderer::CollectShadowMeshBatches(TArray<FMeshBatchElement>& OutMeshBatches) const
+void FSceneRenderer::BuildShadowCasterCache(FShaderVariant* ShadowShaderVariant, EShadowFilterType FilterType)
 {
-	// 일반 메시 컴포넌트
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	ShadowCasterCache.Empty();
+	ShadowCasterBatches.Empty();
+	ShadowCasterStats = FShadowCasterCullingStats();
+
+	// 카메라 절두체 컬링 결과(Proxies)가 아닌 캐스터 목록 사용: 화면 밖 메시도 화면 안으로 그림자를 드리울 수 있음
+	// (스태틱 + 스켈레탈 메시 컴포넌트)
+	ShadowCasterCache.reserve(ShadowCasterMeshes.Num());
+	for (UMeshComponent* MeshComponent : ShadowCasterMeshes)
+	{
+		FShadowCasterEntry Entry;
+		Entry.FirstBatch = ShadowCasterBatches.Num();
+		MeshComponent->CollectMeshBatches(ShadowCasterBatches, View);
+		Entry.NumBatches = ShadowCasterBatches.Num() - Entry.FirstBatch;
+		if (Entry.NumBatches == 0)
+			continue;
+
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
+		{
+			Entry.Bounds = StaticMeshComponent->GetWorldAABB();
+			Entry.bHasBounds = true;
+			Entry.bStatic = true;
+		}
+		else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(MeshComponent))
+		{
+			Entry.Bounds = SkeletalMeshComponent->GetWorldAABB();
+			Entry.bHasBounds = true;
+			Entry.SkeletalComponent = SkeletalMeshComponent;
+		}
+
+		ShadowCasterCache.Add(Entry);
+	}
+
+	// 모든 섀도우 뷰가 같은 셰이더를 쓰므로 한 번만 오버라이드
+	OverrideShadowShader(ShadowCasterBatches, ShadowShaderVariant, FilterType);
+
+	ShadowCasterStats.TotalCasters = ShadowCasterCache.Num();
+	ShadowCasterStats.CachedBatches = ShadowCasterBatches.Num();
+}
+
+void FSceneRenderer::GatherShadowCastersForLight(const FBoundingSphere* LightBounds, TArray<int32>& OutCasterIndices) const
+{
+	OutCasterIndices.Empty();
+	OutCasterIndices.reserve(ShadowCasterCache.Num());
+	for (int32 CasterIndex = 0; CasterIndex < ShadowCasterCache.Num(); ++CasterIndex)
+	{
+		const FShadowCasterEntry& Entry = ShadowCasterCache[CasterIndex];
+		if (LightBounds && Entry.bHasBounds && !Collision::Intersects(Entry.Bounds, *LightBounds))
+			continue;
+
+		OutCasterIndices.Add(CasterIndex);
+	}
+}
+
+namespace
+{
+	// 정적 섀도우 캐시 서명용 FNV-1a
+	void HashShadowBytes(uint64& InOutHash, const void* Data, size_t Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			InOutHash = (InOutHash ^ Bytes[i]) * 1099511628211ull;
+		}
+	}
+
+	// 깊이에 영향을 주는 배치 입력 (변환, 지오메트리 구간)
+	void HashShadowBatch(uint64& InOutHash, const FMeshBatchElement& Batch)
+	{
+		HashShadowBytes(InOutHash, &Batch.WorldMatrix, sizeof(Batch.WorldMatrix));
+		HashShadowBytes(InOutHash, &Batch.VertexBuffer, sizeof(Batch.VertexBuffer));
+		HashShadowBytes(InOutHash, &Batch.IndexBuffer, sizeof(Batch.IndexBuffer));
+		HashShadowBytes(InOutHash, &Batch.IndexCount, sizeof(Batch.IndexCount));
+		HashShadowBytes(InOutHash, &Batch.StartIndex, sizeof(Batch.StartIndex));
+		HashShadowBytes(InOutHash, &Batch.BaseVertexIndex, sizeof(Batch.BaseVertexIndex));
+	}
+
+	// 섀도우 뷰 기준 화면 크기 (FSceneView::GetScreenSize와 같은 척도)
+	float GetShadowViewScreenSize(const FShadowRenderContext& ShadowContext, const FAABB& Bounds)
+	{
+		const FMatrix& Projection = ShadowContext.LightProjection;
+		const float Radius = Bounds.GetHalfExtent().Size();
+		const float ProjectionScale = std::max(Projection.M[0][0], Projection.M[1][1]);
+		if (Projection.M[3][3] != 0.0f)
+		{
+			// 직교 투영 (디렉셔널 라이트)
+			return Radius * ProjectionScale;
+		}
+
+		const FMatrix& LightView = ShadowContext.LightView;
+		const FVector Center = Bounds.GetCenter();
+		const float ViewDepth = Center.X * LightView.M[0][2] + Center.Y * LightView.M[1][2] + Center.Z * LightView.M[2][2] + LightView.M[3][2];
+		return Radius * ProjectionScale / std::max(ViewDepth, KINDA_SMALL_NUMBER);
+	}
+}
+
+void FSceneRenderer::CollectShadowMeshBatches(const FShadowRenderContext& ShadowContext, const TArray<int32>& CasterIndices, bool bTestNearPlane,
+	TArray<FMeshBatchElement>& OutMeshBatches, FShadowCasterLightStats& InOutLightStats,
+	TArray<FMeshBatchElement>* OutDynamicMeshBatches, uint64* OutStaticSignature)
+{
+	FScopedBatchAllocationCounter BatchAllocationCounter;
+
+	OutMeshBatches.Empty();
+	if (OutDynamicMeshBatches)
 	{
-		MeshComponent->CollectMeshBatches(OutMeshBatches, View);
+		OutDynamicMeshBatches->Empty();
 	}
 
-	// 스켈레탈 메시 컴포넌트
-	for (UMeshComponent* MeshComponent : SkeletalProxies)
+	const FFrustum ShadowFrustum = CreateFrustumFromViewProjection(ShadowContext.LightView * ShadowContext.LightProjection);
+	FAnimationManager* AnimationManager = World->GetAnimationManager();
+
+	uint32 CastersDrawn = 0;
+	for (int32 CasterIndex : CasterIndices)
 	{
-		MeshComponent->CollectMeshBatches(OutMeshBatches, View);
+		const FShadowCasterEntry& Entry = ShadowCasterCache[CasterIndex];
+		if (Entry.bHasBounds)
+		{
+			const FVector4 Center = FVector4::FromPoint(Entry.Bounds.GetCenter());
+			const FVector4 Extents = FVector4::FromDirection(Entry.Bounds.GetHalfExtent());
+			const bool bInFrustum =
+				Intersects(ShadowFrustum.LeftFace, Center, Extents) &&
+				Intersects(ShadowFrustum.RightFace, Center, Extents) &&
+				Intersects(ShadowFrustum.TopFace, Center, Extents) &&
+				Intersects(ShadowFrustum.BottomFace, Center, Extents) &&
+				Intersects(ShadowFrustum.FarFace, Center, Extents) &&
+				(!bTestNearPlane || Intersects(ShadowFrustum.NearFace, Center, Extents));
+			if (!bInFrustum)
+				continue;
+		}
+
+		// 카메라에 보이지 않는 스켈레탈 메시도 섀도우 뷰에 들어가면 그린 것으로 알려 포즈 갱신이 멈추지 않게 하고,
+		// 멈춰 있던 포즈는 그리기 전에 여기서 스키닝한다 (이미 스키닝된 프레임이면 아무 일도 하지 않음)
+		if (Entry.SkeletalComponent)
+		{
+			if (AnimationManager)
+			{
+				AnimationManager->NotifyRendered(Entry.SkeletalComponent, GetShadowViewScreenSize(ShadowContext, Entry.Bounds));
+			}
+			Entry.SkeletalComponent->EnsureSkinningReady(RHIDevice);
+		}
+
+		// 동적 목록을 받으면 정적 캐스터만 OutMeshBatches에 담고 서명에 반영
+		const bool bDynamic = OutDynamicMeshBatches && !Entry.bStatic;
+		TArray<FMeshBatchElement>& TargetBatches = bDynamic ? *OutDynamicMeshBatches : OutMeshBatches;
+		TargetBatches.insert(TargetBatches.end(),
+			ShadowCasterBatches.begin() + Entry.FirstBatch,
+			ShadowCasterBatches.begin() + Entry.FirstBatch + Entry.NumBatches);
+		++CastersDrawn;
+
+		if (!bDynamic && OutStaticSignature)
+		{
+			for (int32 BatchIndex = Entry.FirstBatch; BatchIndex < Entry.FirstBatch + Entry.NumBatches; ++BatchIndex)
+			{
+				HashShadowBatch(*OutStaticSignature, ShadowCasterBatches[BatchIndex]);
+			}
+		}
+	}
+
+	// 컬링 수는 캐시 전체 기준 (라이트 볼륨에서 빠진 캐스터 포함)
+	const uint32 CastersCulled = ShadowCasterStats.TotalCasters - CastersDrawn;
+	++InOutLightStats.ShadowViews;
+	InOutLightStats.CastersDrawn += CastersDrawn;
+	InOutLightStats.CastersCulled += CastersCulled;
+
+	ShadowCasterStats.CastersDrawn += CastersDrawn;
+	ShadowCasterStats.CastersCulled += CastersCulled;
+	ShadowCasterStats.DrawnBatches += OutMeshBatches.Num() + (OutDynamicMeshBatches ? OutDynamicMeshBatches->Num() : 0);
+}
+
+void FSceneRenderer::RenderCachedShadowView(FShadowMap& ShadowMap, uint32 ArrayIndex, const void* Light, const FBoundingSphere& LightBounds,
+	const FShadowRenderContext& ShadowContext, const TArray<int32>& CasterIndices, FShadowCasterLightStats& InOutLightStats)
+{
+	// 서명: 라이트 입력(VP, 바이어스, 필터 계수) + 절두체를 통과한 정적 캐스터의 배치
+	const FShadowConfiguration& ShadowConfig = World->GetShadowManager()->GetShadowConfiguration();
+	uint64 StaticSignature = 14695981039346656037ull;
+	HashShadowBytes(StaticSignature, &ShadowContext.LightView, sizeof(FMatrix));
+	HashShadowBytes(StaticSignature, &ShadowContext.LightProjection, sizeof(FMatrix));
+	HashShadowBytes(StaticSignature, &ShadowContext.ShadowBias, sizeof(float));
+	HashShadowBytes(StaticSignature, &ShadowContext.ShadowSlopeBias, sizeof(float));
+	HashShadowBytes(StaticSignature, &ShadowConfig.ESMExponent, sizeof(float));
+	HashShadowBytes(StaticSignature, &ShadowConfig.EVSMPositiveExponent, sizeof(float));
+	HashShadowBytes(StaticSignature, &ShadowConfig.EVSMNegativeExponent, sizeof(float));
+
+	TArray<FMeshBatchElement>& StaticMeshBatches = FrameResources.ShadowViewBatches;
+	TArray<FMeshBatchElement>& DynamicMeshBatches = FrameResources.DynamicShadowViewBatches;
+	CollectShadowMeshBatches(ShadowContext, CasterIndices, true, StaticMeshBatches, InOutLightStats, &DynamicMeshBatches, &StaticSignature);
+
+	UpdateViewProjBufferForShadow(ShadowContext, false);
+
+	// 1. 정적 사본: 라이트나 정적 캐스터가 바뀌었거나 MarkShadowCasterDirty로 무효화된 경우만 다시 그림
+	if (!ShadowMap.IsStaticSliceValid(ArrayIndex, Light, StaticSignature))
+	{
+		ShadowMap.BeginRenderStatic(RHIDevice, ArrayIndex, ShadowContext.ShadowBias, ShadowContext.ShadowSlopeBias);
+		DrawMeshBatches(StaticMeshBatches, true, true);
+		ShadowMap.EndRender(RHIDevice);
+		ShadowMap.MarkStaticSliceRendered(ArrayIndex, Light, StaticSignature, LightBounds.Center, LightBounds.Radius);
+		++ShadowCasterStats.ShadowViewsRendered;
+	}
+	else
+	{
+		++ShadowCasterStats.ShadowViewsCached;
+	}
+
+	// 2. 실제 슬라이스 = 정적 사본 (+ 동적 캐스터)
+	if (DynamicMeshBatches.IsEmpty())
+	{
+		ShadowMap.RestoreStaticSlice(RHIDevice, ArrayIndex);
+	}
+	else if (ShadowMap.SupportsDynamicLayer())
+	{
+		ShadowMap.BeginRenderDynamicLayer(RHIDevice, ArrayIndex, ShadowContext.ShadowBias, ShadowContext.ShadowSlopeBias);
+		DrawMeshBatches(DynamicMeshBatches, true, true);
+		ShadowMap.EndRender(RHIDevice);
+		++ShadowCasterStats.DynamicLayerViews;
+	}
+	else
+	{
+		// VSM/ESM/EVSM은 깊이 테스트 없이 모멘트를 쓰므로 사본 위에 합성할 수 없음: 정적 + 동적을 함께 다시 그림
+		StaticMeshBatches.insert(StaticMeshBatches.end(), DynamicMeshBatches.begin(), DynamicMeshBatches.end());
+		ShadowMap.BeginRender(RHIDevice, ArrayIndex, ShadowContext.ShadowBias, ShadowContext.ShadowSlopeBias);
+		DrawMeshBatches(StaticMeshBatches, true, true);
+		ShadowMap.EndRender(RHIDevice);
 	}
 }
 
@@ -618,10 +910,9 @@ void FSceneRenderer::UpdateViewProjBufferForShadow(const FShadowRenderContext& S
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBuffer);
 }
 
-void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderDirectionalLightShadows()
 {
 	FShadowManager* ShadowManager = World->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
 	for (UDirectionalLightComponent* DirLight : SceneGlobals.DirectionalLights)
 	{
@@ -629,6 +920,14 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 		if (!IsLightValidForShadowCasting(DirLight))
 			continue;
 
+		// DirectionalLight는 볼륨이 없으므로 모든 캐스터가 후보
+		TArray<int32>& CasterIndices = FrameResources.ShadowCasterIndices;
+		GatherShadowCastersForLight(nullptr, CasterIndices);
+
+		FShadowCasterLightStats LightStats;
+		LightStats.LightType = "Dir";
+		LightStats.CastersInVolume = CasterIndices.Num();
+
 		// CSM이 활성화되어 있으면 Cascaded Shadow Maps 렌더링
 		if (DirLight->GetShadowMapType() == EShadowMapType::CSM)
 		{
@@ -662,12 +961,9 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 				// ViewProj 버퍼 업데이트 (Orthographic)
 				UpdateViewProjBufferForShadow(ShadowContext, true);
 
-				// 메시 수집
-				TArray<FMeshBatchElement> ShadowMeshBatches;
-				CollectShadowMeshBatches(ShadowMeshBatches);
-
-				// 셰이더 오버라이드
-				OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
+				// 캐스케이드 절두체로 캐시된 배치 필터링
+				TArray<FMeshBatchElement>& ShadowMeshBatches = FrameResources.ShadowViewBatches;
+				CollectShadowMeshBatches(ShadowContext, CasterIndices, false, ShadowMeshBatches, LightStats);
 
 				// 그리기
 				DrawMeshBatches(ShadowMeshBatches, true, true);
@@ -690,12 +986,9 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 			// ViewProj 버퍼 업데이트 (Orthographic)
 			UpdateViewProjBufferForShadow(ShadowContext, true);
 
-			// 메시 수집
-			TArray<FMeshBatchElement> ShadowMeshBatches;
-			CollectShadowMeshBatches(ShadowMeshBatches);
-
-			// 셰이더 오버라이드
-			OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
+			// 섀도우 절두체로 캐시된 배치 필터링
+			TArray<FMeshBatchElement>& ShadowMeshBatches = FrameResources.ShadowViewBatches;
+			CollectShadowMeshBatches(ShadowContext, CasterIndices, false, ShadowMeshBatches, LightStats);
 
 			// 그리기
 			DrawMeshBatches(ShadowMeshBatches, true, true);
@@ -703,13 +996,14 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 			// 섀도우 맵 렌더 종료
 			ShadowManager->EndShadowRender(RHIDevice);
 		}
+
+		ShadowCasterStats.Lights.Add(LightStats);
 	}
 }
 
-void FSceneRenderer::RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderSpotLightShadows()
 {
 	FShadowManager* ShadowManager = World->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
 	for (USpotLightComponent* SpotLight : SceneLocals.SpotLights)
 	{
@@ -717,6 +1011,27 @@ void FSceneRenderer::RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant)
 		if (!IsLightValidForShadowCasting(SpotLight))
 			continue;
 
+		// 감쇠 구 → 스포트 절두체 순으로 캐스터 컬링
+		const FBoundingSphere LightBounds(SpotLight->GetWorldLocation(), SpotLight->GetAttenuationRadius());
+		TArray<int32>& CasterIndices = FrameResources.ShadowCasterIndices;
+		GatherShadowCastersForLight(&LightBounds, CasterIndices);
+
+		FShadowCasterLightStats LightStats;
+		LightStats.LightType = "Spot";
+		LightStats.CastersInVolume = CasterIndices.Num();
+
+		FShadowMap& SpotShadowMap = ShadowManager->GetSpotLightShadowMap();
+		if (SpotShadowMap.IsStaticCacheEnabled())
+		{
+			FShadowRenderContext ShadowContext;
+			if (!ShadowManager->GetShadowRenderContext(SpotLight, ShadowContext))
+				continue;
+
+			RenderCachedShadowView(SpotShadowMap, ShadowContext.ShadowMapIndex, SpotLight, LightBounds, ShadowContext, CasterIndices, LightStats);
+			ShadowCasterStats.Lights.Add(LightStats);
+			continue;
+		}
+
 		// ShadowManager에게 섀도우 맵 렌더 시작 요청
 		FShadowRenderContext ShadowContext;
 		if (!ShadowManager->BeginShadowRender(RHIDevice, SpotLight, ShadowContext))
@@ -725,25 +1040,22 @@ void FSceneRenderer::RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant)
 		// ViewProj 버퍼 업데이트 (Perspective)
 		UpdateViewProjBufferForShadow(ShadowContext, false);
 
-		// 메시 수집
-		TArray<FMeshBatchElement> ShadowMeshBatches;
-		CollectShadowMeshBatches(ShadowMeshBatches);
-
-		// 셰이더 오버라이드
-		OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
+		TArray<FMeshBatchElement>& ShadowMeshBatches = FrameResources.ShadowViewBatches;
+		CollectShadowMeshBatches(ShadowContext, CasterIndices, true, ShadowMeshBatches, LightStats);
 
 		// 그리기
 		DrawMeshBatches(ShadowMeshBatches, true, true);
 
 		// 섀도우 맵 렌더 종료
 		World->GetShadowManager()->EndShadowRender(RHIDevice);
+
+		ShadowCasterStats.Lights.Add(LightStats);
 	}
 }
 
-void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderPointLightShadows()
 {
 	FShadowManager* ShadowManager = World->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
 	for (UPointLightComponent* PointLight : SceneLocals.PointLights)
 	{
@@ -761,9 +1073,32 @@ void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant
 			PointLight->GetAttenuationRadius(),
 			0.01f); // Near plane
 
+		// 감쇠 구 밖의 캐스터는 6개 면 모두에서 제외
+		const FBoundingSphere LightBounds(PointLight->GetWorldLocation(), PointLight->GetAttenuationRadius());
+		TArray<int32>& CasterIndices = FrameResources.ShadowCasterIndices;
+		GatherShadowCastersForLight(&LightBounds, CasterIndices);
+
+		FShadowCasterLightStats LightStats;
+		LightStats.LightType = "Point";
+		LightStats.CastersInVolume = CasterIndices.Num();
+
+		FShadowMap& CubeShadowMap = ShadowManager->GetPointLightCubeShadowMap();
+		const bool bUseStaticCache = CubeShadowMap.IsStaticCacheEnabled();
+
 		// 6개 면 렌더링 (+X, -X, +Y, -Y, +Z, -Z)
 		for (uint32 CubeFaceIdx = 0; CubeFaceIdx < 6; CubeFaceIdx++)
 		{
+			if (bUseStaticCache)
+			{
+				FShadowRenderContext ShadowContext;
+				if (!ShadowManager->GetShadowRenderContextCube(PointLight, CubeFaceIdx, CubeShadowVPs[CubeFaceIdx], ShadowContext))
+					continue;
+
+				const uint32 ArrayIndex = ShadowContext.ShadowMapIndex * 6 + CubeFaceIdx;
+				RenderCachedShadowView(CubeShadowMap, ArrayIndex, PointLight, LightBounds, ShadowContext, CasterIndices, LightStats);
+				continue;
+			}
+
 			// ShadowManager에게 섀도우 맵 렌더 시작 요청
 			FShadowRenderContext ShadowContext;
 			if (!ShadowManager->BeginShadowRenderCube(RHIDevice, PointLight, CubeFaceIdx, CubeShadowVPs[CubeFaceIdx], ShadowContext))
@@ -772,12 +1107,9 @@ void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant
 			// ViewProj 버퍼 업데이트 (Perspective)
 			UpdateViewProjBufferForShadow(ShadowContext, false);
 
-			// 메시 수집
-			TArray<FMeshBatchElement> ShadowMeshBatches;
-			CollectShadowMeshBatches(ShadowMeshBatches);
-
-			// 셰이더 오버라이드
-			OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
+			// 면 절두체로 캐시된 배치 필터링
+			TArray<FMeshBatchElement>& ShadowMeshBatches = FrameResources.ShadowViewBatches;
+			CollectShadowMeshBatches(ShadowContext, CasterIndices, true, ShadowMeshBatches, LightStats);
 
 			// 그리기
 			DrawMeshBatches(ShadowMeshBatches, true, true);
@@ -785,6 +1117,8 @@ void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant
 			// 섀도우 맵 렌더 종료
 			World->GetShadowManager()->EndShadowRender(RHIDevice);
 		}
+
+		ShadowCasterStats.Lights.Add(LightStats);
 	}
 }
 
@@ -845,22 +1179,82 @@ void FSceneRenderer::FSavedRenderState::Release()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	BVHVisibleMeshes.Empty();
+
+	// CreateFrustumFromCamera는 원근 투영 기준이므로 직교 뷰(에디터 Top/Side 등)는 컬링하지 않음
+	bFrustumCullingEnabled = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Culling)
+		&& View->ProjectionMode == ECameraProjectionMode::Perspective;
+	if (!bFrustumCullingEnabled)
+		return;
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	if (!Partition)
+		return;
+
+	auto CpuTimeStart = std::chrono::high_resolution_clock::now();
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	TArray<UStaticMeshComponent*> VisibleStaticMeshes;
+	Partition->FrustumQuery(View->ViewFrustum, VisibleStaticMeshes);
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	BVHVisibleMeshes.reserve(VisibleStaticMeshes.size());
+	for (UStaticMeshComponent* StaticMeshComponent : VisibleStaticMeshes)
+	{
+		BVHVisibleMeshes.Add(StaticMeshComponent);
+	}
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	FFrustumCullingStatManager& CullingStats = FFrustumCullingStatManager::GetInstance();
+	CullingStats.GetBVHQueryTimeSlot() += CpuTimeMs.count();
+	CullingStats.AddBVHVisibleCount(static_cast<uint32_t>(BVHVisibleMeshes.Num()));
+}
+
+bool FSceneRenderer::IsComponentInViewFrustum(UPrimitiveComponent* Component)
+{
+	if (!bFrustumCullingEnabled || !Component)
+		return true;
+
+	bool bVisible = true;
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+	{
+		// BVH 바운드가 최신인 경우에만 쿼리 결과를 신뢰하고, 갱신 대기 중이면 직접 검사
+		UWorldPartitionManager* Partition = World->GetPartitionManager();
+		if (Partition && Partition->IsTrackedAndClean(StaticMeshComponent))
+		{
+			bVisible = BVHVisibleMeshes.Contains(StaticMeshComponent);
+		}
+		else
+		{
+			bVisible = IsAABBVisible(View->ViewFrustum, StaticMeshComponent->GetWorldAABB());
+		}
+	}
+	// 아래 타입들은 파티션 BVH가 추적하지 않으므로 개별 AABB 검사
+	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(Component))
+	{
+		bVisible = IsAABBVisible(View->ViewFrustum, SkeletalMeshComponent->GetWorldAABB());
+	}
+	else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(Component))
+	{
+		bVisible = IsAABBVisible(View->ViewFrustum, DecalComponent->GetWorldAABB());
+	}
+	else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(Component))
+	{
+		bVisible = IsAABBVisible(View->ViewFrustum, BillboardComponent->GetWorldAABB());
+	}
+	else
+	{
+		// 바운드를 알 수 없는 타입은 컬링 대상이 아님
+		return true;
+	}
+
+	FFrustumCullingStatManager& CullingStats = FFrustumCullingStatManager::GetInstance();
+	CullingStats.AddTestedComponentCount(1);
+	if (!bVisible)
+	{
+		CullingStats.AddCulledComponentCount(1);
+	}
+	return bVisible;
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
@@ -907,6 +1301,9 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 		}
 	}
 
+	// 수집 ~ 정렬 구간의 힙 할당 집계 (배열 용량과 아레나가 자리 잡은 뒤에는 0이어야 함, 그리기는 DrawMeshBatches에서 집계)
+	FScopedBatchAllocationCounter BatchAllocationCounter;
+
 	// --- 1. 수집 (Collect) ---
 	MeshBatchElements.Empty();
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
@@ -959,12 +1356,15 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
-	SkeletalMeshElements.Sort();
+	// 배치는 제자리에 두고 64비트 상태 키 + 기수 정렬로 그리기 순서만 만든다
+	MeshBatchSorter.Sort(MeshBatchElements, EMeshBatchSortMode::Opaque, View->ViewMatrix, MeshBatchDrawOrder);
+	MeshBatchSorter.Sort(SkeletalMeshElements, EMeshBatchSortMode::Opaque, View->ViewMatrix, SkeletalMeshDrawOrder);
+
+	BatchAllocationCounter.Stop();
 
 	// --- 3. 그리기 (Draw) ---
-	DrawMeshBatches(MeshBatchElements, true);
-	DrawMeshBatches(SkeletalMeshElements, true);
+	DrawMeshBatches(MeshBatchElements, true, false, &MeshBatchDrawOrder);
+	DrawMeshBatches(SkeletalMeshElements, true, false, &SkeletalMeshDrawOrder);
 }
 
 void FSceneRenderer::RenderDecalPass()
@@ -1651,10 +2051,12 @@ void FSceneRenderer::RenderOverayEditorPrimitivesPass()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bIsShadowPass)
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bIsShadowPass, const TArray<uint32>* InDrawOrder)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
+	FScopedBatchAllocationCounter BatchAllocationCounter;
+
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
 	// Shadow Pass일 경우 FShadowMap::BeginRender()에서 이미 설정했으므로 덮어쓰지 않음
 	if (!bIsShadowPass)
@@ -1683,9 +2085,11 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	// 기본 샘플러 미리 가져오기 (루프 내 반복 호출 방지)
 	ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
-	{		
+	// 정렬된 리스트 순회 (그리기 순서가 주어지면 그 순서대로)
+	for (int32 BatchIndex = 0; BatchIndex < InMeshBatches.Num(); ++BatchIndex)
+	{
+		const FMeshBatchElement& Batch = InDrawOrder ? InMeshBatches[(*InDrawOrder)[BatchIndex]] : InMeshBatches[BatchIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		// Shadow Pass에서는 Pixel Shader가 없을 수 있음 (depth-only rendering)
 		bool bRequiresPixelShader = !bIsShadowPass;
@@ -1809,7 +2213,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		ColorBufferType ColorBuffer;
 		ColorBuffer.Color = Batch.InstanceColor;
 		ColorBuffer.UUID = Batch.ObjectID;
-		if (Batch.CustomData.size() >= 3)
+		if (Batch.CustomDataCount >= 3)
 		{
 			ColorBuffer.SpriteRows = Batch.CustomData[0];
 			ColorBuffer.SpriteColumns = Batch.CustomData[1];
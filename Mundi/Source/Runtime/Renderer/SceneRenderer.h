@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
 #include "ShadowConfiguration.h"
+#include "ShadowStats.h"
+#include "SceneRenderFrameResources.h"
 
 // 전방 선언 (헤더 파일 의존성 최소화)
 class UWorld;
@@ -24,7 +27,10 @@ class FSceneView;
 class FTileLightCuller;
 class ULineComponent;
 struct FShadowRenderContext;
+class FShadowMap;
 class USkeletalMeshComponent;
+class UStaticMeshComponent;
+struct FBoundingSphere;
 
 struct FCandidateDrawable;
 
@@ -85,9 +91,15 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 파티션 BVH로 뷰 절두체 쿼리를 수행해 가시 스태틱 메시 집합을 만듭니다. */
 	void PerformFrustumCulling();
 
+	/**
+	 * @brief 컴포넌트가 현재 뷰 절두체 안에 있는지 판정하고 컬링 통계를 누적합니다.
+	 * BVH가 추적하는 스태틱 메시는 PerformFrustumCulling 결과를, 그 외(스켈레탈/데칼/빌보드)는 개별 AABB를 검사합니다.
+	 */
+	bool IsComponentInViewFrustum(UPrimitiveComponent* Component);
+
 
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
@@ -104,7 +116,9 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewModeIndex InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bIsShadowPass = false);
+	/** @param InDrawOrder InMeshBatches 인덱스로 된 그리기 순서 (nullptr이면 배열 순서) */
+	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bIsShadowPass = false,
+		const TArray<uint32>* InDrawOrder = nullptr);
 
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
@@ -149,8 +163,29 @@ private:
 			   Light->GetIsCastShadows();
 	}
 
-	/** @brief 섀도우 패스용 메시 배치를 수집합니다. */
-	void CollectShadowMeshBatches(TArray<FMeshBatchElement>& OutMeshBatches) const;
+	/**
+	 * @brief 섀도우 캐스터의 메시 배치를 프레임당 한 번 생성해 캐시합니다. (카메라 절두체 밖 캐스터 포함)
+	 * 셰이더 오버라이드도 여기서 한 번만 적용하며, 각 섀도우 뷰는 이 캐시를 필터링해서 사용합니다.
+	 */
+	void BuildShadowCasterCache(FShaderVariant* ShadowShaderVariant, EShadowFilterType FilterType);
+
+	/** @brief 라이트 볼륨(감쇠 구)과 겹치는 캐스터의 캐시 인덱스를 수집합니다. LightBounds가 nullptr이면 전체 (DirectionalLight) */
+	void GatherShadowCastersForLight(const FBoundingSphere* LightBounds, TArray<int32>& OutCasterIndices) const;
+
+	/**
+	 * @brief 섀도우 뷰(큐브 면/캐스케이드) 절두체를 통과한 캐스터의 캐시된 배치를 수집합니다. (출력 배열은 비운 뒤 채움)
+	 * @param bTestNearPlane false면 근평면은 검사하지 않음 (직교 섀도우: 라이트 쪽 뒤의 캐스터도 그림자를 드리움)
+	 */
+	void CollectShadowMeshBatches(const FShadowRenderContext& ShadowContext, const TArray<int32>& CasterIndices, bool bTestNearPlane,
+		TArray<FMeshBatchElement>& OutMeshBatches, FShadowCasterLightStats& InOutLightStats,
+		TArray<FMeshBatchElement>* OutDynamicMeshBatches = nullptr, uint64* OutStaticSignature = nullptr);
+
+	/**
+	 * @brief 정적 섀도우 캐시를 사용하는 섀도우 뷰(스팟/큐브 면) 하나를 렌더링합니다.
+	 * 라이트와 정적 캐스터의 서명이 사본과 같으면 다시 그리지 않고 복사하며, 동적 캐스터는 그 위에 합성합니다.
+	 */
+	void RenderCachedShadowView(FShadowMap& ShadowMap, uint32 ArrayIndex, const void* Light, const FBoundingSphere& LightBounds,
+		const FShadowRenderContext& ShadowContext, const TArray<int32>& CasterIndices, FShadowCasterLightStats& InOutLightStats);
 
 	/** @brief 메시 배치의 셰이더를 섀도우 뎁스 셰이더로 오버라이드합니다.
 	 *  @param MeshBatches 오버라이드할 메시 배치
@@ -163,13 +198,13 @@ private:
 	void UpdateViewProjBufferForShadow(const FShadowRenderContext& ShadowContext, bool bIsOrthographic);
 
 	/** @brief DirectionalLight의 섀도우를 렌더링합니다. */
-	void RenderDirectionalLightShadows(FShaderVariant* ShadowShaderVariant);
+	void RenderDirectionalLightShadows();
 
 	/** @brief SpotLight의 섀도우를 렌더링합니다. */
-	void RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant);
+	void RenderSpotLightShadows();
 
 	/** @brief PointLight의 섀도우를 렌더링합니다 (Cube Map). */
-	void RenderPointLightShadows(FShaderVariant* ShadowShaderVariant);
+	void RenderPointLightShadows();
 
 	/** @brief 카메라의 ViewProj 상수 버퍼를 복구합니다. */
 	void RestoreCameraViewProj();
@@ -207,13 +242,35 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	// 파티션 BVH 절두체 쿼리 결과
+	TSet<UStaticMeshComponent*> BVHVisibleMeshes;
+	bool bFrustumCullingEnabled = false;
+
+	// 섀도우 캐스터는 카메라 절두체 밖에 있어도 그림자를 드리우므로 컬링 전 목록을 따로 유지
+	TArray<UMeshComponent*> ShadowCasterMeshes;
+
+	// 배치 목록과 프레임 아레나는 URenderer 소유 (프레임 간 용량 재사용). 아래 참조는 그 멤버의 별칭
+	FSceneRenderFrameResources& FrameResources;
+
+	// 프레임당 한 번 생성한 섀도우 메시 배치 (셰이더 오버라이드 적용 완료)
+	TArray<FShadowCasterEntry>& ShadowCasterCache;
+	TArray<FMeshBatchElement>& ShadowCasterBatches;
+	FShadowCasterCullingStats ShadowCasterStats;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
+	TArray<FMeshBatchElement>& MeshBatchElements;
+
+	TArray<FMeshBatchElement>& SkeletalMeshElements;
+
+	// 불투명 패스 정렬 키 / 그리기 순서 (배치 원본은 수집 순서 그대로)
+	FMeshBatchSorter& MeshBatchSorter;
+	TArray<uint32>& MeshBatchDrawOrder;
+	TArray<uint32>& SkeletalMeshDrawOrder;
 
-	TArray<FMeshBatchElement> SkeletalMeshElements;
+	// 생성 시점의 누적 힙/UObject 할당 횟수 (소멸 시 차이를 통계에 기록)
+	uint64 StartHeapAllocationCount = 0;
+	uint64 StartObjectAllocationCount = 0;
+	uint32 StartArenaChunkAllocationCount = 0;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
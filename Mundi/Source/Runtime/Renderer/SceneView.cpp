@@ -39,4 +39,17 @@ FSceneView::FSceneView(ACameraActor* InCamera, FViewport* InViewport, EViewModeI
     // ViewMode는 World나 RenderSettings에서 가져와야 함 (임시)
     ViewMode = InViewMode;
     ProjectionMode = InCamera->GetCameraComponent()->GetProjectionMode();
-}
\ No newline at end of file
+}
+
+float FSceneView::GetScreenSize(const FVector& Center, float Radius) const
+{
+    // 투영 행렬의 X/Y 스케일: 원근은 1/tan(FOV/2), 직교는 2/폭(높이)
+    const float ProjectionScale = std::max(ProjectionMatrix.M[0][0], ProjectionMatrix.M[1][1]);
+    if (ProjectionMode == ECameraProjectionMode::Orthographic)
+    {
+        return Radius * ProjectionScale;
+    }
+
+    const float Distance = std::max(FVector::Distance(Center, ViewLocation), std::max(ZNear, KINDA_SMALL_NUMBER));
+    return Radius * ProjectionScale / Distance;
+}
@@ -8,6 +8,7 @@
 class ACameraActor;
 class UCameraComponent;
 class FViewport;
+class FFrameLinearAllocator;
 
 /**
  * @struct FViewportRect
@@ -34,6 +35,9 @@ public:
     // TODO: 섀도우 맵(광원) 등을 위한 생성자 추가
     // FSceneView(ALightActor* InLight, FTexture* RenderTarget);
 
+    // 바운딩 구의 지름이 뷰포트에서 차지하는 비율 (1 = 화면 가득). 카메라가 구 안에 있으면 큰 값을 반환
+    float GetScreenSize(const FVector& Center, float Radius) const;
+
     // 렌더링 데이터
     FMatrix ViewMatrix{};
     FMatrix ProjectionMatrix{};
@@ -55,4 +59,7 @@ public:
     ID3D11DepthStencilView* TargetDSV = nullptr;
     uint32 TargetWidth = 0;
     uint32 TargetHeight = 0;
+
+    // 이 뷰를 렌더링하는 동안 유효한 선형 할당기 (FSceneRenderer가 연결, 뷰 렌더 종료 시 Reset)
+    FFrameLinearAllocator* FrameAllocator = nullptr;
 };
\ No newline at end of file
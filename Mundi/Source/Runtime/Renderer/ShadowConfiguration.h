@@ -90,6 +90,9 @@ struct FShadowConfiguration
 	float EVSMNegativeExponent = 40.0f;       // Negative exponent
 	float EVSMLightBleedingReduction = 0.3f;  // Light bleeding 감소
 
+	// 정적 섀도우 캐시 (SpotLight/PointLight 전용, 해당 섀도우 맵 메모리 2배)
+	bool bEnableStaticShadowCache = false;
+
 	// 품질 프리셋으로부터 설정 로드
 	static FShadowConfiguration FromQuality(EShadowQuality InQuality);
 
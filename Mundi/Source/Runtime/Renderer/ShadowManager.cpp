@@ -41,6 +41,13 @@ void FShadowManager::Initialize(D3D11RHI* RHI, const FShadowConfiguration& InCon
 
 	PointLightCubeShadowMap.Initialize(RHI, Config.PointLightResolution, Config.PointLightResolution, Config.MaxPointLights, true, Config.FilterType);
 
+	// 정적 섀도우 캐시 (카메라에 따라 달라지는 DirectionalLight는 제외)
+	if (Config.bEnableStaticShadowCache)
+	{
+		SpotLightShadowMap.SetStaticCacheEnabled(RHI, true);
+		PointLightCubeShadowMap.SetStaticCacheEnabled(RHI, true);
+	}
+
 	// CSM Cascade Allocation 초기화
 	uint32 MaxGlobalCascades = Config.MaxDirectionalLights * MaxCascadesPerLight;
 	CascadeAllocations.SetNum(MaxGlobalCascades);
@@ -142,6 +149,31 @@ void FShadowManager::SetFilterType(EShadowFilterType NewFilterType)
 	Initialize(RHIDevice, Config);
 }
 
+void FShadowManager::SetStaticShadowCacheEnabled(bool bEnabled)
+{
+	Config.bEnableStaticShadowCache = bEnabled;
+
+	// 초기화되지 않았으면 설정만 변경 (Initialize에서 생성)
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	SpotLightShadowMap.SetStaticCacheEnabled(RHIDevice, bEnabled);
+	PointLightCubeShadowMap.SetStaticCacheEnabled(RHIDevice, bEnabled);
+}
+
+void FShadowManager::MarkShadowCasterDirty(const FAABB& DirtyBounds)
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	SpotLightShadowMap.InvalidateStaticSlices(DirtyBounds);
+	PointLightCubeShadowMap.InvalidateStaticSlices(DirtyBounds);
+}
+
 void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingLights& InLights)
 {
 	// Lazy initialization: 최초 호출 시 ShadowMap 초기화
@@ -357,6 +389,19 @@ void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingL
 }
 
 bool FShadowManager::BeginShadowRender(D3D11RHI* RHI, USpotLightComponent* Light, FShadowRenderContext& OutContext)
+{
+	if (!GetShadowRenderContext(Light, OutContext))
+	{
+		return false;
+	}
+
+	// Shadow Map 렌더링 시작 (DSV 바인딩, Viewport 설정)
+	SpotLightShadowMap.BeginRender(RHI, OutContext.ShadowMapIndex, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
+
+	return true;
+}
+
+bool FShadowManager::GetShadowRenderContext(USpotLightComponent* Light, FShadowRenderContext& OutContext) const
 {
 	// 이 라이트가 Shadow Map을 할당받았는지 확인
 	int32 Index = Light->GetShadowMapIndex();
@@ -379,9 +424,6 @@ bool FShadowManager::BeginShadowRender(D3D11RHI* RHI, USpotLightComponent* Light
 	OutContext.ShadowBias = Light->GetShadowBias();
 	OutContext.ShadowSlopeBias = Light->GetShadowSlopeBias();
 
-	// Shadow Map 렌더링 시작 (DSV 바인딩, Viewport 설정)
-	SpotLightShadowMap.BeginRender(RHI, Index, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
-
 	return true;
 }
 
@@ -574,6 +616,21 @@ TArray<float> FShadowManager::CalculateCSMSplits(float CameraNear, float CameraF
 }
 
 bool FShadowManager::BeginShadowRenderCube(D3D11RHI* RHI, UPointLightComponent* Light, uint32 CubeFaceIndex, const FShadowViewProjection& ShadowVP, FShadowRenderContext& OutContext)
+{
+	if (!GetShadowRenderContextCube(Light, CubeFaceIndex, ShadowVP, OutContext))
+	{
+		return false;
+	}
+
+	// Cube Shadow Map 렌더링 시작
+	// ArrayIndex = (LightIndex * 6) + CubeFaceIndex
+	uint32 ArrayIndex = (OutContext.ShadowMapIndex * 6) + CubeFaceIndex;
+	PointLightCubeShadowMap.BeginRender(RHI, ArrayIndex, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
+
+	return true;
+}
+
+bool FShadowManager::GetShadowRenderContextCube(UPointLightComponent* Light, uint32 CubeFaceIndex, const FShadowViewProjection& ShadowVP, FShadowRenderContext& OutContext) const
 {
 	// 이 라이트가 Shadow Map을 할당받았는지 확인
 	int32 Index = Light->GetShadowMapIndex();
@@ -596,11 +653,6 @@ bool FShadowManager::BeginShadowRenderCube(D3D11RHI* RHI, UPointLightComponent*
 	OutContext.ShadowBias = Light->GetShadowBias();
 	OutContext.ShadowSlopeBias = Light->GetShadowSlopeBias();
 
-	// Cube Shadow Map 렌더링 시작
-	// ArrayIndex = (LightIndex * 6) + CubeFaceIndex
-	uint32 ArrayIndex = (Index * 6) + CubeFaceIndex;
-	PointLightCubeShadowMap.BeginRender(RHI, ArrayIndex, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
-
 	return true;
 }
 
@@ -11,6 +11,7 @@ class USpotLightComponent;
 class UPointLightComponent;
 class UDirectionalLightComponent;
 struct FMatrix;
+struct FAABB;
 
 /**
  * @brief 쉐도우 캐스팅이 가능한 라이트들을 타입별로 그룹화한 구조체
@@ -80,6 +81,9 @@ public:
 	// @return 성공 여부
 	bool BeginShadowRender(D3D11RHI* RHI, USpotLightComponent* Light, FShadowRenderContext& OutContext);
 
+	// SpotLight 렌더링 컨텍스트만 계산 (렌더 타겟 바인딩 없음, 정적 섀도우 캐시 경로용)
+	bool GetShadowRenderContext(USpotLightComponent* Light, FShadowRenderContext& OutContext) const;
+
 	// Shadow 렌더링 시작 - DirectionalLight
 	// @param Light - 렌더링할 DirectionalLight
 	// @param CameraView - 카메라의 View 행렬
@@ -108,6 +112,9 @@ public:
 	// @return 성공 여부
 	bool BeginShadowRenderCube(D3D11RHI* RHI, UPointLightComponent* Light, uint32 CubeFaceIndex, const FShadowViewProjection& ShadowVP, FShadowRenderContext& OutContext);
 
+	// PointLight 큐브 면 렌더링 컨텍스트만 계산 (렌더 타겟 바인딩 없음, 정적 섀도우 캐시 경로용)
+	bool GetShadowRenderContextCube(UPointLightComponent* Light, uint32 CubeFaceIndex, const FShadowViewProjection& ShadowVP, FShadowRenderContext& OutContext) const;
+
 	// Shadow 렌더링 종료
 	void EndShadowRender(D3D11RHI* RHI);
 
@@ -132,6 +139,12 @@ public:
 	// 섀도우 필터 타입 변경
 	void SetFilterType(EShadowFilterType NewFilterType);
 
+	// 정적 섀도우 캐시 on/off (SpotLight/PointLight 섀도우 맵)
+	void SetStaticShadowCacheEnabled(bool bEnabled);
+
+	// 정적 캐스터가 바뀐 영역을 알림: 영역과 겹치는 라이트의 정적 섀도우 캐시 무효화
+	void MarkShadowCasterDirty(const FAABB& DirtyBounds);
+
 	// Query 메서드들
 	const FShadowConfiguration& GetShadowConfiguration() const { return Config; }
 	FShadowConfiguration& GetShadowConfiguration() { return Config; }
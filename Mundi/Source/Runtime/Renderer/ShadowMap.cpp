@@ -1,5 +1,8 @@
 ﻿#include "pch.h"
 #include "ShadowMap.h"
+#include "AABB.h"
+#include "BoundingSphere.h"
+#include "Collision.h"
 
 FShadowMap::FShadowMap()
 	: Width(0)
@@ -236,6 +239,8 @@ void FShadowMap::Release()
 	}
 	ShadowMapRTVs.clear();
 
+	ReleaseStaticCache();
+
 	if (ShadowMapTexture)
 	{
 		ShadowMapTexture->Release();
@@ -261,6 +266,19 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 	assert(RHI != nullptr, "RHI is null");
 	assert(ArrayIndex < ArraySize, "Array index out of bounds");
 
+	// 실제 슬라이스를 새로 그리므로 정적 사본과 달라짐
+	if (ArrayIndex < StaticSliceStates.size())
+	{
+		StaticSliceStates[ArrayIndex].bLiveMatchesStatic = false;
+	}
+
+	ID3D11DepthStencilView* DSV = ArrayIndex < ShadowMapDSVs.size() ? ShadowMapDSVs[ArrayIndex] : nullptr;
+	ID3D11RenderTargetView* RTV = ArrayIndex < ShadowMapRTVs.size() ? ShadowMapRTVs[ArrayIndex] : nullptr;
+	BindRenderTarget(RHI, DSV, RTV, true, DepthBias, SlopeScaledDepthBias);
+}
+
+void FShadowMap::BindRenderTarget(D3D11RHI* RHI, ID3D11DepthStencilView* DSV, ID3D11RenderTargetView* RTV, bool bClear, float DepthBias, float SlopeScaledDepthBias)
+{
 	ID3D11DeviceContext* pContext = RHI->GetDeviceContext();
 
 	// 섀도우 맵 SRV 언바인딩 (리소스 hazard 방지)
@@ -302,8 +320,10 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 	if (FilterType == EShadowFilterType::NONE || FilterType == EShadowFilterType::PCF)
 	{
 		// Depth-only 렌더링 (기존 방식)
-		ID3D11DepthStencilView* DSV = ShadowMapDSVs[ArrayIndex];
-		pContext->ClearDepthStencilView(DSV, D3D11_CLEAR_DEPTH, 1.0f, 0);
+		if (bClear)
+		{
+			pContext->ClearDepthStencilView(DSV, D3D11_CLEAR_DEPTH, 1.0f, 0);
+		}
 
 		// Pixel shader unbind (depth-only)
 		pContext->PSSetShader(nullptr, nullptr, 0);
@@ -318,18 +338,19 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 	else
 	{
 		// VSM/ESM/EVSM: RTV에 depth 정보 렌더링 (픽셀 쉐이더 필요)
-		ID3D11RenderTargetView* RTV = ShadowMapRTVs[ArrayIndex];
-
 		// RTV 유효성 검사
 		if (!RTV)
 		{
-			UE_LOG("BeginRender: RTV is null for ArrayIndex %d (FilterType=%d)", ArrayIndex, (int)FilterType);
+			UE_LOG("BeginRender: RTV is null (FilterType=%d)", (int)FilterType);
 			return;
 		}
 
 		// RTV 클리어 (white = 무한대 depth를 의미)
-		float clearColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-		pContext->ClearRenderTargetView(RTV, clearColor);
+		if (bClear)
+		{
+			float clearColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			pContext->ClearRenderTargetView(RTV, clearColor);
+		}
 
 		// VSM/ESM/EVSM용 픽셀 쉐이더는 SceneRenderer::OverrideShadowShader()에서 설정됨
 
@@ -347,6 +368,179 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 	pContext->RSSetViewports(1, &ScaledViewport);
 }
 
+void FShadowMap::SetStaticCacheEnabled(D3D11RHI* RHI, bool bEnabled)
+{
+	ReleaseStaticCache();
+	if (!bEnabled || !ShadowMapTexture)
+	{
+		return;
+	}
+
+	// 실제 섀도우 맵과 같은 포맷의 사본 배열 (셰이더에서 읽지 않으므로 SRV/큐브 플래그 제외)
+	D3D11_TEXTURE2D_DESC texDesc = {};
+	ShadowMapTexture->GetDesc(&texDesc);
+	texDesc.BindFlags &= ~D3D11_BIND_SHADER_RESOURCE;
+	texDesc.MiscFlags = 0;
+
+	HRESULT hr = RHI->GetDevice()->CreateTexture2D(&texDesc, nullptr, &StaticCacheTexture);
+	if (FAILED(hr))
+	{
+		UE_LOG("FShadowMap: Failed to create static shadow cache (%ux%u x %u)", Width, Height, ArraySize);
+		StaticCacheTexture = nullptr;
+		return;
+	}
+
+	const bool bDepthOnly = FilterType == EShadowFilterType::NONE || FilterType == EShadowFilterType::PCF;
+	for (UINT i = 0; i < ArraySize; i++)
+	{
+		if (bDepthOnly)
+		{
+			D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+			dsvDesc.Format = DXGI_FORMAT_D32_FLOAT;
+			dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+			dsvDesc.Texture2DArray.MipSlice = 0;
+			dsvDesc.Texture2DArray.FirstArraySlice = i;
+			dsvDesc.Texture2DArray.ArraySize = 1;
+
+			ID3D11DepthStencilView* DSV = nullptr;
+			hr = RHI->GetDevice()->CreateDepthStencilView(StaticCacheTexture, &dsvDesc, &DSV);
+			assert(SUCCEEDED(hr), "Failed to create static shadow cache DSV");
+			StaticCacheDSVs.Add(DSV);
+		}
+		else
+		{
+			D3D11_RENDER_TARGET_VIEW_DESC rtvDesc = {};
+			rtvDesc.Format = texDesc.Format;
+			rtvDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DARRAY;
+			rtvDesc.Texture2DArray.MipSlice = 0;
+			rtvDesc.Texture2DArray.FirstArraySlice = i;
+			rtvDesc.Texture2DArray.ArraySize = 1;
+
+			ID3D11RenderTargetView* RTV = nullptr;
+			hr = RHI->GetDevice()->CreateRenderTargetView(StaticCacheTexture, &rtvDesc, &RTV);
+			assert(SUCCEEDED(hr), "Failed to create static shadow cache RTV");
+			StaticCacheRTVs.Add(RTV);
+		}
+	}
+
+	StaticSliceStates.SetNum(ArraySize);
+}
+
+void FShadowMap::ReleaseStaticCache()
+{
+	for (ID3D11DepthStencilView* DSV : StaticCacheDSVs)
+	{
+		if (DSV)
+		{
+			DSV->Release();
+		}
+	}
+	StaticCacheDSVs.clear();
+
+	for (ID3D11RenderTargetView* RTV : StaticCacheRTVs)
+	{
+		if (RTV)
+		{
+			RTV->Release();
+		}
+	}
+	StaticCacheRTVs.clear();
+
+	if (StaticCacheTexture)
+	{
+		StaticCacheTexture->Release();
+		StaticCacheTexture = nullptr;
+	}
+	StaticSliceStates.clear();
+}
+
+bool FShadowMap::IsStaticSliceValid(UINT ArrayIndex, const void* Owner, uint64 Signature) const
+{
+	if (ArrayIndex >= StaticSliceStates.size())
+	{
+		return false;
+	}
+
+	const FStaticSliceState& State = StaticSliceStates[ArrayIndex];
+	return State.bValid && State.Owner == Owner && State.Signature == Signature;
+}
+
+void FShadowMap::BeginRenderStatic(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, float SlopeScaledDepthBias)
+{
+	assert(ArrayIndex < StaticSliceStates.size(), "Static shadow cache is not enabled");
+
+	FStaticSliceState& State = StaticSliceStates[ArrayIndex];
+	State.bValid = false;
+	State.bLiveMatchesStatic = false;
+
+	ID3D11DepthStencilView* DSV = ArrayIndex < StaticCacheDSVs.size() ? StaticCacheDSVs[ArrayIndex] : nullptr;
+	ID3D11RenderTargetView* RTV = ArrayIndex < StaticCacheRTVs.size() ? StaticCacheRTVs[ArrayIndex] : nullptr;
+	BindRenderTarget(RHI, DSV, RTV, true, DepthBias, SlopeScaledDepthBias);
+}
+
+void FShadowMap::MarkStaticSliceRendered(UINT ArrayIndex, const void* Owner, uint64 Signature, const FVector& LightCenter, float LightRadius)
+{
+	if (ArrayIndex >= StaticSliceStates.size())
+	{
+		return;
+	}
+
+	FStaticSliceState& State = StaticSliceStates[ArrayIndex];
+	State.Owner = Owner;
+	State.Signature = Signature;
+	State.LightCenter = LightCenter;
+	State.LightRadius = LightRadius;
+	State.bValid = true;
+}
+
+void FShadowMap::RestoreStaticSlice(D3D11RHI* RHI, UINT ArrayIndex)
+{
+	if (ArrayIndex >= StaticSliceStates.size())
+	{
+		return;
+	}
+
+	FStaticSliceState& State = StaticSliceStates[ArrayIndex];
+	if (State.bLiveMatchesStatic)
+	{
+		return;
+	}
+
+	// MipLevels = 1 이므로 서브리소스 인덱스 = 배열 슬라이스 (깊이 리소스는 전체 서브리소스만 복사 가능)
+	RHI->GetDeviceContext()->CopySubresourceRegion(ShadowMapTexture, ArrayIndex, 0, 0, 0, StaticCacheTexture, ArrayIndex, nullptr);
+	State.bLiveMatchesStatic = true;
+}
+
+void FShadowMap::BeginRenderDynamicLayer(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, float SlopeScaledDepthBias)
+{
+	assert(SupportsDynamicLayer(), "Dynamic shadow layer requires a depth shadow map");
+
+	RestoreStaticSlice(RHI, ArrayIndex);
+	StaticSliceStates[ArrayIndex].bLiveMatchesStatic = false;
+
+	// 정적 깊이 위에 깊이 테스트로 합성
+	BindRenderTarget(RHI, ShadowMapDSVs[ArrayIndex], nullptr, false, DepthBias, SlopeScaledDepthBias);
+}
+
+void FShadowMap::InvalidateStaticSlices(const FAABB& DirtyBounds)
+{
+	for (FStaticSliceState& State : StaticSliceStates)
+	{
+		if (State.bValid && Collision::Intersects(DirtyBounds, FBoundingSphere(State.LightCenter, State.LightRadius)))
+		{
+			State.bValid = false;
+		}
+	}
+}
+
+void FShadowMap::InvalidateAllStaticSlices()
+{
+	for (FStaticSliceState& State : StaticSliceStates)
+	{
+		State.bValid = false;
+	}
+}
+
 void FShadowMap::EndRender(D3D11RHI* RHI)
 {
 	assert(RHI != nullptr, "RHI is null");
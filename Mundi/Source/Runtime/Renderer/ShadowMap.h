@@ -2,6 +2,8 @@
 #include <map>
 #include "ShadowConfiguration.h"
 
+struct FAABB;
+
 class FShadowMap
 {
 public:
@@ -25,6 +27,29 @@ public:
 	void BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias = 10.0f, float SlopeScaledDepthBias = 1.0f);
 	void EndRender(D3D11RHI* RHI);
 
+	// ===== 정적 섀도우 캐시 =====
+	// 슬라이스마다 정적 캐스터만 그린 사본을 보관하고, 라이트와 정적 캐스터가 그대로면 다시 그리지 않고 복사만 합니다.
+
+	// 사본 배열 생성/해제 (Initialize 이후 호출, Release 시 함께 해제)
+	void SetStaticCacheEnabled(D3D11RHI* RHI, bool bEnabled);
+	bool IsStaticCacheEnabled() const { return StaticCacheTexture != nullptr; }
+	// 깊이 포맷(NONE/PCF)만 정적 사본 위에 동적 캐스터를 깊이 테스트로 합성할 수 있음
+	bool SupportsDynamicLayer() const { return FilterType == EShadowFilterType::NONE || FilterType == EShadowFilterType::PCF; }
+
+	// Owner(라이트)와 Signature(라이트 VP + 정적 캐스터 해시)가 마지막으로 그린 사본과 같은지
+	bool IsStaticSliceValid(UINT ArrayIndex, const void* Owner, uint64 Signature) const;
+	// 사본 슬라이스에 렌더링 시작 (클리어 포함). 그린 뒤 MarkStaticSliceRendered 호출
+	void BeginRenderStatic(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, float SlopeScaledDepthBias);
+	void MarkStaticSliceRendered(UINT ArrayIndex, const void* Owner, uint64 Signature, const FVector& LightCenter, float LightRadius);
+	// 사본을 실제 슬라이스로 복사 (이미 같은 내용이면 생략)
+	void RestoreStaticSlice(D3D11RHI* RHI, UINT ArrayIndex);
+	// 사본을 복사한 실제 슬라이스에 클리어 없이 바인딩 (동적 레이어)
+	void BeginRenderDynamicLayer(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, float SlopeScaledDepthBias);
+
+	// 영역과 라이트 볼륨이 겹치는 사본 무효화
+	void InvalidateStaticSlices(const FAABB& DirtyBounds);
+	void InvalidateAllStaticSlices();
+
 	ID3D11ShaderResourceView* GetSRV() const { return ShadowMapSRV; }
 	ID3D11ShaderResourceView* GetSliceSRV(UINT ArrayIndex) const
 	{
@@ -78,6 +103,10 @@ private:
 	// 깊이 리매핑 초기화 (DepthRemap.hlsl 셰이더 컴파일 및 리소스 생성)
 	void InitializeDepthRemapResources(D3D11RHI* RHI);
 	void ReleaseDepthRemapResources();
+	void ReleaseStaticCache();
+
+	// 렌더 타겟(DSV 또는 RTV) 바인딩 + 래스터라이저/뎁스 상태/뷰포트 설정
+	void BindRenderTarget(D3D11RHI* RHI, ID3D11DepthStencilView* DSV, ID3D11RenderTargetView* RTV, bool bClear, float DepthBias, float SlopeScaledDepthBias);
 	// 섀도우맵 크기
 	UINT Width;
 	UINT Height;
@@ -103,6 +132,22 @@ private:
 	// 섀도우 렌더링용 뷰포트
 	D3D11_VIEWPORT ShadowViewport;
 
+	// 정적 섀도우 캐시 사본 (SetStaticCacheEnabled로 생성)
+	ID3D11Texture2D* StaticCacheTexture = nullptr;
+	TArray<ID3D11DepthStencilView*> StaticCacheDSVs;
+	TArray<ID3D11RenderTargetView*> StaticCacheRTVs;
+
+	struct FStaticSliceState
+	{
+		const void* Owner = nullptr;	// 사본을 그린 라이트
+		uint64 Signature = 0;
+		FVector LightCenter;			// 무효화 판정용 라이트 볼륨
+		float LightRadius = 0.0f;
+		bool bValid = false;
+		bool bLiveMatchesStatic = false;	// 실제 슬라이스가 사본과 같은 내용인지
+	};
+	TArray<FStaticSliceState> StaticSliceStates;
+
 	// RasterizerState 캐싱용 키 구조체
 	struct FRasterizerStateKey
 	{
@@ -85,6 +85,36 @@ struct FShadowStats
 	}
 };
 
+/**
+ * @brief 라이트 하나의 섀도우 캐스터 컬링 통계 (모든 섀도우 뷰 합계)
+ */
+struct FShadowCasterLightStats
+{
+	const char* LightType = "";		// "Dir" / "Spot" / "Point"
+	uint32 ShadowViews = 0;			// 렌더한 섀도우 뷰 수 (큐브 면, 캐스케이드)
+	uint32 CastersInVolume = 0;		// 라이트 볼륨(감쇠 구)을 통과한 캐스터 수
+	uint32 CastersDrawn = 0;		// 뷰마다 그린 캐스터 수의 합
+	uint32 CastersCulled = 0;		// 뷰마다 컬링된 캐스터 수의 합 (볼륨 + 절두체)
+};
+
+/**
+ * @brief 섀도우 캐스터 컬링 / 배치 캐시 통계
+ */
+struct FShadowCasterCullingStats
+{
+	uint32 TotalCasters = 0;		// 프레임 캐스터 캐시의 캐스터 수
+	uint32 CachedBatches = 0;		// 프레임당 한 번 생성한 메시 배치 수
+	uint32 DrawnBatches = 0;		// 모든 섀도우 뷰에서 그린 배치 수의 합
+	uint32 CastersDrawn = 0;
+	uint32 CastersCulled = 0;
+
+	// 정적 섀도우 캐시 (SpotLight/PointLight 뷰)
+	uint32 ShadowViewsCached = 0;		// 정적 사본을 재사용한 뷰
+	uint32 ShadowViewsRendered = 0;		// 정적 사본을 다시 그린 뷰
+	uint32 DynamicLayerViews = 0;		// 사본 위에 동적 캐스터를 합성한 뷰
+	TArray<FShadowCasterLightStats> Lights;
+};
+
 /**
  * @brief 쉐도우 맵 통계 관리자 (싱글톤)
  */
@@ -110,6 +140,16 @@ public:
 		Stats = InStats;
 	}
 
+	/**
+	 * @brief 현재 프레임의 섀도우 캐스터 컬링 통계를 반환합니다.
+	 */
+	const FShadowCasterCullingStats& GetCasterCullingStats() const { return CasterCullingStats; }
+
+	void UpdateCasterCullingStats(const FShadowCasterCullingStats& InStats)
+	{
+		CasterCullingStats = InStats;
+	}
+
 private:
 	FShadowStatManager() = default;
 	~FShadowStatManager() = default;
@@ -117,4 +157,5 @@ private:
 	FShadowStatManager& operator=(const FShadowStatManager&) = delete;
 
 	FShadowStats Stats;
+	FShadowCasterCullingStats CasterCullingStats;
 };
@@ -27,8 +27,13 @@ struct FTileCullingStats
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CullingTimeMS = 0.0f;     // CPU binning + 타일 기록 시간 (GPU 업로드 제외)
 	uint32 LightIndexBufferSizeBytes = 0;
 
+	// 클러스터 (타일 × 깊이 슬라이스)
+	uint32 DepthSliceCount = 0;     // 0 = 2D 타일
+	uint32 TotalClusterEntries = 0; // 라이트가 걸친 (타일, 슬라이스) 쌍 수
+
 	// 시각화 모드
 	enum class EVisualizationMode : uint8
 	{
@@ -57,7 +62,10 @@ struct FTileCullingStats
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CullingTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
+		DepthSliceCount = 0;
+		TotalClusterEntries = 0;
 	}
 
 	// 파생 통계 계산
@@ -1,6 +1,11 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "ParallelFor.h"
 #include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
 
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
@@ -8,8 +13,14 @@ FTileLightCuller::FTileLightCuller()
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
+	, DepthSliceCount(0)
+	, SliceLogScale(0.0f)
+	, SliceLogBias(0.0f)
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, SliceMaskBuffer(nullptr)
+	, SliceMaskBufferSRV(nullptr)
+	, UploadedElementCount(0)
 {
 }
 
@@ -18,10 +29,11 @@ FTileLightCuller::~FTileLightCuller()
 	Release();
 }
 
-void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
+void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize, UINT InDepthSliceCount)
 {
 	RHI = InRHI;
 	TileSize = InTileSize;
+	DepthSliceCount = std::min(InDepthSliceCount, MaxDepthSlices);
 
 	// 초기화는 CullLights에서 뷰포트 크기를 알게 되면 수행
 }
@@ -36,11 +48,25 @@ void FTileLightCuller::CullLights(
 	UINT ViewportWidth,
 	UINT ViewportHeight)
 {
+	const auto CullStart = std::chrono::high_resolution_clock::now();
+
 	// 타일 그리드 계산
 	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
 	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
 	TotalTileCount = TileCountX * TileCountY;
 
+	// 깊이 슬라이스는 원근 투영에서만 사용 (셰이더가 SV_Position.w = 뷰 깊이로 슬라이스를 구함)
+	const bool bPerspective = ProjMatrix.M[2][3] != 0.0f;
+	if (!bPerspective || NearPlane <= 0.0f || FarPlane <= NearPlane)
+	{
+		DepthSliceCount = 0;
+	}
+	if (DepthSliceCount > 0)
+	{
+		SliceLogScale = static_cast<float>(DepthSliceCount) / std::log(FarPlane / NearPlane);
+		SliceLogBias = -std::log(NearPlane) * SliceLogScale;
+	}
+
 	// 통계 초기화
 	Stats.Reset();
 	Stats.TileCountX = TileCountX;
@@ -49,6 +75,7 @@ void FTileLightCuller::CullLights(
 	Stats.TotalPointLights = PointLights.Num();
 	Stats.TotalSpotLights = SpotLights.Num();
 	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
+	Stats.DepthSliceCount = DepthSliceCount;
 
 	// 타일 라이트 인덱스 버퍼 크기 재조정
 	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
@@ -56,344 +83,266 @@ void FTileLightCuller::CullLights(
 	{
 		TileLightIndices.SetNum(RequiredSize);
 	}
+	if (DepthSliceCount > 0 && TileLightSliceMasks.Num() != RequiredSize)
+	{
+		TileLightSliceMasks.SetNum(RequiredSize);
+	}
 
-	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
-	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
-
-	// Inverse View-Projection 행렬 계산
-	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
-
-	// 각 타일에 대해 컬링 수행
-	Stats.MinLightsPerTile = UINT_MAX;
-	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
+	// 1. 라이트별 binning: 감쇠 구를 타일 사각형 + 깊이 슬라이스로 한 번만 투영
+	// (SpotLight도 기존과 같이 감쇠 구로 근사, 원뿔 판정은 픽셀 셰이더가 수행)
+	const int32 PointCount = PointLights.Num();
+	const int32 LightCount = PointCount + SpotLights.Num();
+	LightBins.SetNum(LightCount);
 
-	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+	const float Width = static_cast<float>(ViewportWidth);
+	const float Height = static_cast<float>(ViewportHeight);
+	ParallelFor(LightCount, 64, [&](int32 Begin, int32 End)
 	{
-		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+		for (int32 i = Begin; i < End; ++i)
 		{
-			UINT TileIndex = TileY * TileCountX + TileX;
-			UINT TileDataOffset = TileIndex * MaxLightsPerTile;
-
-			// 타일 프러스텀 생성
-			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+			if (i < PointCount)
+			{
+				const FPointLightInfo& Light = PointLights[i];
+				LightBins[i] = BinSphere(Light.Position, Light.AttenuationRadius, ViewMatrix, ProjMatrix, NearPlane, FarPlane, Width, Height);
+				LightBins[i].PackedIndex = static_cast<uint32>(i);
+			}
+			else
+			{
+				const FSpotLightInfo& Light = SpotLights[i - PointCount];
+				LightBins[i] = BinSphere(Light.Position, Light.AttenuationRadius, ViewMatrix, ProjMatrix, NearPlane, FarPlane, Width, Height);
+				LightBins[i].PackedIndex = (1u << 16) | static_cast<uint32>(i - PointCount);
+			}
+		}
+	});
 
-			uint32 LightCount = 0;
+	// 2. 타일 행 단위로 병렬 래스터화: 각 행은 자기 타일에만 쓰고, 라이트 순서(포인트 → 스팟)를 그대로 유지
+	struct FRowStats
+	{
+		uint32 MinLights = UINT_MAX;
+		uint32 MaxLights = 0;
+		uint32 Entries = 0;
+		uint32 ClusterEntries = 0;
+	};
+	TArray<FRowStats> RowStats;
+	RowStats.SetNum(TileCountY);
 
-			// Point Light 테스트
-			for (int32 i = 0; i < PointLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+	const bool bClustered = DepthSliceCount > 0;
+	ParallelFor(static_cast<int32>(TileCountY), 1, [&](int32 Begin, int32 End)
+	{
+		for (int32 TileY = Begin; TileY < End; ++TileY)
+		{
+			const UINT RowOffset = TileY * TileCountX;
+			for (UINT TileX = 0; TileX < TileCountX; ++TileX)
 			{
-				Stats.TotalLightTests++;
-
-				if (TestPointLightAgainstFrustum(PointLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
+				TileLightIndices[(RowOffset + TileX) * MaxLightsPerTile] = 0;
 			}
 
-			// Spot Light 테스트
-			for (int32 i = 0; i < SpotLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+			FRowStats& Row = RowStats[TileY];
+			for (const FLightBin& Bin : LightBins)
 			{
-				Stats.TotalLightTests++;
+				if (Bin.IsEmpty() || TileY < Bin.MinTileY || TileY > Bin.MaxTileY)
+					continue;
 
-				if (TestSpotLightAgainstFrustum(SpotLights[i], Frustum, ViewMatrix))
+				for (int32 TileX = Bin.MinTileX; TileX <= Bin.MaxTileX; ++TileX)
 				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = (1 << 16) | i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
+					const UINT TileDataOffset = (RowOffset + TileX) * MaxLightsPerTile;
+					uint32& Count = TileLightIndices[TileDataOffset];
+					if (Count >= MaxLightsPerTile - 1)
+						continue;
+
+					TileLightIndices[TileDataOffset + 1 + Count] = Bin.PackedIndex;
+					if (bClustered)
+					{
+						TileLightSliceMasks[TileDataOffset + 1 + Count] = Bin.SliceMask;
+						Row.ClusterEntries += std::popcount(Bin.SliceMask);
+					}
+					++Count;
 				}
 			}
 
-			// 첫 번째 요소에 라이트 개수 저장
-			TileLightIndices[TileDataOffset] = LightCount;
-
-			// 통계 업데이트
-			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
-			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
+			for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+			{
+				const uint32 Count = TileLightIndices[(RowOffset + TileX) * MaxLightsPerTile];
+				Row.MinLights = std::min(Row.MinLights, Count);
+				Row.MaxLights = std::max(Row.MaxLights, Count);
+				Row.Entries += Count;
+			}
 		}
-	}
+	});
 
-	// 평균 계산
-	if (TotalTileCount > 0)
+	// 통계 업데이트
+	Stats.MinLightsPerTile = TotalTileCount > 0 ? UINT_MAX : 0;
+	Stats.MaxLightsPerTile = 0;
+	for (const FRowStats& Row : RowStats)
 	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
+		Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, Row.MinLights);
+		Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, Row.MaxLights);
+		Stats.TotalLightsPassed += Row.Entries;
+		Stats.TotalClusterEntries += Row.ClusterEntries;
 	}
 
-	// 컬링 효율성 계산
-	Stats.CalculateStats();
+	// 전수 검사였다면 수행했을 라이트-타일 쌍 수 (컬링 효율 기준)
+	Stats.TotalLightTests = TotalTileCount * static_cast<uint32>(LightCount);
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
-	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
+	// 평균/컬링 효율성 계산
+	Stats.CalculateStats();
 
-		if (SUCCEEDED(hr))
-		{
-			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
-		}
+	Stats.CullingTimeMS = static_cast<float>(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CullStart).count());
 
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
-	}
+	// GPU 버퍼 생성 또는 업데이트
+	UploadBuffers(RequiredSize);
 }
 
-FFrustum FTileLightCuller::CreateTileFrustum(
-	UINT TileX,
-	UINT TileY,
-	const FMatrix& InvViewProj,
+FTileLightCuller::FLightBin FTileLightCuller::BinSphere(
+	const FVector& Center,
+	float Radius,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
 	float NearPlane,
-	float FarPlane)
+	float FarPlane,
+	float ViewportWidth,
+	float ViewportHeight) const
 {
-	FFrustum Frustum;
-
-	// 타일의 NDC 좌표 계산
-	// NDC: [-1, 1] 범위, 왼쪽 아래가 (-1, -1), 오른쪽 위가 (1, 1)
-	// 주의: DirectX는 Y축이 위쪽이 양수
-
-	float TileMinX = static_cast<float>(TileX * TileSize);
-	float TileMaxX = static_cast<float>((TileX + 1) * TileSize);
-	float TileMinY = static_cast<float>(TileY * TileSize);
-	float TileMaxY = static_cast<float>((TileY + 1) * TileSize);
-
-	// 뷰포트 크기
-	float ViewportWidth = static_cast<float>(TileCountX * TileSize);
-	float ViewportHeight = static_cast<float>(TileCountY * TileSize);
-
-	// Screen Space -> NDC
-	float NDC_MinX = (TileMinX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MaxX = (TileMaxX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MinY = 1.0f - (TileMaxY / ViewportHeight) * 2.0f; // Y축 반전
-	float NDC_MaxY = 1.0f - (TileMinY / ViewportHeight) * 2.0f;
-
-	// 8개의 프러스텀 코너 (NDC 공간)
-	FVector4 FrustumCorners[8];
-
-	// Near plane corners
-	FrustumCorners[0] = FVector4(NDC_MinX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[1] = FVector4(NDC_MaxX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[2] = FVector4(NDC_MaxX, NDC_MaxY, 0.0f, 1.0f);
-	FrustumCorners[3] = FVector4(NDC_MinX, NDC_MaxY, 0.0f, 1.0f);
-
-	// Far plane corners
-	FrustumCorners[4] = FVector4(NDC_MinX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[5] = FVector4(NDC_MaxX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[6] = FVector4(NDC_MaxX, NDC_MaxY, 1.0f, 1.0f);
-	FrustumCorners[7] = FVector4(NDC_MinX, NDC_MaxY, 1.0f, 1.0f);
-
-	// NDC -> World Space 변환
-	FVector WorldCorners[8];
-	for (int i = 0; i < 8; ++i)
-	{
-		FVector4 WorldPos = FrustumCorners[i] * InvViewProj;
-		WorldPos /= WorldPos.W; // Perspective divide
-		WorldCorners[i] = FVector(WorldPos.X, WorldPos.Y, WorldPos.Z);
-	}
-
-	// 프러스텀 평면 생성 (외향 법선)
-	// 평면 방정식: Normal · P + Distance = 0
+	FLightBin Bin;
 
-	// Left plane (점: 0, 3, 7)
+	// 뷰 공간 (LH, +Z가 깊이)
+	const FVector4 ViewCenter = FVector4(Center.X, Center.Y, Center.Z, 1.0f) * ViewMatrix;
+	const float MinZ = ViewCenter.Z - Radius;
+	const float MaxZ = ViewCenter.Z + Radius;
+	if (MaxZ < NearPlane || MinZ > FarPlane)
 	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.LeftFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.LeftFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		return Bin;
 	}
 
-	// Right plane (점: 1, 5, 6)
-	{
-		FVector Edge1 = WorldCorners[5] - WorldCorners[1];
-		FVector Edge2 = WorldCorners[6] - WorldCorners[1];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.RightFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.RightFace.Distance = -FVector::Dot(Normal, WorldCorners[1]);
-	}
+	// 화면 사각형 (NDC)
+	float NdcMinX = -1.0f, NdcMaxX = 1.0f;
+	float NdcMinY = -1.0f, NdcMaxY = 1.0f;
 
-	// Bottom plane (점: 0, 1, 5)
+	// 원근 투영에서 구가 근평면을 넘으면 투영이 발산하므로 화면 전체로 보수적으로 처리
+	const bool bPerspective = ProjMatrix.M[2][3] != 0.0f;
+	if (!bPerspective || MinZ > NearPlane)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.BottomFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.BottomFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
-
-	// Top plane (점: 2, 3, 7)
-	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[2];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[2];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.TopFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.TopFace.Distance = -FVector::Dot(Normal, WorldCorners[2]);
-	}
-
-	// Near plane (점: 0, 1, 2)
-	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[2] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.NearFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.NearFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
+		// 뷰 공간 AABB의 8개 코너 투영 (구의 투영을 보수적으로 감쌈)
+		NdcMinX = NdcMinY = FLT_MAX;
+		NdcMaxX = NdcMaxY = -FLT_MAX;
+		for (int Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector4 ViewCorner(
+				ViewCenter.X + ((Corner & 1) ? Radius : -Radius),
+				ViewCenter.Y + ((Corner & 2) ? Radius : -Radius),
+				(Corner & 4) ? MaxZ : MinZ,
+				1.0f);
+			const FVector4 Clip = ViewCorner * ProjMatrix;
+			const float InvW = 1.0f / Clip.W;
+			NdcMinX = std::min(NdcMinX, Clip.X * InvW);
+			NdcMaxX = std::max(NdcMaxX, Clip.X * InvW);
+			NdcMinY = std::min(NdcMinY, Clip.Y * InvW);
+			NdcMaxY = std::max(NdcMaxY, Clip.Y * InvW);
+		}
 
-	// Far plane (점: 4, 6, 5)
-	{
-		FVector Edge1 = WorldCorners[6] - WorldCorners[4];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[4];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.FarFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.FarFace.Distance = -FVector::Dot(Normal, WorldCorners[4]);
+		if (NdcMaxX < -1.0f || NdcMinX > 1.0f || NdcMaxY < -1.0f || NdcMinY > 1.0f)
+		{
+			return Bin;
+		}
 	}
 
-	return Frustum;
+	// NDC -> 픽셀 -> 타일 (Y축 반전)
+	const float PixelMinX = (NdcMinX * 0.5f + 0.5f) * ViewportWidth;
+	const float PixelMaxX = (NdcMaxX * 0.5f + 0.5f) * ViewportWidth;
+	const float PixelMinY = (0.5f - NdcMaxY * 0.5f) * ViewportHeight;
+	const float PixelMaxY = (0.5f - NdcMinY * 0.5f) * ViewportHeight;
+
+	const float InvTileSize = 1.0f / static_cast<float>(TileSize);
+	const int32 LastTileX = static_cast<int32>(TileCountX) - 1;
+	const int32 LastTileY = static_cast<int32>(TileCountY) - 1;
+	Bin.MinTileX = FMath::Clamp(static_cast<int32>(std::floor(PixelMinX * InvTileSize)), 0, LastTileX);
+	Bin.MaxTileX = FMath::Clamp(static_cast<int32>(std::floor(PixelMaxX * InvTileSize)), 0, LastTileX);
+	Bin.MinTileY = FMath::Clamp(static_cast<int32>(std::floor(PixelMinY * InvTileSize)), 0, LastTileY);
+	Bin.MaxTileY = FMath::Clamp(static_cast<int32>(std::floor(PixelMaxY * InvTileSize)), 0, LastTileY);
+
+	Bin.SliceMask = GetSliceMask(std::max(MinZ, NearPlane), std::min(MaxZ, FarPlane));
+	return Bin;
 }
 
-bool FTileLightCuller::TestPointLightAgainstFrustum(
-	const FPointLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
+uint32 FTileLightCuller::GetSliceMask(float MinZ, float MaxZ) const
 {
-	// Point Light는 구체로 근사
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
-
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+	if (DepthSliceCount == 0)
+	{
+		return ~0u;
+	}
 
-bool FTileLightCuller::TestSpotLightAgainstFrustum(
-	const FSpotLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+	const int32 LastSlice = static_cast<int32>(DepthSliceCount) - 1;
+	const int32 FirstSlice = FMath::Clamp(static_cast<int32>(std::floor(std::log(MinZ) * SliceLogScale + SliceLogBias)), 0, LastSlice);
+	const int32 EndSlice = FMath::Clamp(static_cast<int32>(std::floor(std::log(MaxZ) * SliceLogScale + SliceLogBias)), 0, LastSlice);
 
-	// Spot Light도 구체로 근사
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
+	const uint64 Bits = (1ull << (EndSlice - FirstSlice + 1)) - 1;
+	return static_cast<uint32>(Bits << FirstSlice);
 }
 
-bool FTileLightCuller::SphereIntersectsFrustum(
-	const FVector& Center,
-	float Radius,
-	const FFrustum& Frustum)
+void FTileLightCuller::UploadBuffers(UINT RequiredSize)
 {
-	// 구체가 모든 평면의 앞쪽(양수)에 있으면 프러스텀 내부
-	// 하나라도 뒤쪽(음수)에 있고 거리가 반지름보다 크면 외부
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
+	// 뷰포트 크기가 바뀌면 다시 생성
+	if (LightIndexBuffer && UploadedElementCount != RequiredSize)
+	{
+		Release();
+	}
 
-	for (int i = 0; i < 6; ++i)
+	if (!LightIndexBuffer)
 	{
-		// 평면 방정식: Normal · P + Distance = 0
-		// 점 P에서 평면까지의 부호 있는 거리 = Normal · P + Distance
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-		float SignedDistance = FVector::Dot(Normal3D, Center) + Planes[i]->Distance;
+		// 버퍼 생성
+		HRESULT hr = RHI->CreateStructuredBuffer(
+			sizeof(uint32),
+			RequiredSize,
+			TileLightIndices.GetData(),
+			&LightIndexBuffer
+		);
 
-		// 구체가 평면 뒤쪽에 완전히 있으면 교차하지 않음
-		if (SignedDistance < -Radius)
+		if (SUCCEEDED(hr))
 		{
-			return false;
+			// SRV 생성
+			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
 		}
+		UploadedElementCount = RequiredSize;
 	}
-
-	return true;
-}
-
-bool FTileLightCuller::ConeIntersectsFrustum(
-	const FVector& Apex,
-	const FVector& Direction,
-	float Height,
-	float CosHalfAngle,
-	const FFrustum& Frustum)
-{
-	// 원뿔-프러스텀 교차 테스트
-	float SinHalfAngle = sqrt(1.0f - CosHalfAngle * CosHalfAngle);
-
-	// 원뿔 밑면의 반지름
-	float BaseRadius = Height * SinHalfAngle;
-
-	// 경계 구체의 중심은 원뿔 축을 따라 이동
-	float K = (CosHalfAngle > 0.707f) ? 0.5f : (0.5f + 0.5f * SinHalfAngle);
-	FVector SphereCenter = Apex + Direction * (Height * K);
-
-	// 경계 구체의 반지름 (원뿔의 꼭지점과 밑면 가장자리를 모두 포함)
-	float SphereRadius;
-	if (CosHalfAngle > 0.707f) // 각도가 45도 이하 (좁은 원뿔)
-	{
-		// 좁은 원뿔: 밑면 중심에서 가장자리까지의 거리
-		SphereRadius = sqrt(BaseRadius * BaseRadius + (Height * 0.5f) * (Height * 0.5f));
-	}
-	else // 각도가 45도 이상 (넓은 원뿔)
+	else
 	{
-		// 넓은 원뿔: 더 보수적인 반지름 사용
-		SphereRadius = Height * 0.866f; // sqrt(3)/2 ≈ 0.866
+		// 기존 버퍼 업데이트
+		RHI->UpdateStructuredBuffer(
+			LightIndexBuffer,
+			TileLightIndices.GetData(),
+			RequiredSize * sizeof(uint32)
+		);
 	}
+	Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
 
-	// 2. 경계 구체가 프러스텀과 교차하는지 먼저 테스트 (빠른 거부)
-	if (!SphereIntersectsFrustum(SphereCenter, SphereRadius, Frustum))
+	if (DepthSliceCount == 0)
 	{
-		return false;
+		return;
 	}
 
-	// 3. 추가 정밀 테스트: 원뿔 끝점(밑면 중심)도 체크
-	FVector ConeEnd = Apex + Direction * Height;
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
-
-	// 원뿔의 꼭지점과 끝점이 모두 같은 평면 뒤쪽에 있는지 확인
-	for (int i = 0; i < 6; ++i)
+	if (!SliceMaskBuffer)
 	{
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-
-		float ApexDistance = FVector::Dot(Normal3D, Apex) + Planes[i]->Distance;
-		float EndDistance = FVector::Dot(Normal3D, ConeEnd) + Planes[i]->Distance;
+		HRESULT hr = RHI->CreateStructuredBuffer(
+			sizeof(uint32),
+			RequiredSize,
+			TileLightSliceMasks.GetData(),
+			&SliceMaskBuffer
+		);
 
-		// 두 점이 모두 평면 뒤쪽에 있고, 밑면 반지름보다 멀리 있으면 완전히 외부
-		if (ApexDistance < -BaseRadius && EndDistance < -BaseRadius)
+		if (SUCCEEDED(hr))
 		{
-			return false;
+			RHI->CreateStructuredBufferSRV(SliceMaskBuffer, &SliceMaskBufferSRV);
 		}
 	}
-
-	// 모든 테스트를 통과하면 교차한다고 판단
-	return true;
+	else
+	{
+		RHI->UpdateStructuredBuffer(
+			SliceMaskBuffer,
+			TileLightSliceMasks.GetData(),
+			RequiredSize * sizeof(uint32)
+		);
+	}
+	Stats.LightIndexBufferSizeBytes += RequiredSize * sizeof(uint32);
 }
 
 ID3D11ShaderResourceView* FTileLightCuller::GetLightIndexBufferSRV()
@@ -415,5 +364,17 @@ void FTileLightCuller::Release()
 		LightIndexBuffer = nullptr;
 	}
 
-	TileLightIndices.Empty();
+	if (SliceMaskBufferSRV)
+	{
+		SliceMaskBufferSRV->Release();
+		SliceMaskBufferSRV = nullptr;
+	}
+
+	if (SliceMaskBuffer)
+	{
+		SliceMaskBuffer->Release();
+		SliceMaskBuffer = nullptr;
+	}
+
+	UploadedElementCount = 0;
 }
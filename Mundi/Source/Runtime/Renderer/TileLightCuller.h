@@ -2,10 +2,10 @@
 #include "LightManager.h"
 #include "TileCullingStats.h"
 #include "D3D11RHI.h"
-#include "Frustum.h"
 
 // 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+// 라이트마다 감쇠 구를 화면 사각형 + 깊이 범위로 한 번 투영하고(binning),
+// 사각형이 덮는 타일에만 라이트 인덱스를 기록한다 (타일 × 라이트 전수 검사 없음)
 class FTileLightCuller
 {
 public:
@@ -13,7 +13,8 @@ public:
 	~FTileLightCuller();
 
 	// 초기화 (Structured Buffer 생성)
-	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
+	// InDepthSliceCount - 0이면 2D 타일, 1~MaxDepthSlices면 타일 × 깊이 슬라이스 (클러스터)
+	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16, UINT InDepthSliceCount = 0);
 
 	// 타일 컬링 수행 (매 프레임 호출)
 	void CullLights(
@@ -30,37 +31,47 @@ public:
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// 클러스터 모드의 슬라이스 마스크 SRV (2D 타일 모드면 nullptr)
+	ID3D11ShaderResourceView* GetSliceMaskBufferSRV() const { return SliceMaskBufferSRV; }
+
+	UINT GetDepthSliceCount() const { return DepthSliceCount; }
+
+	// 뷰 깊이 z의 슬라이스 = floor(log(z) * Scale + Bias) (셰이더 상수 버퍼와 동일한 식)
+	float GetSliceLogScale() const { return SliceLogScale; }
+	float GetSliceLogBias() const { return SliceLogBias; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
 	// 리소스 해제
 	void Release();
 
+	// 셰이더 슬라이스 마스크가 uint32 하나이므로 최대 32
+	static constexpr UINT MaxDepthSlices = 32;
+
 private:
-	// 타일 프러스텀 생성 (Conservative near/far 방식)
-	FFrustum CreateTileFrustum(
-		UINT TileX,
-		UINT TileY,
-		const FMatrix& InvViewProj,
-		float NearPlane,
-		float FarPlane
-	);
+	// 라이트 하나가 덮는 타일 사각형과 깊이 슬라이스 (포함 범위)
+	struct FLightBin
+	{
+		uint32 PackedIndex = 0;		// 상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스
+		uint32 SliceMask = 0;
+		int32 MinTileX = 0;
+		int32 MaxTileX = -1;
+		int32 MinTileY = 0;
+		int32 MaxTileY = -1;
 
-	// 라이트가 타일 프러스텀과 교차하는지 테스트
-	bool TestPointLightAgainstFrustum(const FPointLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-	bool TestSpotLightAgainstFrustum(const FSpotLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
+		bool IsEmpty() const { return MaxTileX < MinTileX || MaxTileY < MinTileY; }
+	};
 
-	// 구체와 프러스텀 교차 테스트
-	bool SphereIntersectsFrustum(const FVector& Center, float Radius, const FFrustum& Frustum);
+	// 감쇠 구를 화면 타일 사각형과 슬라이스 마스크로 투영 (뷰 밖이면 빈 bin)
+	FLightBin BinSphere(const FVector& Center, float Radius, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix,
+		float NearPlane, float FarPlane, float ViewportWidth, float ViewportHeight) const;
 
-	// 원뿔과 프러스텀 교차 테스트 (SpotLight용)
-	bool ConeIntersectsFrustum(
-		const FVector& Apex,           // 원뿔 꼭지점 (라이트 위치)
-		const FVector& Direction,      // 원뿔 방향 (정규화됨)
-		float Height,                  // 원뿔 높이 (AttenuationRadius)
-		float CosHalfAngle,            // cos(OuterConeAngle / 2)
-		const FFrustum& Frustum
-	);
+	// 뷰 깊이 범위 [MinZ, MaxZ]가 걸치는 슬라이스 비트
+	uint32 GetSliceMask(float MinZ, float MaxZ) const;
+
+	// GPU 버퍼 생성 또는 갱신
+	void UploadBuffers(UINT RequiredSize);
 
 private:
 	D3D11RHI* RHI;
@@ -71,6 +82,11 @@ private:
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
 
+	// 클러스터 깊이 슬라이스 (0 = 2D 타일)
+	UINT DepthSliceCount;
+	float SliceLogScale;
+	float SliceLogBias;
+
 	// 타일당 최대 라이트 개수 (보수적으로 설정)
 	static constexpr UINT MaxLightsPerTile = 256;
 
@@ -79,9 +95,18 @@ private:
 	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
 	TArray<uint32> TileLightIndices;
 
+	// 클러스터 모드: TileLightIndices와 같은 위치에 해당 라이트가 걸치는 깊이 슬라이스 비트
+	TArray<uint32> TileLightSliceMasks;
+
+	// 프레임마다 재사용하는 라이트 bin (포인트 → 스팟 순)
+	TArray<FLightBin> LightBins;
+
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	ID3D11Buffer* SliceMaskBuffer;
+	ID3D11ShaderResourceView* SliceMaskBufferSRV;
+	UINT UploadedElementCount;
 
 	// 통계
 	FTileCullingStats Stats;
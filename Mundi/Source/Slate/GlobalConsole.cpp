@@ -1,10 +1,14 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+// Preload 워커 스레드에서도 UE_LOG를 호출하므로 위젯 로그 버퍼 접근을 직렬화
+static std::mutex ConsoleLogMutex;
+
 void UGlobalConsole::Initialize()
 {
     // Nothing special to initialize
@@ -57,6 +61,7 @@ void UGlobalConsole::LogV(const char* fmt, va_list args)
         // Need to use a copy of va_list for second call
         va_list args_copy;
         va_copy(args_copy, args);
+        std::lock_guard<std::mutex> Lock(ConsoleLogMutex);
         ConsoleWidget->VAddLog(fmt, args_copy);
         va_end(args_copy);
     }
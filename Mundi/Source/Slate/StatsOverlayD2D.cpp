@@ -7,11 +7,16 @@
 #include "StatsOverlayD2D.h"
 #include "UIManager.h"
 #include "MemoryManager.h"
+#include "FrameAllocationStats.h"
 #include "Picking.h"
 #include "PlatformTime.h"
 #include "DecalStatManager.h"
 #include "TileCullingStats.h"
 #include "ShadowStats.h"
+#include "FrustumCullingStats.h"
+#include "BVHStats.h"
+#include "AnimationStats.h"
+#include "TransformStats.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -97,7 +102,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowShadowMap) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowShadowMap && !bShowCulling && !bShowBVH && !bShowAnimation && !bShowTransform) || !SwapChain)
 		return;
 
 	ID2D1Factory1* D2dFactory = nullptr;
@@ -222,18 +227,67 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(CMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		constexpr double ToMB = 1.0 / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(CMemoryManager::GetTotalAllocationBytes()) * ToMB;
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, CMemoryManager::TotalAllocationCount);
+		// 직전 프레임 씬 렌더링 중 할당 (정상 상태에서 배치 구간은 0)
+		const FFrameAllocationStats& FrameAllocStats = FFrameAllocationStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[1024];
+		int Len = swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u\nPool Reserved: %.1f MB\nLarge: %u (%.1f MB)\nPIE Arena: %s (%u live, %.1f MB)\nRender UObject Allocs: %u\nFrame Arena: %.1f / %.1f KB (+%u)",
+			Mb, CMemoryManager::GetTotalAllocationCount(),
+			static_cast<double>(CMemoryManager::GetPoolReservedBytes()) * ToMB,
+			CMemoryManager::GetLargeAllocationCount(),
+			static_cast<double>(CMemoryManager::GetLargeAllocationBytes()) * ToMB,
+			CMemoryManager::IsArenaModeEnabled() ? L"ON" : L"OFF",
+			CMemoryManager::GetArenaLiveCount(),
+			static_cast<double>(CMemoryManager::GetArenaReservedBytes()) * ToMB,
+			FrameAllocStats.RenderObjectAllocations,
+			static_cast<double>(FrameAllocStats.ArenaUsedBytes) / 1024.0,
+			static_cast<double>(FrameAllocStats.ArenaCapacityBytes) / 1024.0,
+			FrameAllocStats.ArenaChunkAllocations);
+
+		// 힙 할당 횟수는 집계 스위치가 켜져 있을 때만 센다 (MEMORY HEAPCOUNT, Debug 기본 켜짐)
+		if (CMemoryManager::IsGlobalHeapCountingEnabled())
+		{
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\nRender Heap Allocs: %u (Batch: %u)",
+				FrameAllocStats.RenderHeapAllocations, FrameAllocStats.BatchHeapAllocations);
+		}
+		else
+		{
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\nRender Heap Allocs: off");
+		}
+
+		// 살아 있는 바이트 기준 상위 클래스
+		constexpr int32 TopClassCount = 5;
+		TArray<UClass*> TopClasses;
+		for (UClass* Class : UClass::GetAllClasses())
+		{
+			if (Class && Class->LiveObjectCount > 0)
+			{
+				TopClasses.Add(Class);
+			}
+		}
+		const int32 ShownCount = std::min(TopClassCount, TopClasses.Num());
+		std::partial_sort(TopClasses.begin(), TopClasses.begin() + ShownCount, TopClasses.end(),
+			[](const UClass* A, const UClass* B) { return A->LiveObjectBytes > B->LiveObjectBytes; });
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		for (int32 i = 0; i < ShownCount && Len > 0; ++i)
+		{
+			const UClass* Class = TopClasses[i];
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\n%hs: %u (%.1f KB)",
+				Class->Name, Class->LiveObjectCount, static_cast<double>(Class->LiveObjectBytes) / 1024.0);
+		}
+
+		const float MemoryPanelHeight = 162.0f + 19.0f * ShownCount;
+		const float MemoryPanelWidth = 280.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + MemoryPanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, Dwrite, Buf, Rc, 16.0f,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -275,7 +329,7 @@ void UStatsOverlayD2D::Draw()
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nDepth Slices: %u (Clusters Hit: %u)\nCull Time: %.3f ms\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
 			TileStats.TotalTileCount,
@@ -286,10 +340,13 @@ void UStatsOverlayD2D::Draw()
 			TileStats.AvgLightsPerTile,
 			TileStats.MaxLightsPerTile,
 			TileStats.CullingEfficiency,
+			TileStats.DepthSliceCount,
+			TileStats.TotalClusterEntries,
+			TileStats.CullingTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 200.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 cyan으로 설정합니다.
@@ -372,6 +429,128 @@ void UStatsOverlayD2D::Draw()
 			D2D1::ColorF(D2D1::ColorF::Magenta));
 
 		NextY += shadowPanelHeight + Space;
+
+		// 섀도우 캐스터 컬링: 라이트별 (그린 / 컬링된) 캐스터 수, 섀도우 뷰 합계
+		const FShadowCasterCullingStats& CasterStats = FShadowStatManager::GetInstance().GetCasterCullingStats();
+
+		wchar_t CasterBuf[1024];
+		int Len = swprintf_s(CasterBuf, L"[Shadow Casters]\nCasters: %u (Batches %u cached)\nDrawn: %u / Culled: %u\nBatches Drawn: %u\nStatic Cache: %u reused / %u redrawn / %u dynamic",
+			CasterStats.TotalCasters, CasterStats.CachedBatches,
+			CasterStats.CastersDrawn, CasterStats.CastersCulled,
+			CasterStats.DrawnBatches,
+			CasterStats.ShadowViewsCached, CasterStats.ShadowViewsRendered, CasterStats.DynamicLayerViews);
+
+		constexpr int32 MaxShownLights = 8;
+		const int32 ShownLights = std::min(MaxShownLights, CasterStats.Lights.Num());
+		for (int32 i = 0; i < ShownLights && Len > 0; ++i)
+		{
+			const FShadowCasterLightStats& LightStats = CasterStats.Lights[i];
+			Len += swprintf_s(CasterBuf + Len, std::size(CasterBuf) - Len, L"\n%hs #%d: %u views, %u in volume, %u culled",
+				LightStats.LightType, i, LightStats.ShadowViews, LightStats.CastersInVolume, LightStats.CastersCulled);
+		}
+
+		const float CasterPanelWidth = 340.0f;
+		const float CasterPanelHeight = 105.0f + 19.0f * ShownLights;
+		D2D1_RECT_F CasterRc = D2D1::RectF(Margin, NextY, Margin + CasterPanelWidth, NextY + CasterPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, CasterBuf, CasterRc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Magenta));
+
+		NextY += CasterPanelHeight + Space;
+	}
+
+	if (bShowCulling)
+	{
+		const FFrustumCullingStatManager& CullingStats = FFrustumCullingStatManager::GetInstance();
+
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[Frustum Culling]\nTested: %u\nCulled: %u\nVisible: %u\nBVH Visible: %u\nBVH Query: %.3f ms",
+			CullingStats.GetTestedComponentCount(),
+			CullingStats.GetCulledComponentCount(),
+			CullingStats.GetVisibleComponentCount(),
+			CullingStats.GetBVHVisibleCount(),
+			CullingStats.GetBVHQueryTimeMS());
+
+		const float CullingPanelHeight = 120.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + CullingPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightPink));
+
+		NextY += CullingPanelHeight + Space;
+	}
+
+	if (bShowBVH)
+	{
+		const FBVHStatManager& BVHStats = FBVHStatManager::GetInstance();
+		const FBVHTreeStats& Partition = BVHStats.GetStats(EBVHStatTarget::Partition);
+		const FBVHTreeStats& Collision = BVHStats.GetStats(EBVHStatTarget::Collision);
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[BVH Update]\nPartition:\n  Refit: %u (%.3f ms)\n  Rebuild: %u (%.3f ms)\n  SAH Ratio: %.2f\nCollision:\n  Refit: %u (%.3f ms)\n  Rebuild: %u (%.3f ms)\n  SAH Ratio: %.2f",
+			Partition.RefitCount, Partition.RefitTimeMS,
+			Partition.RebuildCount, Partition.RebuildTimeMS,
+			Partition.SAHCostRatio,
+			Collision.RefitCount, Collision.RefitTimeMS,
+			Collision.RebuildCount, Collision.RebuildTimeMS,
+			Collision.SAHCostRatio);
+
+		const float BVHPanelHeight = 190.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + BVHPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Khaki));
+
+		NextY += BVHPanelHeight + Space;
+	}
+
+	if (bShowAnimation)
+	{
+		const FAnimationFrameStats& AnimStats = FAnimationStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[384];
+		swprintf_s(Buf, L"[Animation]\nComponents: %u\nBones: %u\nVertices: %u\nSkinning Jobs: %u\nPose: %.3f ms\nSkinning: %.3f ms\nThrottled: %u\nPaused: %u\nSaved Vertices: %u",
+			AnimStats.ComponentCount,
+			AnimStats.BoneCount,
+			AnimStats.VertexCount,
+			AnimStats.SkinningJobCount,
+			AnimStats.PoseTimeMS,
+			AnimStats.SkinningTimeMS,
+			AnimStats.ThrottledComponentCount,
+			AnimStats.PausedComponentCount,
+			AnimStats.SavedVertexCount);
+
+		const float AnimationPanelHeight = 200.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + AnimationPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::PaleTurquoise));
+
+		NextY += AnimationPanelHeight + Space;
+	}
+
+	if (bShowTransform)
+	{
+		const FTransformFrameStats& TransformStats = FTransformStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[World Transform]\nCompositions: %u\nCache Hits: %u\nBatch Updated: %u",
+			TransformStats.CompositionCount,
+			TransformStats.CacheHitCount,
+			TransformStats.BatchUpdateCount);
+
+		const float TransformPanelHeight = 86.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + TransformPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSalmon));
+
+		NextY += TransformPanelHeight + Space;
 	}
 
 	D2dCtx->EndDraw();
@@ -445,3 +624,43 @@ void UStatsOverlayD2D::ToggleShadowMap()
 {
 	bShowShadowMap = !bShowShadowMap;
 }
+
+void UStatsOverlayD2D::SetShowCulling(bool b)
+{
+	bShowCulling = b;
+}
+
+void UStatsOverlayD2D::ToggleCulling()
+{
+	bShowCulling = !bShowCulling;
+}
+
+void UStatsOverlayD2D::SetShowBVH(bool b)
+{
+	bShowBVH = b;
+}
+
+void UStatsOverlayD2D::ToggleBVH()
+{
+	bShowBVH = !bShowBVH;
+}
+
+void UStatsOverlayD2D::SetShowAnimation(bool b)
+{
+	bShowAnimation = b;
+}
+
+void UStatsOverlayD2D::ToggleAnimation()
+{
+	bShowAnimation = !bShowAnimation;
+}
+
+void UStatsOverlayD2D::SetShowTransform(bool b)
+{
+	bShowTransform = b;
+}
+
+void UStatsOverlayD2D::ToggleTransform()
+{
+	bShowTransform = !bShowTransform;
+}
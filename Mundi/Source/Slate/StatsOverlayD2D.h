@@ -18,18 +18,30 @@ public:
     void SetShowDecal(bool b);
     void SetShowTileCulling(bool b);
     void SetShowShadowMap(bool b);
+    void SetShowCulling(bool b);
+    void SetShowBVH(bool b);
+    void SetShowAnimation(bool b);
+    void SetShowTransform(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
     void ToggleDecal();
     void ToggleTileCulling();
     void ToggleShadowMap();
+    void ToggleCulling();
+    void ToggleBVH();
+    void ToggleAnimation();
+    void ToggleTransform();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
     bool IsDecalVisible() const { return bShowDecal; }
     bool IsTileCullingVisible() const { return bShowTileCulling; }
     bool IsShadowMapVisible() const { return bShowShadowMap; }
+    bool IsCullingVisible() const { return bShowCulling; }
+    bool IsBVHVisible() const { return bShowBVH; }
+    bool IsAnimationVisible() const { return bShowAnimation; }
+    bool IsTransformVisible() const { return bShowTransform; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -48,6 +60,10 @@ private:
     bool bShowDecal = false;
     bool bShowTileCulling = false;
     bool bShowShadowMap = false;
+    bool bShowCulling = false;
+    bool bShowBVH = false;
+    bool bShowAnimation = false;
+    bool bShowTransform = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -3,6 +3,26 @@
 #include "ObjectFactory.h"
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
+#include "MeshBVH.h"
+#include "WindowsBinReader.h"
+#include "MemoryMappedReader.h"
+#include "ObjManager.h"
+#include "FFBXManager.h"
+#include "SkinningKernel.h"
+#include "AnimSequence.h"
+#include "ParallelFor.h"
+#include "SceneComponent.h"
+#include "TransformStats.h"
+#include "World.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+#include "ObjectIterator.h"
+#include "MeshBatchSort.h"
+#include "BVHierarchy.h"
+#include "CollisionBVH.h"
+#include "FrameAllocationStats.h"
+#include <psapi.h>
+#include <chrono>
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -49,6 +69,25 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT ALL");
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
+	HelpCommandList.Add("STAT CULLING");
+	HelpCommandList.Add("STAT BVH");
+	HelpCommandList.Add("STAT ANIM");
+	HelpCommandList.Add("STAT TRANSFORM");
+	HelpCommandList.Add("MEMORY ARENA");
+	HelpCommandList.Add("MEMORY ARENACHECK");
+	HelpCommandList.Add("MEMORY HEAPCOUNT");
+	HelpCommandList.Add("BENCH MESHBVH");
+	HelpCommandList.Add("BENCH MESHLOAD");
+	HelpCommandList.Add("BENCH OBJPARSE");
+	HelpCommandList.Add("BENCH OBJCONVERT");
+	HelpCommandList.Add("BENCH SKINNING");
+	HelpCommandList.Add("BENCH ANIM");
+	HelpCommandList.Add("BENCH OBJITER");
+	HelpCommandList.Add("BENCH MESHSORT");
+	HelpCommandList.Add("BENCH BVHREFIT");
+	HelpCommandList.Add("BENCH TRANSFORM");
+	HelpCommandList.Add("BENCH BATCHALLOC");
+	HelpCommandList.Add("VERIFY TRANSFORM");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -325,6 +364,10 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
+		AddLog("- STAT CULLING");
+		AddLog("- STAT BVH");
+		AddLog("- STAT ANIM");
+		AddLog("- STAT TRANSFORM");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -358,6 +401,26 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleShadowMap();
 		AddLog("STAT SHADOW TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT CULLING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCulling();
+		AddLog("STAT CULLING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT BVH") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleBVH();
+		AddLog("STAT BVH TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT ANIM") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleAnimation();
+		AddLog("STAT ANIM TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT TRANSFORM") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleTransform();
+		AddLog("STAT TRANSFORM TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -366,6 +429,10 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowDecal(true);
 		UStatsOverlayD2D::Get().SetShowTileCulling(true);
 		UStatsOverlayD2D::Get().SetShowShadowMap(true);
+		UStatsOverlayD2D::Get().SetShowCulling(true);
+		UStatsOverlayD2D::Get().SetShowBVH(true);
+		UStatsOverlayD2D::Get().SetShowAnimation(true);
+		UStatsOverlayD2D::Get().SetShowTransform(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -376,8 +443,508 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowDecal(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		UStatsOverlayD2D::Get().SetShowShadowMap(false);
+		UStatsOverlayD2D::Get().SetShowCulling(false);
+		UStatsOverlayD2D::Get().SetShowBVH(false);
+		UStatsOverlayD2D::Get().SetShowAnimation(false);
+		UStatsOverlayD2D::Get().SetShowTransform(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "MEMORY ARENA") == 0)
+	{
+		// PIE 월드 수명 동안의 UObject 할당을 아레나로 모아 PIE 종료 시 페이지를 한 번에 반환. 다음 PIE 시작부터 적용
+		const bool bEnabled = !CMemoryManager::IsArenaModeEnabled();
+		CMemoryManager::SetArenaModeEnabled(bEnabled);
+		AddLog("MEMORY ARENA: %s", bEnabled ? "ON" : "OFF");
+	}
+	else if (Stricmp(command_line, "MEMORY HEAPCOUNT") == 0)
+	{
+		// 전역 operator new 호출 횟수 집계 토글 (STAT MEMORY의 Render Heap Allocs). Release는 기본 꺼짐
+		if (!CMemoryManager::IsGlobalHeapCountingSupported())
+		{
+			AddLog("[warning] MEMORY HEAPCOUNT: heap counting is compiled out (MUNDI_COUNT_HEAP_ALLOCS=0)");
+		}
+		else
+		{
+			const bool bEnabled = !CMemoryManager::IsGlobalHeapCountingEnabled();
+			CMemoryManager::SetGlobalHeapCountingEnabled(bEnabled);
+			AddLog("MEMORY HEAPCOUNT: %s", bEnabled ? "ON" : "OFF");
+		}
+	}
+	else if (Stricmp(command_line, "MEMORY ARENACHECK") == 0)
+	{
+		// 아레나 Begin/End/Release 주기 반복 후 살아 있는 블록과 예약 페이지가 0으로 돌아오는지 확인 (지연 반환 + 다중 스레드 해제 포함)
+		constexpr int32 Cycles = 16;
+		constexpr int32 BlocksPerCycle = 4096;
+		const int32 FailedCycles = CMemoryManager::VerifyArenaCycles(Cycles, BlocksPerCycle);
+		if (FailedCycles < 0)
+		{
+			AddLog("[warning] MEMORY ARENACHECK: a PIE arena is open, run it outside PIE");
+		}
+		else if (FailedCycles > 0)
+		{
+			AddLog("[error] MEMORY ARENACHECK: %d / %d cycles left blocks or pages behind", FailedCycles, Cycles);
+		}
+		else
+		{
+			AddLog("MEMORY ARENACHECK: %d cycles x %d blocks passed, all arena blocks and pages returned", Cycles, BlocksPerCycle);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH MESHBVH") == 0)
+	{
+		// 로드된 모든 StaticMesh에 대해 피킹 BVH 빌드 시간과 레이 처리량을 측정
+		constexpr uint32 RayCount = 100000;
+		AddLog("BENCH MESHBVH: %u rays per mesh", RayCount);
+
+		for (UStaticMesh* StaticMesh : UResourceManager::GetInstance().GetAllStaticMeshes())
+		{
+			FStaticMesh* Asset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+			if (!Asset || Asset->Indices.Num() < 3)
+				continue;
+
+			double BuildMS = 0.0;
+			double RaysPerSecond = 0.0;
+			uint32 HitCount = 0;
+			FMeshBVH::Benchmark(Asset->Vertices, Asset->Indices, RayCount, BuildMS, RaysPerSecond, HitCount);
+
+			AddLog("- %s: %d tris, build %.2f ms, %.2f Mrays/s, %u hits",
+				StaticMesh->GetAssetPathFileName().c_str(), static_cast<int32>(Asset->Indices.Num() / 3),
+				BuildMS, RaysPerSecond / 1.0e6, HitCount);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH MESHLOAD") == 0)
+	{
+		// DerivedDataCache의 모든 메시 캐시(.sm.bin / .sk.bin)를 스트림 / 메모리 매핑 두 방식으로 다시 읽어 로드 시간을 비교
+		auto GetPeakWorkingSetMB = []()
+		{
+			PROCESS_MEMORY_COUNTERS Counters = {};
+			GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters));
+			return Counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+		};
+
+		// 캐시 하나를 Archive로 읽고 소요 시간(ms)을 반환
+		auto LoadMeshCache = [](FArchive& Ar, bool bStatic, uint32& OutVersion)
+		{
+			const auto LoadStart = std::chrono::high_resolution_clock::now();
+			if (bStatic)
+			{
+				FStaticMesh Mesh;
+				Ar << Mesh;
+				OutVersion = Mesh.LoadedCacheVersion;
+			}
+			else
+			{
+				FSkeletalMesh Mesh;
+				Ar << Mesh;
+				OutVersion = Mesh.LoadedCacheVersion;
+			}
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - LoadStart).count();
+		};
+
+		const double PeakBeforeMB = GetPeakWorkingSetMB();
+		int32 FileCount = 0;
+		uint64 TotalBytes = 0;
+		double TotalStreamMS = 0.0;
+		double TotalMappedMS = 0.0;
+
+		std::error_code Error;
+		for (const auto& Entry : fs::recursive_directory_iterator(fs::path(GCacheDir), Error))
+		{
+			if (!Entry.is_regular_file())
+				continue;
+
+			const FString FileName = Entry.path().filename().string();
+			const bool bStatic = FileName.size() > 7 && FileName.compare(FileName.size() - 7, 7, ".sm.bin") == 0;
+			const bool bSkeletal = FileName.size() > 7 && FileName.compare(FileName.size() - 7, 7, ".sk.bin") == 0;
+			if (!bStatic && !bSkeletal)
+				continue;
+
+			const FString PathStr = Entry.path().string();
+			uint32 LoadedVersion = 0;
+			double StreamMS = 0.0;
+			double MappedMS = 0.0;
+			try
+			{
+				FWindowsBinReader StreamReader(PathStr);
+				StreamMS = LoadMeshCache(StreamReader, bStatic, LoadedVersion);
+
+				FMemoryMappedReader MappedReader(PathStr);
+				MappedMS = LoadMeshCache(MappedReader, bStatic, LoadedVersion);
+			}
+			catch (const std::exception& e)
+			{
+				AddLog("[error] %s: %s", PathStr.c_str(), e.what());
+				continue;
+			}
+
+			const uint64 FileBytes = static_cast<uint64>(Entry.file_size());
+			AddLog("- %s: v%u, %.2f MB, stream %.2f ms, mapped %.2f ms", PathStr.c_str(), LoadedVersion,
+				FileBytes / (1024.0 * 1024.0), StreamMS, MappedMS);
+
+			++FileCount;
+			TotalBytes += FileBytes;
+			TotalStreamMS += StreamMS;
+			TotalMappedMS += MappedMS;
+		}
+
+		AddLog("BENCH MESHLOAD: %d files, %.2f MB, stream %.2f ms / mapped %.2f ms total", FileCount,
+			TotalBytes / (1024.0 * 1024.0), TotalStreamMS, TotalMappedMS);
+		AddLog("Peak working set: %.1f MB -> %.1f MB", PeakBeforeMB, GetPeakWorkingSetMB());
+	}
+	else if (Stricmp(command_line, "BENCH OBJPARSE") == 0)
+	{
+		// Data 폴더의 모든 .obj를 캐시 없이 다시 파싱해 지오메트리 파서 처리량(MB/s)을 측정 (mtl 제외)
+		// 파일마다 이전 파서 결과와 정점/인덱스/머티리얼 정보를 비교해 다르면 오류로 표시
+		int32 FileCount = 0;
+		int32 MismatchCount = 0;
+		uint64 TotalBytes = 0;
+		double TotalMS = 0.0;
+		double TotalReferenceMS = 0.0;
+
+		std::error_code Error;
+		for (const auto& Entry : fs::recursive_directory_iterator(fs::path(GDataDir), Error))
+		{
+			if (!Entry.is_regular_file())
+				continue;
+
+			FString Extension = Entry.path().extension().string();
+			std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+			if (Extension != ".obj")
+				continue;
+
+			const FString PathStr = NormalizePath(Entry.path().string());
+			double ParseMS = 0.0;
+			double ReferenceMS = 0.0;
+			uint32 PositionCount = 0;
+			uint32 IndexCount = 0;
+			uint32 MaterialCount = 0;
+			bool bMatchesReference = false;
+			if (!FObjImporter::BenchmarkParseObj(PathStr, ParseMS, ReferenceMS, PositionCount, IndexCount, MaterialCount, bMatchesReference))
+			{
+				AddLog("[error] %s: parse failed", PathStr.c_str());
+				continue;
+			}
+
+			const uint64 FileBytes = static_cast<uint64>(Entry.file_size());
+			const double FileMB = FileBytes / (1024.0 * 1024.0);
+			AddLog("%s%s: %.2f MB, %u verts, %u indices, %u materials, %.2f ms (%.1f MB/s), old parser %.2f ms%s",
+				bMatchesReference ? "- " : "[error] ", PathStr.c_str(), FileMB, PositionCount, IndexCount, MaterialCount,
+				ParseMS, ParseMS > 0.0 ? FileMB / (ParseMS / 1000.0) : 0.0, ReferenceMS, bMatchesReference ? "" : ", output differs from old parser");
+
+			++FileCount;
+			MismatchCount += bMatchesReference ? 0 : 1;
+			TotalBytes += FileBytes;
+			TotalMS += ParseMS;
+			TotalReferenceMS += ReferenceMS;
+		}
+
+		const double TotalMB = TotalBytes / (1024.0 * 1024.0);
+		AddLog("%sBENCH OBJPARSE: %d files, %.2f MB, %.2f ms total (%.1f MB/s), old parser %.2f ms (%.1f MB/s), %d mismatched",
+			MismatchCount > 0 ? "[error] " : "", FileCount, TotalMB, TotalMS, TotalMS > 0.0 ? TotalMB / (TotalMS / 1000.0) : 0.0,
+			TotalReferenceMS, TotalReferenceMS > 0.0 ? TotalMB / (TotalReferenceMS / 1000.0) : 0.0, MismatchCount);
+	}
+	else if (Stricmp(command_line, "BENCH OBJCONVERT") == 0)
+	{
+		// 합성 격자로 FObjInfo -> FStaticMesh 변환(탄젠트 + 정점 용접) 시간을 규모별로 측정
+		for (uint32 FaceVertexCount : { 100000u, 1000000u, 5000000u })
+		{
+			double ConvertMS = 0.0;
+			double ReferenceMS = 0.0;
+			uint32 VertexCount = 0;
+			bool bMatches = false;
+			FObjImporter::BenchmarkConvertToStaticMesh(FaceVertexCount, ConvertMS, ReferenceMS, VertexCount, bMatches);
+			AddLog("BENCH OBJCONVERT %u face-verts: %u verts, convert %.2f ms, previous implementation %.2f ms, output %s",
+				FaceVertexCount, VertexCount, ConvertMS, ReferenceMS, bMatches ? "match" : "MISMATCH");
+		}
+	}
+	else if (Stricmp(command_line, "BENCH SKINNING") == 0)
+	{
+		// SKM_Manny_Simple의 CPU 스키닝 처리량을 스레드 수별로 측정
+		const FString MeshPath = GDataDir + "/SKM_Manny_Simple.fbx";
+		FSkeletalMesh* Mesh = FFBXManager::LoadFBXSkeletalMeshAsset(MeshPath);
+		if (!Mesh || Mesh->SkinnedVertices.empty())
+		{
+			AddLog("[error] BENCH SKINNING: failed to load %s", MeshPath.c_str());
+		}
+		else
+		{
+			constexpr int32 Iterations = 200;
+			AddLog("BENCH SKINNING: %s, %zu verts, %zu bones, %d iterations (pool threads: %d)", MeshPath.c_str(),
+				Mesh->SkinnedVertices.size(), Mesh->Bones.size(), Iterations, GetParallelForThreadCount());
+			for (int32 ThreadCount : { 1, 4, 8 })
+			{
+				const double LinearVertsPerMS = FSkinningKernel::Benchmark(*Mesh, ESkinningMode::Linear, ThreadCount, Iterations);
+				const double DualQuatVertsPerMS = FSkinningKernel::Benchmark(*Mesh, ESkinningMode::DualQuaternion, ThreadCount, Iterations);
+				AddLog("- %d thread(s): LBS %.0f verts/ms, DQS %.0f verts/ms", ThreadCount, LinearVertsPerMS, DualQuatVertsPerMS);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "BENCH ANIM") == 0)
+	{
+		// Data 폴더 FBX의 애님 스택마다 클립 메모리(원본 FTransform 대비)와 초당 포즈 샘플 수를 측정
+		constexpr int32 Iterations = 20000;
+		int32 ClipCount = 0;
+		size_t TotalRawBytes = 0;
+		size_t TotalCompressedBytes = 0;
+
+		std::error_code Error;
+		for (const auto& Entry : fs::recursive_directory_iterator(fs::path(GDataDir), Error))
+		{
+			if (!Entry.is_regular_file())
+				continue;
+
+			FString Extension = Entry.path().extension().string();
+			std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+			if (Extension != ".fbx")
+				continue;
+
+			const FString PathStr = NormalizePath(Entry.path().string());
+			const TArray<FAnimSequence*>* Sequences = FFBXManager::LoadFBXAnimSequences(PathStr);
+			if (!Sequences)
+				continue;
+
+			for (const FAnimSequence* Sequence : *Sequences)
+			{
+				const size_t RawBytes = Sequence->GetRawSize();
+				const size_t CompressedBytes = Sequence->GetCompressedSize();
+				const double PosesPerSecond = FAnimSampler::Benchmark(*Sequence, Iterations);
+				AddLog("- %s [%s]: %d frames, %d tracks (%d constant channels), %.1f KB -> %.1f KB (%.1fx), %.0f poses/s, %.1f M bone samples/s",
+					PathStr.c_str(), Sequence->Name.c_str(), Sequence->NumFrames, Sequence->GetNumTracks(), Sequence->GetConstantChannelCount(),
+					RawBytes / 1024.0, CompressedBytes / 1024.0, CompressedBytes > 0 ? static_cast<double>(RawBytes) / CompressedBytes : 0.0,
+					PosesPerSecond, PosesPerSecond * Sequence->GetNumTracks() / 1e6);
+
+				++ClipCount;
+				TotalRawBytes += RawBytes;
+				TotalCompressedBytes += CompressedBytes;
+			}
+		}
+
+		if (ClipCount == 0)
+		{
+			AddLog("BENCH ANIM: no animation stack found under %s", GDataDir.c_str());
+		}
+		else
+		{
+			AddLog("BENCH ANIM: %d clip(s), %.1f KB -> %.1f KB total, %.1f KB per clip", ClipCount,
+				TotalRawBytes / 1024.0, TotalCompressedBytes / 1024.0, TotalCompressedBytes / 1024.0 / ClipCount);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH OBJITER") == 0)
+	{
+		// 100k 혼합 오브젝트에서 GUObjectArray 전체 스캔(부모 체인 IsA) vs 클래스별 인스턴스 목록 순회 비교
+		constexpr int32 ObjectCount = 100000;
+		UClass* const MixedClasses[] = {
+			UActorComponent::StaticClass(), USceneComponent::StaticClass(),
+			UPointLightComponent::StaticClass(), USpotLightComponent::StaticClass() };
+
+		TArray<UObject*> Created;
+		Created.reserve(ObjectCount);
+		for (int32 i = 0; i < ObjectCount; ++i)
+		{
+			Created.Add(NewObject(MixedClasses[i % 4]));
+		}
+
+		auto IsChildOfByChain = [](const UClass* Class, const UClass* Base)
+		{
+			for (const UClass* C = Class; C; C = C->Super)
+				if (C == Base) return true;
+			return false;
+		};
+		auto MeasureMS = [](auto&& Func)
+		{
+			const auto Start = std::chrono::high_resolution_clock::now();
+			Func();
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+		};
+
+		// 기존 TObjectIterator 방식: 모든 슬롯 + 부모 체인 순회
+		UClass* const LightClass = ULocalLightComponent::StaticClass();
+		int32 ScanCount = 0;
+		const double ScanMS = MeasureMS([&]()
+		{
+			for (UObject* Obj : GUObjectArray)
+			{
+				if (Obj && IsChildOfByChain(Obj->GetClass(), LightClass))
+					++ScanCount;
+			}
+		});
+
+		int32 IterCount = 0;
+		const double IterMS = MeasureMS([&]()
+		{
+			for (TObjectIterator<ULocalLightComponent> It; It; ++It)
+				++IterCount;
+		});
+
+		// IsA 자체 비용: 부모 체인 vs 클래스 트리 구간 검사
+		int32 ChainHits = 0;
+		int32 RangeHits = 0;
+		const double ChainMS = MeasureMS([&]()
+		{
+			for (UObject* Obj : Created)
+				ChainHits += IsChildOfByChain(Obj->GetClass(), LightClass) ? 1 : 0;
+		});
+		const double RangeMS = MeasureMS([&]()
+		{
+			for (UObject* Obj : Created)
+				RangeHits += Obj->IsA(LightClass) ? 1 : 0;
+		});
+
+		AddLog("BENCH OBJITER: %d mixed objects (GUObjectArray %d slots)", ObjectCount, GUObjectArray.Num());
+		AddLog("- ULocalLightComponent lookup: full scan %.3f ms (%d) -> class list %.3f ms (%d)", ScanMS, ScanCount, IterMS, IterCount);
+		AddLog("- IsA x%d: parent chain %.3f ms (%d) -> range check %.3f ms (%d)", ObjectCount, ChainMS, ChainHits, RangeMS, RangeHits);
+
+		for (UObject* Obj : Created)
+		{
+			DeleteObject(Obj);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH MESHSORT") == 0)
+	{
+		// 합성 메시 배치에서 64비트 키 + 기수 정렬 vs 배치 구조체 operator< 정렬 비교
+		constexpr int32 Iterations = 20;
+		for (uint32 BatchCount : { 10000u, 100000u })
+		{
+			double KeySortMS = 0.0;
+			double StdSortMS = 0.0;
+			uint32 KeyStateChanges = 0;
+			uint32 StdStateChanges = 0;
+			FMeshBatchSorter::Benchmark(BatchCount, Iterations, KeySortMS, StdSortMS, KeyStateChanges, StdStateChanges);
+			AddLog("BENCH MESHSORT %u batches: key radix %.3f ms (%u state changes), struct sort %.3f ms (%u state changes)",
+				BatchCount, KeySortMS, KeyStateChanges, StdSortMS, StdStateChanges);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH BVHREFIT") == 0)
+	{
+		// 매 프레임 모두 움직이는 합성 도형으로 파티션 BVH(FBVHierarchy)와 충돌 BVH(FCollisionBVH)의 Refit vs 전체 재구축 프레임당 비용 비교
+		constexpr int32 Frames = 120;
+		for (int32 ShapeCount : { 1000, 10000 })
+		{
+			double RefitMS = 0.0;
+			double RebuildMS = 0.0;
+			int32 ThresholdRebuilds = 0;
+			FBVHierarchy::BenchmarkRefit(ShapeCount, Frames, RefitMS, RebuildMS, ThresholdRebuilds);
+			AddLog("BENCH BVHREFIT partition %d moving shapes x %d frames: refit %.3f ms/frame (%d SAH rebuilds), full rebuild %.3f ms/frame",
+				ShapeCount, Frames, RefitMS, ThresholdRebuilds, RebuildMS);
+
+			FCollisionBVH::BenchmarkRefit(ShapeCount, Frames, RefitMS, RebuildMS, ThresholdRebuilds);
+			AddLog("BENCH BVHREFIT collision %d moving shapes x %d frames: refit %.3f ms/frame (%d SAH rebuilds), full rebuild %.3f ms/frame",
+				ShapeCount, Frames, RefitMS, ThresholdRebuilds, RebuildMS);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH TRANSFORM") == 0)
+	{
+		// 현재 월드의 모든 씬 컴포넌트 월드 트랜스폼 조회: 캐시(저장소) vs 매번 부착 체인 합성(캐시 도입 전 방식)
+		TArray<USceneComponent*> Components;
+		if (GWorld)
+		{
+			for (AActor* Actor : GWorld->GetActors())
+			{
+				if (Actor && !Actor->IsPendingDestroy() && !Actor->IsPooled())
+				{
+					for (USceneComponent* Component : Actor->GetSceneComponents())
+					{
+						if (Component)
+						{
+							Components.Add(Component);
+						}
+					}
+				}
+			}
+		}
+
+		if (Components.IsEmpty())
+		{
+			AddLog("BENCH TRANSFORM: no scene components in the current world");
+		}
+		else
+		{
+			constexpr int32 Passes = 100;
+			FTransformStatManager& TransformStats = FTransformStatManager::GetInstance();
+			const FTransformFrameStats SavedStats = TransformStats.GetCurrentStats();
+
+			// 첫 조회에서 더티 엔트리를 정리해 두고 캐시 적중 상태의 비용을 잰다 (정리 패스는 별도 표시)
+			const auto WarmStart = std::chrono::high_resolution_clock::now();
+			for (USceneComponent* Component : Components)
+			{
+				Component->GetWorldTransform();
+			}
+			const double WarmMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - WarmStart).count();
+			const uint32 WarmCompositions = TransformStats.GetCurrentStats().CompositionCount - SavedStats.CompositionCount;
+
+			float Sink = 0.0f;
+			const uint32 CachedStartCompositions = TransformStats.GetCurrentStats().CompositionCount;
+			const auto CachedStart = std::chrono::high_resolution_clock::now();
+			for (int32 Pass = 0; Pass < Passes; ++Pass)
+			{
+				for (USceneComponent* Component : Components)
+				{
+					Sink += Component->GetWorldTransform().Translation.X;
+				}
+			}
+			const double CachedMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CachedStart).count();
+			const uint32 CachedCompositions = TransformStats.GetCurrentStats().CompositionCount - CachedStartCompositions;
+
+			// 벤치마크 조회가 STAT TRANSFORM 오버레이의 프레임 통계에 섞이지 않도록 되돌린다
+			TransformStats.SetCurrentStats(SavedStats);
+
+			uint32 UncachedCompositions = 0;
+			const auto UncachedStart = std::chrono::high_resolution_clock::now();
+			for (int32 Pass = 0; Pass < Passes; ++Pass)
+			{
+				for (USceneComponent* Component : Components)
+				{
+					Sink += Component->ComputeWorldTransformUncached(&UncachedCompositions).Translation.X;
+				}
+			}
+			const double UncachedMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - UncachedStart).count();
+
+			AddLog("BENCH TRANSFORM: %d components, %d passes (each pass queries every component once, checksum %.1f)",
+				Components.Num(), Passes, Sink);
+			AddLog("- cached: %.3f ms/pass, %u compositions/pass (warm-up pass %.3f ms, %u compositions)",
+				CachedMS / Passes, CachedCompositions / Passes, WarmMS, WarmCompositions);
+			AddLog("- uncached chain: %.3f ms/pass, %u compositions/pass",
+				UncachedMS / Passes, UncachedCompositions / Passes);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH BATCHALLOC") == 0)
+	{
+		// 다음 프레임들의 배치 수집/정렬/그리기 구간 힙 할당과 프레임 아레나 청크 할당이 0인지 검사. 결과는 검사가 끝난 프레임에 로그로 남는다
+		constexpr uint32 Frames = 120;
+		if (!CMemoryManager::IsGlobalHeapCountingSupported())
+		{
+			AddLog("[warning] BENCH BATCHALLOC: heap counting is compiled out (MUNDI_COUNT_HEAP_ALLOCS=0)");
+		}
+		else if (FFrameAllocationStatManager::GetInstance().IsAllocationCheckRunning())
+		{
+			AddLog("[warning] BENCH BATCHALLOC: a check is already running");
+		}
+		else
+		{
+			FFrameAllocationStatManager::GetInstance().BeginAllocationCheck(Frames);
+			AddLog("BENCH BATCHALLOC: checking the next %u rendered frames...", Frames);
+		}
+	}
+	else if (Stricmp(command_line, "VERIFY TRANSFORM") == 0)
+	{
+		// 현재 월드 계층에 무작위 변경/재부착을 가하며 캐시된 월드 트랜스폼을 부착 체인 재계산 결과와 비교 (고정 시드, 끝나면 원상 복구)
+		constexpr int32 Rounds = 200;
+		int32 CheckCount = 0;
+		float MaxError = 0.0f;
+		const int32 MismatchCount = USceneComponent::VerifyWorldTransformCache(GWorld, Rounds, CheckCount, MaxError);
+		if (CheckCount == 0)
+		{
+			AddLog("VERIFY TRANSFORM: no scene components in the current world");
+		}
+		else if (MismatchCount > 0)
+		{
+			AddLog("[error] VERIFY TRANSFORM: %d / %d comparisons mismatched over %d rounds (max error %.6f)",
+				MismatchCount, CheckCount, Rounds, MaxError);
+		}
+		else
+		{
+			AddLog("VERIFY TRANSFORM: %d comparisons over %d rounds matched (max error %.6f)", CheckCount, Rounds, MaxError);
+		}
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
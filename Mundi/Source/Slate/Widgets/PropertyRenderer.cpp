@@ -160,6 +160,15 @@ bool UPropertyRenderer::RenderProperty(const FProperty& Property, void* ObjectIn
 				LightComponent->UpdateLightData();
 			}
 		}
+
+		// SkinnedMeshComponent는 스키닝 방식이 바뀌면 Setter를 통해 멈춘 포즈도 다시 스키닝하도록 표시
+		if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(Obj))
+		{
+			if (strcmp(Property.Name, "SkinningMode") == 0)
+			{
+				SkinnedMeshComponent->SetSkinningMode(*Property.GetValuePtr<ESkinningMode>(ObjectInstance));
+			}
+		}
 	}
 
 	return bChanged;
@@ -1493,6 +1493,46 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("쉐도우 맵 메모리 사용량 통계를 표시합니다.");
 			}
 
+			bool bCullingStats = UStatsOverlayD2D::Get().IsCullingVisible();
+			if (ImGui::Checkbox(" CULLING", &bCullingStats))
+			{
+				UStatsOverlayD2D::Get().ToggleCulling();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("컴포넌트 절두체 컬링 통계(테스트/컬링 수)를 표시합니다.");
+			}
+
+			bool bBVHStats = UStatsOverlayD2D::Get().IsBVHVisible();
+			if (ImGui::Checkbox(" BVH", &bBVHStats))
+			{
+				UStatsOverlayD2D::Get().ToggleBVH();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("BVH Refit/재구축 횟수와 소요 시간을 표시합니다.");
+			}
+
+			bool bAnimationStats = UStatsOverlayD2D::Get().IsAnimationVisible();
+			if (ImGui::Checkbox(" ANIM", &bAnimationStats))
+			{
+				UStatsOverlayD2D::Get().ToggleAnimation();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("프레임당 애니메이션 갱신 본/정점 수, 포즈 평가/스키닝 시간, 업데이트 빈도 제한으로 생략한 정점 수를 표시합니다.");
+			}
+
+			bool bTransformStats = UStatsOverlayD2D::Get().IsTransformVisible();
+			if (ImGui::Checkbox(" TRANSFORM", &bTransformStats))
+			{
+				UStatsOverlayD2D::Get().ToggleTransform();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("프레임당 월드 트랜스폼 합성 횟수와 캐시 적중 횟수를 표시합니다.");
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -1523,6 +1563,19 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("BVH(Bounding Volume Hierarchy) 디버그 시각화를 표시합니다.");
 		}
 
+		// Frustum Culling
+		bool bCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Culling);
+		if (ImGui::Checkbox("##Culling", &bCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_Culling);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 절두체 컬링");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("파티션 BVH를 이용한 컴포넌트 단위 절두체 컬링을 사용합니다.");
+		}
+
 		// Collision
 		bool bCollision = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Collision);
 		if (ImGui::Checkbox("##Collision", &bCollision))
@@ -1979,6 +2032,21 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			// 현재 설정값 표시
 			ImGui::Text("현재 타일 크기: %d x %d", RenderSettings.GetTileSize(), RenderSettings.GetTileSize());
 
+			ImGui::Separator();
+
+			// 클러스터 깊이 슬라이스 (0 = 2D 타일)
+			int clusterSlices = static_cast<int>(RenderSettings.GetClusterDepthSlices());
+			ImGui::Text("깊이 슬라이스 (클러스터)");
+			ImGui::SetNextItemWidth(150);
+			if (ImGui::SliderInt("##ClusterSlices", &clusterSlices, 0, 32))
+			{
+				RenderSettings.SetClusterDepthSlices(static_cast<uint32>(clusterSlices));
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("0이면 2D 타일 컬링, 1~32면 타일을 로그 깊이 슬라이스로 나눠 라이트를 컬링합니다. (원근 투영 전용)");
+			}
+
 			ImGui::EndMenu();
 		}
 		if (ImGui::IsItemHovered())
@@ -2327,6 +2395,21 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("섀도우 필터링 타입 및 파라미터 설정");
 			}
 
+			ImGui::Separator();
+
+			if (World && World->GetShadowManager())
+			{
+				bool bStaticShadowCache = World->GetShadowManager()->GetShadowConfiguration().bEnableStaticShadowCache;
+				if (ImGui::Checkbox(" 정적 섀도우 캐시", &bStaticShadowCache))
+				{
+					World->GetShadowManager()->SetStaticShadowCacheEnabled(bStaticShadowCache);
+				}
+				if (ImGui::IsItemHovered())
+				{
+					ImGui::SetTooltip("SpotLight/PointLight 섀도우 맵의 정적 캐스터를 캐시하고 라이트나 정적 캐스터가 바뀐 뷰만 다시 그립니다.\n(해당 섀도우 맵 메모리 2배)");
+				}
+			}
+
 			ImGui::EndMenu();
 		}
 		if (ImGui::IsItemHovered())